@@ -51,6 +51,23 @@ namespace ALEngine
 		internal extern static int RigidbodyComponent_getTouchedNum(ulong entityID);
 		#endregion
 
+		#region Physics
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static bool Physics_rayCast(ref Vector3 origin, ref Vector3 direction, float maxDistance, out RaycastHit hit);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static bool Physics_sphereCast(ref Vector3 origin, float radius, ref Vector3 direction, float maxDistance, out RaycastHit hit);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static ulong[] Physics_overlapAABB(ref Vector3 min, ref Vector3 max);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int Physics_rayCastBatch(Vector3[] origins, Vector3[] directions, float maxDistance, RaycastHit[] hits);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static void Physics_addForces(ulong[] entityIDs, Vector3[] forces);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static void Physics_getStats(out PhysicsStats stats);
+		[MethodImplAttribute(MethodImplOptions.InternalCall)]
+		internal extern static int Physics_getIslandSizeHistogram(int[] histogram);
+		#endregion
+
 		#region ScriptComponent
 		[MethodImplAttribute(MethodImplOptions.InternalCall)]
 		internal extern static void ScriptComponent_getField(ulong entityID, string fieldName, out bool ret);
@@ -0,0 +1,111 @@
+namespace ALEngine
+{
+	// 물리 쿼리 결과
+	public struct RaycastHit
+	{
+		public ulong EntityID;
+		public Vector3 Point;
+		public Vector3 Normal;
+		public float Distance;
+
+		public Entity Entity => EntityID == 0 ? null : new Entity(EntityID);
+	}
+
+	// 마지막 물리 step의 통계 (시간은 밀리초 단위)
+	public struct PhysicsStats
+	{
+		public int BodyCount;
+		public int AwakeBodyCount;
+		public int PairCount;
+		public int ReinsertCount;
+		public int NewContactCount;
+		public int ContactCount;
+		public int TouchingContactCount;
+		public int GjkIterations;
+		public int EpaFaces;
+		public int IslandCount;
+		public int LargestIslandSize;
+		public float IntegrateTime;
+		public float BroadPhaseTime;
+		public float NarrowPhaseTime;
+		public float IslandTime;
+		public float SolveTime;
+		public float ToiTime;
+		public float StepTime;
+	}
+
+	public static class Physics
+	{
+		/// <summary>
+		/// ray를 쏘아 가장 먼저 닿는 Rigidbody를 찾습니다. Trigger 콜라이더는 무시합니다.
+		/// </summary>
+		public static bool rayCast(Vector3 origin, Vector3 direction, float maxDistance, out RaycastHit hit)
+		{
+			return InternalCalls.Physics_rayCast(ref origin, ref direction, maxDistance, out hit);
+		}
+
+		/// <summary>
+		/// 구를 이동시켜 가장 먼저 닿는 Rigidbody를 찾습니다.
+		/// </summary>
+		public static bool sphereCast(Vector3 origin, float radius, Vector3 direction, float maxDistance, out RaycastHit hit)
+		{
+			return InternalCalls.Physics_sphereCast(ref origin, radius, ref direction, maxDistance, out hit);
+		}
+
+		/// <summary>
+		/// AABB와 겹치는 Rigidbody를 가진 Entity들을 반환합니다.
+		/// </summary>
+		public static Entity[] overlapAABB(Vector3 min, Vector3 max)
+		{
+			ulong[] uuids = InternalCalls.Physics_overlapAABB(ref min, ref max);
+
+			Entity[] entities = new Entity[uuids.Length];
+			for (int i = 0; i < uuids.Length; i++)
+			{
+				entities[i] = new Entity(uuids[i]);
+			}
+
+			return entities;
+		}
+
+		/// <summary>
+		/// 여러 ray를 한 번에 쏩니다. hits[i]는 i번째 ray의 결과이며, 닿지 않은 ray는 EntityID가 0입니다.
+		/// </summary>
+		public static int rayCastBatch(Vector3[] origins, Vector3[] directions, float maxDistance, RaycastHit[] hits)
+		{
+			return InternalCalls.Physics_rayCastBatch(origins, directions, maxDistance, hits);
+		}
+
+		/// <summary>
+		/// 여러 Entity의 Rigidbody에 외력을 한 번에 등록합니다. forces[i]는 entities[i]에 적용됩니다.
+		/// </summary>
+		public static void addForces(Entity[] entities, Vector3[] forces)
+		{
+			ulong[] ids = new ulong[entities.Length];
+			for (int i = 0; i < entities.Length; i++)
+			{
+				ids[i] = entities[i].ID;
+			}
+
+			InternalCalls.Physics_addForces(ids, forces);
+		}
+
+		/// <summary>
+		/// 마지막 물리 step의 통계를 반환합니다.
+		/// </summary>
+		public static PhysicsStats getStats()
+		{
+			InternalCalls.Physics_getStats(out PhysicsStats stats);
+			return stats;
+		}
+
+		/// <summary>
+		/// body 개수별 Island 개수를 채웁니다. histogram[i]는 body 개수가 2^i 이상 2^(i+1) 미만인 Island 수이며,
+		/// 마지막 칸은 그 이상을 모두 포함합니다. 채운 칸 수를 반환합니다.
+		/// </summary>
+		public static int getIslandSizeHistogram(int[] histogram)
+		{
+			return InternalCalls.Physics_getIslandSizeHistogram(histogram);
+		}
+	}
+}
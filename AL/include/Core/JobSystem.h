@@ -0,0 +1,128 @@
+#pragma once
+
+/**
+ * @file JobSystem.h
+ * @brief 작업 훔치기(work-stealing) 기반 JobSystem 클래스 정의
+ *
+ * 이 파일은 워커 스레드마다 독립적인 작업 큐를 두고, 자신의 큐가 비면 다른 워커의 큐에서
+ * 작업을 훔쳐 오는 `JobSystem` 클래스를 정의합니다.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ale
+{
+/**
+ * @class JobSystem
+ * @brief 작업 훔치기 방식으로 작업을 병렬 실행하는 스레드 풀 클래스
+ *
+ * 작업은 제출 시 워커 큐에 순서대로 분배됩니다. 워커는 자신의 큐 뒤쪽에서 작업을 꺼내고,
+ * 큐가 비면 다른 워커 큐의 앞쪽에서 작업을 훔칩니다. `wait()`를 호출한 스레드(메인 스레드)도
+ * 마지막 워커 인덱스로 작업 실행에 참여합니다.
+ */
+class JobSystem
+{
+  public:
+	/**
+	 * @brief 작업 함수 타입
+	 *
+	 * 인자로 작업을 실행하는 워커의 인덱스(0 ~ getWorkerCount() - 1)를 전달받습니다.
+	 */
+	using Job = std::function<void(int32_t workerIndex)>;
+
+	/**
+	 * @brief JobSystem 생성자
+	 *
+	 * @param workerCount 메인 스레드를 포함한 워커 개수. 0 이하이면 하드웨어 스레드 개수를 사용합니다.
+	 */
+	explicit JobSystem(int32_t workerCount = 0);
+
+	/**
+	 * @brief JobSystem 소멸자
+	 *
+	 * 모든 워커 스레드를 종료하고 join 합니다.
+	 */
+	~JobSystem();
+
+	JobSystem(const JobSystem &) = delete;
+	JobSystem &operator=(const JobSystem &) = delete;
+
+	/**
+	 * @brief 작업을 제출합니다.
+	 *
+	 * @param job 실행할 작업
+	 */
+	void submit(Job job);
+
+	/**
+	 * @brief 제출된 모든 작업이 끝날 때까지 대기합니다.
+	 *
+	 * 대기하는 동안 호출한 스레드도 남은 작업을 꺼내 실행합니다.
+	 */
+	void wait();
+
+	/**
+	 * @brief 메인 스레드를 포함한 워커 개수를 반환합니다.
+	 *
+	 * @return 워커 개수
+	 */
+	int32_t getWorkerCount() const;
+
+  private:
+	/**
+	 * @struct WorkerQueue
+	 * @brief 워커마다 하나씩 존재하는 작업 큐
+	 */
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	/**
+	 * @brief 워커 스레드의 실행 루프
+	 *
+	 * @param workerIndex 워커 인덱스
+	 */
+	void workerLoop(int32_t workerIndex);
+
+	/**
+	 * @brief 실행할 작업을 하나 꺼냅니다.
+	 *
+	 * 자신의 큐 뒤쪽을 먼저 확인하고, 비어 있으면 다른 워커 큐의 앞쪽에서 훔쳐 옵니다.
+	 *
+	 * @param workerIndex 작업을 꺼내는 워커 인덱스
+	 * @param job 꺼낸 작업을 저장할 변수
+	 * @return 작업을 꺼냈으면 true, 모든 큐가 비어 있으면 false
+	 */
+	bool popJob(int32_t workerIndex, Job &job);
+
+	/**
+	 * @brief 작업을 실행하고 남은 작업 개수를 갱신합니다.
+	 *
+	 * @param job 실행할 작업
+	 * @param workerIndex 실행하는 워커 인덱스
+	 */
+	void runJob(Job &job, int32_t workerIndex);
+
+	std::vector<std::thread> m_threads;
+	std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+	std::mutex m_wakeMutex;
+	std::condition_variable m_wakeCondition;
+	std::condition_variable m_doneCondition;
+
+	std::atomic<int32_t> m_pendingJobs; /**< 제출되었지만 아직 끝나지 않은 작업 수 */
+	std::atomic<int32_t> m_queuedJobs;	/**< 큐에 남아 있는 작업 수 */
+	std::atomic<uint32_t> m_nextQueue;
+	bool m_isRunning;
+	int32_t m_workerCount;
+};
+} // namespace ale
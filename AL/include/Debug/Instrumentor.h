@@ -12,6 +12,7 @@
 #include "Core/Log.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
@@ -93,6 +94,7 @@ class Instrumentor
 		{
 			m_CurrentSession = new InstrumentationSession({name});
 			writeHeader();
+			m_IsSessionActive.store(true, std::memory_order_release);
 		}
 		else
 		{
@@ -119,6 +121,12 @@ class Instrumentor
 	 */
 	void writeProfile(const ProfileResult &result)
 	{
+		// 세션이 없으면 락을 잡거나 문자열을 만들지 않고 바로 반환
+		if (!m_IsSessionActive.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
 		std::stringstream json;
 
 		json << std::setprecision(3) << std::fixed;
@@ -152,7 +160,7 @@ class Instrumentor
 	}
 
   private:
-	Instrumentor() : m_CurrentSession(nullptr)
+	Instrumentor() : m_CurrentSession(nullptr), m_IsSessionActive(false)
 	{
 	}
 
@@ -186,6 +194,7 @@ class Instrumentor
 	{
 		if (m_CurrentSession)
 		{
+			m_IsSessionActive.store(false, std::memory_order_release);
 			writeFooter();
 			m_OutputStream.close();
 			delete m_CurrentSession;
@@ -196,6 +205,7 @@ class Instrumentor
   private:
 	std::mutex m_Mutex;
 	InstrumentationSession *m_CurrentSession;
+	std::atomic<bool> m_IsSessionActive; /**< 락 없이 확인하는 세션 활성 여부 */
 	std::ofstream m_OutputStream;
 };
 
@@ -330,8 +340,8 @@ template <size_t N, size_t K> constexpr auto cleanupOutputString(const char (&ex
 #else
 #define AL_PROFILE_BEGIN_SESSION(name, filepath)
 #define AL_PROFILE_END_SESSION()
-#define AL_PROFILE_SCOPE_LINE2()
-#define AL_PROFILE_SCOPE_LINE()
-#define AL_PROFILE_SCOPE()
+#define AL_PROFILE_SCOPE_LINE2(name, line)
+#define AL_PROFILE_SCOPE_LINE(name, line)
+#define AL_PROFILE_SCOPE(name)
 #define AL_PROFILE_FUNCTION()
 #endif
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "Memory/MemoryTracker.h"
+
+#include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace ale
 {
@@ -14,6 +19,8 @@ const int32_t CHUNK_SIZE = 1024 * 1024;	   /**< 청크 크기 (1MB) */
 const int32_t MAX_BLOCK_SIZE = 4096;	   /**< 최대 블록 크기 */
 const int32_t BLOCK_SIZE_COUNT = 16;	   /**< 블록 크기 개수 */
 const int32_t CHUNK_ARRAY_INCREMENT = 256; /**< 청크 배열 증가 단위 */
+const int32_t MAGAZINE_SIZE = 32;		   /**< 스레드 캐시와 공유 저장소가 한 번에 주고받는 블록 수 */
+const int32_t MAX_THREAD_CACHE_SLOTS = 4;  /**< 한 스레드가 캐시를 둘 수 있는 BlockAllocator 개수 */
 
 /**
  * @struct Block
@@ -34,17 +41,60 @@ struct Chunk
 	int32_t blockSize; /**< 블록 크기 */
 };
 
+/**
+ * @struct Magazine
+ * @brief 공유 저장소에 보관하는 같은 크기 블록 묶음.
+ */
+struct Magazine
+{
+	Block *blocks; /**< next로 연결된 블록 리스트 */
+	int32_t count; /**< 블록 수 */
+};
+
+/**
+ * @struct BlockCache
+ * @brief 한 스레드가 사용하는 크기별 블록 캐시.
+ * @details 소유 스레드만 접근하므로 잠금 없이 할당과 해제를 처리합니다. 스레드가 종료되면 캐시는 남은 블록과 함께
+ *          반환되고, 이후 처음 할당하는 다른 스레드가 이어서 사용합니다.
+ */
+struct BlockCache
+{
+	Block *blocks[BLOCK_SIZE_COUNT];			   /**< 크기별 사용 가능한 블록 리스트 */
+	std::atomic<int32_t> counts[BLOCK_SIZE_COUNT]; /**< 크기별 블록 수 (통계를 위해 다른 스레드에서 읽음) */
+	BlockCache *next;							   /**< BlockAllocator가 관리하는 캐시 리스트의 다음 캐시 */
+	std::atomic<bool> isInUse;					   /**< 스레드가 사용 중이면 true */
+};
+
+/**
+ * @struct BlockAllocatorStats
+ * @brief BlockAllocator의 블록 크기별 메모리 사용량.
+ * @details 다른 스레드가 할당하는 도중에 수집하면 스레드 캐시의 블록 수는 근사값입니다.
+ */
+struct BlockAllocatorStats
+{
+	int32_t chunkCounts[BLOCK_SIZE_COUNT]; /**< 크기별 청크 수 */
+	int32_t liveBlocks[BLOCK_SIZE_COUNT];  /**< 크기별 사용 중인 블록 수 */
+	int32_t freeBlocks[BLOCK_SIZE_COUNT];  /**< 크기별 스레드 캐시와 공유 저장소에 남은 블록 수 */
+	int64_t reservedBytes;				   /**< 청크로 할당한 전체 바이트 수 */
+	int64_t liveBytes;					   /**< 사용 중인 블록의 바이트 수 */
+};
+
 /**
  * @class BlockAllocator
  * @brief 블록 기반 메모리 할당을 관리하는 클래스.
+ * @details 여러 스레드에서 동시에 호출할 수 있습니다. 각 스레드는 크기별 블록을 자신의 BlockCache에 보관하여 잠금
+ *          없이 할당과 해제를 처리하고, 캐시가 비거나 넘칠 때만 잠금을 잡고 공유 저장소와 Magazine 단위로 블록을
+ *          주고받습니다. 한 스레드에서 할당한 블록을 다른 스레드에서 해제해도 됩니다. BlockAllocator는 사용하는
+ *          스레드보다 오래 살아 있어야 합니다.
  */
 class BlockAllocator
 {
   public:
 	/**
 	 * @brief 생성자.
+	 * @param tag 청크 메모리를 집계할 서브시스템.
 	 */
-	BlockAllocator();
+	explicit BlockAllocator(MemoryTag tag);
 
 	/**
 	 * @brief 소멸자.
@@ -65,13 +115,91 @@ class BlockAllocator
 	 */
 	void freeBlock(void *pointer, int32_t size);
 
+	/**
+	 * @brief 모든 블록이 비어 있는 청크를 해제합니다.
+	 * @details 호출한 스레드와 종료된 스레드의 캐시, 공용 캐시의 블록을 공유 저장소로 모은 뒤 청크별로 세어 해제합니다.
+	 *          실행 중인 다른 스레드의 캐시에 있는 블록은 세지 않으므로 그 블록이 속한 청크는 남습니다. 폭발처럼
+	 *          일시적으로 많이 할당한 뒤나 씬을 정리한 뒤에 호출합니다.
+	 * @return 해제한 바이트 수.
+	 */
+	int64_t trim();
+
+	/**
+	 * @brief 블록 크기별 사용량을 수집합니다.
+	 * @return 블록 크기별 청크, 사용 중, 남은 블록 수.
+	 */
+	BlockAllocatorStats getStats();
+
+	/**
+	 * @brief 블록 크기별 사용량을 로그로 출력합니다.
+	 */
+	void logStats();
+
+	/**
+	 * @brief 크기 인덱스에 해당하는 블록 크기를 반환합니다.
+	 * @param index 블록 크기 인덱스 (0 ~ BLOCK_SIZE_COUNT - 1).
+	 * @return 블록 크기 (바이트 단위).
+	 */
+	static int32_t getBlockSize(int32_t index);
+
   private:
+	/**
+	 * @brief 호출한 스레드의 캐시를 반환합니다.
+	 * @return 스레드 캐시. 스레드의 캐시 슬롯이 모두 찼으면 nullptr.
+	 */
+	BlockCache *getThreadCache();
+
+	/**
+	 * @brief 사용하지 않는 캐시를 넘겨받거나 새 캐시를 만듭니다.
+	 * @return 사용 중으로 표시된 캐시.
+	 */
+	BlockCache *acquireCache();
+
+	/**
+	 * @brief 공유 저장소에서 Magazine 하나를 꺼내 빈 캐시 리스트를 채웁니다.
+	 * @details m_mutex를 잡은 상태에서 호출해야 합니다.
+	 * @param cache 채울 캐시.
+	 * @param index 블록 크기 인덱스.
+	 */
+	void refillCache(BlockCache &cache, int32_t index);
+
+	/**
+	 * @brief 캐시 리스트 앞쪽의 MAGAZINE_SIZE개 블록을 떼어 냅니다.
+	 * @param cache 블록을 떼어 낼 캐시.
+	 * @param index 블록 크기 인덱스.
+	 * @return 떼어 낸 Magazine.
+	 */
+	Magazine detachMagazine(BlockCache &cache, int32_t index);
+
+	/**
+	 * @brief 캐시의 모든 블록을 공유 저장소로 옮깁니다.
+	 * @details m_mutex를 잡은 상태에서 호출해야 합니다.
+	 * @param cache 비울 캐시.
+	 */
+	void flushCache(BlockCache &cache);
+
+	/**
+	 * @brief 새 청크를 할당하고 블록으로 나누어 공유 저장소에 Magazine 단위로 추가합니다.
+	 * @details m_mutex를 잡은 상태에서 호출해야 합니다.
+	 * @param index 블록 크기 인덱스.
+	 */
+	void allocateChunk(int32_t index);
+
+	std::mutex m_mutex; /**< 청크와 공유 저장소, 캐시 리스트 보호 */
+
 	Chunk *m_chunks;	  /**< 전체 청크 메모리 */
 	int32_t m_chunkCount; /**< 사용 중인 청크 수 */
 	int32_t m_chunkSpace; /**< 전체 청크 공간 */
 
-	Block *m_availableBlocks[BLOCK_SIZE_COUNT]; /**< 사용 가능한 블록 리스트 */
+	int32_t m_chunkCounts[BLOCK_SIZE_COUNT]; /**< 크기별 청크 수 */
+
+	std::vector<Magazine> m_magazines[BLOCK_SIZE_COUNT]; /**< 크기별 공유 저장소 */
+	BlockCache *m_caches;								 /**< 스레드에 나누어 준 캐시 리스트 */
+	BlockCache m_sharedCache;							 /**< 캐시 슬롯이 부족한 스레드가 m_mutex를 잡고 함께 쓰는 캐시 */
+	uint32_t m_id;										 /**< 스레드 캐시 슬롯에서 BlockAllocator를 구분하는 ID */
+	MemoryTag m_tag;									 /**< 청크 메모리를 집계할 서브시스템 */
 
+	static std::atomic<uint32_t> s_nextId;				  /**< 다음 BlockAllocator ID */
 	static int32_t s_blockSizes[BLOCK_SIZE_COUNT];		  /**< 블록 크기 배열 */
 	static uint8_t s_blockSizeLookup[MAX_BLOCK_SIZE + 1]; /**< 블록 크기 조회 테이블 */
 	static bool s_blockSizeLookupInitialized;			  /**< 블록 크기 조회 테이블 초기화 여부 */
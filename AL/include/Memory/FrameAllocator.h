@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ale
+{
+
+/**
+ * @file
+ * @brief 프레임 단위 임시 메모리를 할당하는 FrameAllocator 클래스 정의.
+ */
+
+const size_t FRAME_ARENA_SIZE = 4 * 1024 * 1024; /**< 프레임 버퍼 하나의 기본 크기 (4MB) */
+const int32_t FRAME_BUFFER_COUNT = 2;			 /**< 번갈아 사용하는 프레임 버퍼 개수 */
+
+/**
+ * @struct FrameAllocatorStats
+ * @brief 마지막으로 끝난 프레임의 FrameAllocator 사용량과 힙 할당 횟수.
+ */
+struct FrameAllocatorStats
+{
+	size_t capacity;			  /**< 프레임 버퍼 하나의 크기 */
+	size_t bytesUsed;			  /**< 프레임 버퍼에서 사용한 바이트 수 */
+	size_t highWater;			  /**< 한 프레임에 사용한 최대 바이트 수 */
+	int32_t allocationCount;	  /**< 프레임 버퍼에서 할당한 횟수 */
+	int32_t overflowCount;		  /**< 프레임 버퍼가 부족해 힙에서 할당한 횟수 */
+	uint64_t heapAllocationCount; /**< 프레임 동안 전역 operator new가 호출된 횟수 (AL_COUNT_HEAP_ALLOCATIONS 빌드 전용) */
+};
+
+/**
+ * @class FrameAllocator
+ * @brief 프레임마다 초기화되는 이중 버퍼 선형 할당기.
+ * @details 두 버퍼를 프레임마다 번갈아 사용하므로 프레임 N에 할당한 메모리는 프레임 N+1이 끝날 때까지 유효합니다.
+ *          개별 해제는 하지 않고 버퍼를 다시 사용할 때 한꺼번에 비웁니다. 버퍼가 부족하면 힙에서 할당하고, 버퍼를
+ *          비울 때 해제한 뒤 그 사용량을 담을 수 있을 때까지 버퍼 크기를 두 배씩 키웁니다. 메인 스레드에서만 사용합니다.
+ */
+class FrameAllocator
+{
+  public:
+	/**
+	 * @brief 생성자.
+	 * @details 버퍼는 처음 할당할 때 만듭니다.
+	 * @param capacity 프레임 버퍼 하나의 크기 (바이트 단위).
+	 */
+	explicit FrameAllocator(size_t capacity = FRAME_ARENA_SIZE);
+	/**
+	 * @brief 소멸자.
+	 */
+	~FrameAllocator();
+
+	FrameAllocator(const FrameAllocator &) = delete;
+	FrameAllocator &operator=(const FrameAllocator &) = delete;
+
+	/**
+	 * @brief 엔진 전역 FrameAllocator를 반환합니다.
+	 * @return FrameAllocator 참조.
+	 */
+	static FrameAllocator &get();
+
+	/**
+	 * @brief 전역 operator new가 호출된 전체 횟수를 반환합니다.
+	 * @details 전역 operator new를 교체하는 AL_COUNT_HEAP_ALLOCATIONS 옵션을 켠 빌드에서만 횟수를 세고, 끈 빌드에서는
+	 *          항상 0입니다.
+	 * @return 프로그램 시작 후 힙 할당 횟수.
+	 */
+	static uint64_t getHeapAllocationCount();
+
+	/**
+	 * @brief 새 프레임을 시작합니다.
+	 * @details 끝난 프레임의 통계를 저장하고, 두 프레임 전에 사용한 버퍼를 비워 이번 프레임에 사용합니다.
+	 */
+	void beginFrame();
+
+	/**
+	 * @brief 현재 프레임 버퍼에서 메모리를 할당합니다.
+	 * @param size 할당할 메모리 크기 (바이트 단위).
+	 * @param alignment 정렬 단위 (2의 거듭제곱).
+	 * @return 할당된 메모리의 포인터.
+	 */
+	void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	/**
+	 * @brief 현재 프레임 버퍼에 객체를 생성합니다.
+	 * @details 소멸자는 호출되지 않으므로 메모리를 모두 이 할당기에서 받는 객체에만 사용합니다.
+	 * @param args 생성자 인자.
+	 * @return 생성된 객체의 포인터.
+	 */
+	template <typename T, typename... Args> T *create(Args &&...args)
+	{
+		return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief std::pmr 컨테이너에 넘길 memory_resource를 반환합니다.
+	 * @return 현재 프레임 버퍼에서 할당하는 memory_resource.
+	 */
+	std::pmr::memory_resource *getResource();
+
+	/**
+	 * @brief 마지막으로 끝난 프레임의 통계를 반환합니다.
+	 * @return 사용량, 할당 횟수, 힙 할당 횟수.
+	 */
+	const FrameAllocatorStats &getStats() const;
+
+  private:
+	/**
+	 * @class Resource
+	 * @brief FrameAllocator에서 할당하는 std::pmr::memory_resource.
+	 */
+	class Resource : public std::pmr::memory_resource
+	{
+	  public:
+		explicit Resource(FrameAllocator *allocator);
+
+	  private:
+		void *do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+		FrameAllocator *m_allocator;
+	};
+
+	/**
+	 * @struct FrameBuffer
+	 * @brief 한 프레임 동안 할당하는 버퍼와 버퍼 밖에서 할당한 메모리 목록.
+	 */
+	struct FrameBuffer
+	{
+		char *data;										 /**< 버퍼 메모리 */
+		size_t capacity;								 /**< 버퍼 크기 */
+		size_t offset;									 /**< 다음 할당 위치 */
+		size_t overflowBytes;							 /**< 힙에서 할당한 바이트 수 */
+		int32_t allocationCount;						 /**< 할당 횟수 */
+		std::vector<std::pair<void *, size_t>> overflow; /**< 힙에서 할당한 메모리와 정렬 단위 */
+	};
+
+	/**
+	 * @brief 버퍼를 비우고 힙에서 할당한 메모리를 해제합니다.
+	 * @details 힙 할당이 있었다면 그 프레임의 사용량을 담을 수 있게 버퍼를 다시 만듭니다.
+	 * @param buffer 비울 버퍼.
+	 */
+	void resetBuffer(FrameBuffer &buffer);
+
+	FrameBuffer m_buffers[FRAME_BUFFER_COUNT];
+	int32_t m_current; /**< 이번 프레임에 사용하는 버퍼 인덱스 */
+	size_t m_capacity; /**< 새로 만드는 버퍼 크기 */
+	Resource m_resource;
+	FrameAllocatorStats m_stats;
+	uint64_t m_frameHeapAllocations; /**< 프레임 시작 시점의 힙 할당 횟수 */
+};
+} // namespace ale
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace ale
+{
+
+/**
+ * @file
+ * @brief 서브시스템별 메모리 사용량과 예산을 추적하는 MemoryTracker 클래스 정의.
+ */
+
+/**
+ * @enum MemoryTag
+ * @brief 메모리 사용량을 집계하는 서브시스템 구분.
+ */
+enum class MemoryTag : uint8_t
+{
+	Physics = 0, /**< 물리 할당자 */
+	Renderer,	 /**< Vulkan 디바이스 메모리 */
+	Assets,		 /**< 모델, 텍스처 import 중 사용하는 메모리 */
+	Scripting,	 /**< Mono GC 힙 */
+	Scene,		 /**< 씬 컨테이너 */
+	Count
+};
+
+const int32_t MEMORY_TAG_COUNT = static_cast<int32_t>(MemoryTag::Count); /**< 태그 개수 */
+
+/**
+ * @struct MemoryTagStats
+ * @brief 태그 하나의 메모리 사용량 통계.
+ */
+struct MemoryTagStats
+{
+	int64_t currentBytes;	  /**< 현재 사용 중인 바이트 수 (외부 힙 포함) */
+	int64_t peakBytes;		  /**< 최대 사용 바이트 수 */
+	int64_t externalBytes;	  /**< 직접 할당하지 않고 샘플링한 외부 힙 바이트 수 */
+	int64_t budgetBytes;	  /**< 예산 (0이면 제한 없음) */
+	int32_t liveAllocations;  /**< 해제되지 않은 할당 개수 */
+	int32_t frameAllocations; /**< 지난 프레임의 할당 횟수 */
+};
+
+/**
+ * @class MemoryTracker
+ * @brief 태그별 할당, 해제를 기록하고 예산 초과를 경고하는 클래스.
+ * @details 할당과 해제 기록은 여러 스레드에서 호출할 수 있습니다. 예산 설정, 프레임 시작, 통계 조회는 메인
+ *          스레드에서 호출합니다. Mono GC 힙처럼 직접 할당을 기록할 수 없는 메모리는 setExternalBytes로 사용량을
+ *          샘플링합니다.
+ */
+class MemoryTracker
+{
+  public:
+	/**
+	 * @brief 할당을 기록합니다.
+	 * @param tag 할당한 서브시스템.
+	 * @param size 할당한 바이트 수.
+	 */
+	static void recordAllocation(MemoryTag tag, int64_t size);
+
+	/**
+	 * @brief 해제를 기록합니다.
+	 * @param tag 할당한 서브시스템.
+	 * @param size 해제한 바이트 수.
+	 */
+	static void recordFree(MemoryTag tag, int64_t size);
+
+	/**
+	 * @brief 외부 힙의 현재 사용량을 설정합니다.
+	 * @param tag 외부 힙을 사용하는 서브시스템.
+	 * @param size 현재 사용 중인 바이트 수.
+	 */
+	static void setExternalBytes(MemoryTag tag, int64_t size);
+
+	/**
+	 * @brief 태그의 메모리 예산을 설정합니다.
+	 * @param tag 예산을 설정할 서브시스템.
+	 * @param size 예산 바이트 수 (0이면 제한 없음).
+	 */
+	static void setBudget(MemoryTag tag, int64_t size);
+
+	/**
+	 * @brief 새 프레임을 시작합니다.
+	 * @details 끝난 프레임의 태그별 할당 횟수를 저장하고, 예산을 넘은 태그는 넘는 순간 한 번 경고합니다.
+	 */
+	static void beginFrame();
+
+	/**
+	 * @brief 태그의 통계를 반환합니다.
+	 * @param tag 조회할 서브시스템.
+	 * @return 현재, 최대 사용량과 예산, 할당 횟수.
+	 */
+	static MemoryTagStats getStats(MemoryTag tag);
+
+	/**
+	 * @brief 모든 태그의 최대 사용량을 현재 사용량으로 초기화합니다.
+	 */
+	static void resetPeaks();
+
+	/**
+	 * @brief 모든 태그의 통계를 로그로 출력합니다.
+	 */
+	static void logStats();
+
+	/**
+	 * @brief 태그 이름을 반환합니다.
+	 * @param tag 서브시스템.
+	 * @return 태그 이름.
+	 */
+	static const char *getTagName(MemoryTag tag);
+
+  private:
+	/**
+	 * @brief 현재 사용량으로 최대 사용량을 갱신합니다.
+	 * @param index 태그 인덱스.
+	 */
+	static void updatePeak(int32_t index);
+
+	static std::atomic<int64_t> s_trackedBytes[MEMORY_TAG_COUNT];  /**< 기록된 할당의 바이트 수 */
+	static std::atomic<int64_t> s_externalBytes[MEMORY_TAG_COUNT]; /**< 샘플링한 외부 힙 바이트 수 */
+	static std::atomic<int64_t> s_peakBytes[MEMORY_TAG_COUNT];
+	static std::atomic<int32_t> s_liveAllocations[MEMORY_TAG_COUNT];
+	static std::atomic<int64_t> s_allocationCounts[MEMORY_TAG_COUNT]; /**< 프로그램 시작 후 할당 횟수 */
+	static int64_t s_frameStartCounts[MEMORY_TAG_COUNT];			  /**< 프레임 시작 시점의 할당 횟수 */
+	static int32_t s_frameAllocations[MEMORY_TAG_COUNT];
+	static int64_t s_budgets[MEMORY_TAG_COUNT];
+	static bool s_overBudget[MEMORY_TAG_COUNT]; /**< 예산 초과 경고를 이미 출력했는지 여부 */
+};
+
+/**
+ * @class ScopedMemoryRecord
+ * @brief 생성할 때 할당을, 소멸할 때 해제를 MemoryTracker에 기록하는 클래스.
+ * @details 직접 할당하지 않는 라이브러리 메모리처럼 스코프 동안만 유지되는 사용량을 기록합니다. 예외로 스코프를
+ *          벗어나도 해제가 기록됩니다.
+ */
+class ScopedMemoryRecord
+{
+  public:
+	/**
+	 * @brief 할당을 기록합니다.
+	 * @param tag 할당한 서브시스템.
+	 * @param size 할당한 바이트 수.
+	 */
+	ScopedMemoryRecord(MemoryTag tag, int64_t size) : m_tag(tag), m_size(size)
+	{
+		MemoryTracker::recordAllocation(m_tag, m_size);
+	}
+
+	/**
+	 * @brief 생성할 때 기록한 크기만큼 해제를 기록합니다.
+	 */
+	~ScopedMemoryRecord()
+	{
+		MemoryTracker::recordFree(m_tag, m_size);
+	}
+
+	ScopedMemoryRecord(const ScopedMemoryRecord &) = delete;
+	ScopedMemoryRecord &operator=(const ScopedMemoryRecord &) = delete;
+
+  private:
+	MemoryTag m_tag;
+	int64_t m_size;
+};
+
+/**
+ * @class TrackedAllocator
+ * @brief 할당과 해제를 MemoryTracker에 기록하는 STL 할당자.
+ * @tparam T 할당할 원소 타입.
+ * @tparam Tag 할당을 집계할 서브시스템.
+ */
+template <typename T, MemoryTag Tag> class TrackedAllocator
+{
+  public:
+	using value_type = T;
+
+	template <typename U> struct rebind
+	{
+		using other = TrackedAllocator<U, Tag>;
+	};
+
+	TrackedAllocator() noexcept = default;
+
+	template <typename U> TrackedAllocator(const TrackedAllocator<U, Tag> &) noexcept
+	{
+	}
+
+	T *allocate(size_t count)
+	{
+		// 기본 정렬보다 큰 정렬이 필요한 타입은 정렬 버전 operator new로 할당
+		void *pointer;
+		if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			pointer = ::operator new(count * sizeof(T), std::align_val_t(alignof(T)));
+		}
+		else
+		{
+			pointer = ::operator new(count * sizeof(T));
+		}
+		MemoryTracker::recordAllocation(Tag, static_cast<int64_t>(count * sizeof(T)));
+		return static_cast<T *>(pointer);
+	}
+
+	void deallocate(T *pointer, size_t count) noexcept
+	{
+		MemoryTracker::recordFree(Tag, static_cast<int64_t>(count * sizeof(T)));
+		if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			::operator delete(pointer, std::align_val_t(alignof(T)));
+		}
+		else
+		{
+			::operator delete(pointer);
+		}
+	}
+
+	template <typename U> bool operator==(const TrackedAllocator<U, Tag> &) const noexcept
+	{
+		return true;
+	}
+
+	template <typename U> bool operator!=(const TrackedAllocator<U, Tag> &) const noexcept
+	{
+		return false;
+	}
+};
+} // namespace ale
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "Memory/MemoryTracker.h"
+
 #include <cstdint>
+#include <vector>
 
 namespace ale
 {
@@ -10,8 +13,9 @@ namespace ale
  * @brief 스택 기반 메모리 할당을 관리하는 StackAllocator 클래스 정의.
  */
 
-const int32_t STACK_SIZE = 10 * 1024 * 1024; /**< 스택 크기 (10MB) */
-const int32_t MAX_STACK_ENTRY_SIZE = 32;	 /**< 최대 스택 항목 개수 */
+const int32_t STACK_SIZE = 10 * 1024 * 1024; /**< 기본 첫 블록 크기 (10MB) */
+const int32_t STACK_ENTRY_RESERVE = 32;		 /**< 미리 예약하는 스택 항목 개수 */
+const int32_t STACK_ALIGNMENT = 16;			 /**< 할당 정렬 단위 */
 
 /**
  * @struct StackEntry
@@ -19,26 +23,58 @@ const int32_t MAX_STACK_ENTRY_SIZE = 32;	 /**< 최대 스택 항목 개수 */
  */
 struct StackEntry
 {
-	char *data;	  /**< 할당된 데이터의 시작 주소 */
-	int32_t size; /**< 데이터 크기 (바이트 단위) */
+	char *data;			/**< 할당된 데이터의 시작 주소 */
+	int32_t size;		/**< 데이터 크기 (바이트 단위) */
+	int32_t blockIndex;	/**< 데이터가 속한 블록 인덱스 */
+};
+
+/**
+ * @struct StackBlock
+ * @brief StackAllocator가 연결해 사용하는 메모리 블록.
+ */
+struct StackBlock
+{
+	char *data;	  /**< 블록 메모리 */
+	int32_t size; /**< 블록 크기 (바이트 단위) */
+	int32_t used; /**< 사용 중인 크기 (바이트 단위) */
+};
+
+/**
+ * @struct StackAllocatorStats
+ * @brief StackAllocator의 사용량 통계.
+ */
+struct StackAllocatorStats
+{
+	int32_t capacity;	   /**< 할당된 블록 크기 합 */
+	int32_t highWater;	   /**< 동시에 사용한 최대 바이트 수 */
+	int32_t overflowCount; /**< 블록이 부족해 새 블록을 이어 붙인 횟수 */
 };
 
 /**
  * @class StackAllocator
  * @brief 스택 기반 메모리 할당을 수행하는 클래스.
+ * @details 현재 블록이 부족하면 새 블록을 이어 붙여 할당을 계속하고, 모든 항목이 해제되면 블록들을 전체 크기의
+ *          블록 하나로 합쳐 다음 사용부터는 연속된 메모리에서 할당합니다. 스레드 안전하지 않으므로 스레드마다
+ *          별도의 인스턴스를 사용합니다.
  */
 class StackAllocator
 {
   public:
 	/**
 	 * @brief 생성자.
+	 * @details 첫 블록은 처음 할당할 때 만듭니다.
+	 * @param tag 블록 메모리를 집계할 서브시스템.
+	 * @param initialSize 첫 블록 크기 (바이트 단위).
 	 */
-	StackAllocator();
+	explicit StackAllocator(MemoryTag tag, int32_t initialSize = STACK_SIZE);
 	/**
 	 * @brief 소멸자.
 	 */
 	~StackAllocator();
 
+	StackAllocator(const StackAllocator &) = delete;
+	StackAllocator &operator=(const StackAllocator &) = delete;
+
 	/**
 	 * @brief 지정된 크기의 메모리를 스택에서 할당합니다.
 	 * @param size 할당할 메모리 크기 (바이트 단위).
@@ -51,11 +87,37 @@ class StackAllocator
 	 */
 	void freeStack();
 
+	/**
+	 * @brief 사용량 통계를 반환합니다.
+	 * @return 블록 크기 합, 최대 사용량, 블록 추가 횟수.
+	 */
+	const StackAllocatorStats &getStats() const;
+
+	/**
+	 * @brief 최대 사용량을 현재 사용량으로, 블록 추가 횟수를 0으로 초기화합니다.
+	 */
+	void resetStats();
+
   private:
-	alignas(16) char m_data[STACK_SIZE];
-	int32_t m_index;
+	/**
+	 * @brief 현재 블록 뒤에 새 블록을 추가합니다.
+	 * @details 현재 블록 뒤의 블록은 항상 비어 있으므로 모두 해제하고 새로 만듭니다.
+	 * @param size 새 블록 크기 (바이트 단위).
+	 */
+	void addBlock(int32_t size);
+
+	/**
+	 * @brief 비어 있는 블록들을 전체 크기의 블록 하나로 합칩니다.
+	 */
+	void mergeBlocks();
+
+	std::vector<StackBlock> m_blocks;
+	int32_t m_blockIndex; /**< 할당 중인 블록 인덱스 */
+	int32_t m_initialSize;
+	MemoryTag m_tag;	  /**< 블록 메모리를 집계할 서브시스템 */
+	int32_t m_allocation; /**< 사용 중인 바이트 수 */
 
-	StackEntry m_entries[MAX_STACK_ENTRY_SIZE]; /**< 스택 할당 항목 목록 */
-	int32_t m_entryCount;						/**< 현재 스택 항목 개수 */
+	std::vector<StackEntry> m_entries; /**< 스택 할당 항목 목록 */
+	StackAllocatorStats m_stats;
 };
-} // namespace ale
\ No newline at end of file
+} // namespace ale
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Physics/Collision.h"
+
+#include <vector>
+
+namespace ale
+{
+/**
+ * @file
+ * @brief World가 소유하는 Rigidbody 시뮬레이션 상태 배열(SoA) 정의.
+ */
+
+/**
+ * @struct BodyData
+ * @brief 적분과 solve에서 매 step 접근하는 Rigidbody 상태를 필드별 배열로 저장하는 구조체.
+ * @details 인덱스는 World의 dense body 배열 인덱스와 같습니다. body가 제거되면 마지막 원소로 빈 자리를 채우고
+ *          옮겨진 Rigidbody의 인덱스는 World가 갱신합니다. 외력 목록, Fixture 같은 자주 쓰지 않는 데이터는
+ *          Rigidbody 객체에 남습니다.
+ */
+struct BodyData
+{
+	/**
+	 * @brief 기본값을 가진 body 상태를 배열 끝에 추가합니다.
+	 * @return 추가된 상태의 인덱스.
+	 */
+	int32_t push();
+
+	/**
+	 * @brief 상태를 제거하고 마지막 상태를 그 자리로 옮깁니다.
+	 * @param index 제거할 인덱스.
+	 */
+	void remove(int32_t index);
+
+	/**
+	 * @brief 저장된 body 상태 개수를 반환합니다.
+	 * @return 상태 개수.
+	 */
+	int32_t getCount() const;
+
+	/**
+	 * @brief 누적된 힘과 토크로 속도와 Transform을 적분합니다.
+	 * @details 깨어 있고 움직일 수 있는 body만 적분하며, 적분 후 파생 데이터 계산과 누적값 초기화까지 수행합니다.
+	 * @param duration 시뮬레이션 시간 간격.
+	 */
+	void integrate(float duration);
+
+	/**
+	 * @brief 한 body의 상태를 적분합니다.
+	 * @param index 적분할 인덱스.
+	 * @param duration 시뮬레이션 시간 간격.
+	 */
+	void integrate(int32_t index, float duration);
+
+	/**
+	 * @brief 모든 body의 변환 행렬과 world 역관성 텐서를 계산합니다.
+	 */
+	void calculateDerivedData();
+
+	/**
+	 * @brief 한 body의 변환 행렬과 world 역관성 텐서를 계산합니다.
+	 * @param index 계산할 인덱스.
+	 */
+	void calculateDerivedData(int32_t index);
+
+	/**
+	 * @brief 모든 body의 힘과 토크 누적값을 초기화합니다.
+	 */
+	void clearAccumulators();
+
+	std::vector<Transform> transforms;
+	std::vector<Sweep> sweeps;
+	std::vector<alglm::vec3> linearVelocities;
+	std::vector<alglm::vec3> angularVelocities;
+	std::vector<alglm::vec3> accelerations;
+	std::vector<alglm::vec3> forceAccums;
+	std::vector<alglm::vec3> torqueAccums;
+	std::vector<alglm::mat4> transformMatrices;
+	std::vector<alglm::mat3> inverseInertiaTensors;
+	std::vector<alglm::mat3> inverseInertiaTensorWorlds;
+	std::vector<float> inverseMasses;
+	std::vector<float> linearDampings;
+	std::vector<float> angularDampings;
+	std::vector<float> gravities; /**< 중력 가속도 크기 (중력을 받지 않으면 0) */
+	std::vector<alglm::vec3> posFreezes;
+	std::vector<alglm::vec3> rotFreezes;
+	std::vector<uint8_t> awakeFlags;   /**< 깨어 있으면 1 */
+	std::vector<uint8_t> movableFlags; /**< static이 아니고 Fixture가 있어 적분 대상이면 1 */
+};
+} // namespace ale
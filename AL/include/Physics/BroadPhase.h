@@ -2,8 +2,7 @@
 
 #include "Physics/DynamicTree.h"
 
-#include <set>
-#include <utility>
+#include <vector>
 
 namespace ale
 {
@@ -38,23 +37,46 @@ class BroadPhase
 	 * @brief AABB를 기반으로 Proxy를 생성합니다.
 	 * @param aabb Proxy를 생성할 AABB 영역.
 	 * @param userData 사용자 데이터 포인터.
+	 * @param filter Proxy의 충돌 필터. 필터를 통과하지 못하는 Pair는 트리 탐색 중에 버려집니다.
+	 * @param margin Fat AABB에 더할 여백.
 	 * @return 생성된 Proxy의 ID (nodeId).
 	 */
-	int32_t createProxy(const AABB &aabb, void *userData);
+	int32_t createProxy(const AABB &aabb, void *userData, const CollisionFilter &filter, float margin);
 
 	/**
 	 * @brief Proxy를 제거합니다.
+	 * @details 트리에서 leaf를 제거하고, 이번 step에 버퍼링된 이동도 취소합니다.
 	 * @param proxyId 제거할 Proxy의 ID.
 	 */
 	void destroyProxy(int32_t proxyId);
 
 	/**
 	 * @brief Proxy를 이동시킵니다.
+	 * @details AABB가 기존 Fat AABB를 벗어나면 여백과 이동 예측을 더한 Fat AABB로 트리에 다시 삽입합니다.
 	 * @param proxyId 이동할 Proxy의 ID.
 	 * @param aabb 새로운 AABB 영역.
 	 * @param displacement 이동 벡터.
+	 * @param margin Fat AABB에 더할 여백.
+	 * @param predictionFactor 이동 방향으로 Fat AABB를 늘릴 이동 벡터의 배수.
 	 */
-	void moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement);
+	void moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement, float margin,
+				   float predictionFactor);
+
+	/**
+	 * @brief Proxy의 Fat AABB를 그대로 지정합니다.
+	 * @details 스냅샷 복원에 사용합니다. Move buffer는 바꾸지 않습니다.
+	 * @param proxyId 변경할 Proxy의 ID.
+	 * @param fatAABB 지정할 Fat AABB.
+	 */
+	void setFatAABB(int32_t proxyId, const AABB &fatAABB);
+
+	/**
+	 * @brief Proxy의 충돌 필터를 변경합니다.
+	 * @details 새로 충돌 가능해진 Pair를 찾을 수 있도록 Proxy를 move buffer에 추가합니다.
+	 * @param proxyId 변경할 Proxy의 ID.
+	 * @param filter 새로운 충돌 필터.
+	 */
+	void setFilter(int32_t proxyId, const CollisionFilter &filter);
 
 	/**
 	 * @brief Proxy의 이동을 버퍼링합니다.
@@ -62,6 +84,30 @@ class BroadPhase
 	 */
 	void bufferMove(int32_t proxyId);
 
+	/**
+	 * @brief 버퍼링된 Proxy의 이동을 취소합니다.
+	 * @param proxyId 취소할 Proxy의 ID.
+	 */
+	void unbufferMove(int32_t proxyId);
+
+	/**
+	 * @brief 다음 updatePairs에서 쿼리할 Proxy 개수를 반환합니다.
+	 * @return Move buffer에 들어 있는 Proxy 개수.
+	 */
+	int32_t getMoveCount() const;
+
+	/**
+	 * @brief 다음 updatePairs에서 쿼리할 Proxy ID 배열을 반환합니다.
+	 * @return Move buffer의 시작 포인터. 제거된 Proxy는 NULL_PROXY입니다.
+	 */
+	const int32_t *getMoveBuffer() const;
+
+	/**
+	 * @brief Move buffer를 비웁니다.
+	 * @details 스냅샷 복원에 사용하며, 이후 bufferMove로 저장된 Proxy를 다시 채웁니다.
+	 */
+	void clearMoveBuffer();
+
 	/**
 	 * @brief 충돌 후보 쌍을 갱신합니다.
 	 * @tparam T 콜백 함수 타입.
@@ -77,6 +123,82 @@ class BroadPhase
 	 */
 	template <typename T> void query(T *callback, const AABB &aabb) const;
 
+	/**
+	 * @brief 선분(또는 이동하는 구)과 겹치는 후보를 탐색합니다.
+	 * @tparam T 콜백 함수 타입. float rayCastCallback(const RayCastInput &, int32_t proxyId)를 제공해야 합니다.
+	 * @param callback 검색된 후보를 처리할 콜백 함수.
+	 * @param input Ray cast 입력 정보.
+	 */
+	template <typename T> void rayCast(T *callback, const RayCastInput &input) const;
+
+	/**
+	 * @brief Proxy의 사용자 데이터를 반환합니다.
+	 * @param proxyId 조회할 Proxy ID.
+	 * @return 사용자 데이터 포인터 (FixtureProxy).
+	 */
+	void *getUserData(int32_t proxyId) const;
+
+	/**
+	 * @brief Proxy의 Fat AABB를 반환합니다.
+	 * @param proxyId 조회할 Proxy ID.
+	 * @return Fat AABB.
+	 */
+	const AABB &getFatAABB(int32_t proxyId) const;
+
+	/**
+	 * @brief 두 Proxy의 Fat AABB가 겹치는지 확인합니다.
+	 * @param proxyIdA 첫 번째 Proxy ID.
+	 * @param proxyIdB 두 번째 Proxy ID.
+	 * @return 겹치면 true, 아니면 false.
+	 */
+	bool testOverlap(int32_t proxyIdA, int32_t proxyIdB) const;
+
+	/**
+	 * @brief 쿼리용 SIMD 트리를 필요하면 최신 상태로 갱신합니다.
+	 * @details 갱신하지 않아도 query는 동작하지만, 이진 트리를 순회하는 느린 경로를 사용합니다. 트리가 바뀐 뒤 쿼리가
+	 *          충분히 쌓였을 때만 다시 만듭니다.
+	 * @param queryCount 다음 트리 변경 전까지 실행할 쿼리 횟수.
+	 */
+	void updateQueryTree(int32_t queryCount);
+
+	/**
+	 * @brief 마지막 updatePairs에서 콜백으로 넘긴 중복 없는 Pair 개수를 반환합니다.
+	 * @return 후보 Pair 개수.
+	 */
+	int32_t getPairCount() const;
+
+	/**
+	 * @brief resetReinsertCount 이후 Fat AABB를 벗어나 트리에 다시 삽입된 Proxy 개수를 반환합니다.
+	 * @return 재삽입 횟수.
+	 */
+	int32_t getReinsertCount() const;
+
+	/** @brief 재삽입 횟수를 0으로 초기화합니다. */
+	void resetReinsertCount();
+
+	/**
+	 * @brief 트리 품질 유지 정책을 설정합니다.
+	 * @details 매 updatePairs마다 rotationBudget개의 내부 노드에 회전을 시도하고, 일정 주기로 표면적 비율을 검사해
+	 *          마지막 SAH 재구성 직후 비율의 rebuildAreaRatio배를 넘으면 트리 전체를 다시 만듭니다. SAH 트리의
+	 *          표면적 비율도 Proxy 개수에 따라 커지므로 재구성 직후 값을 기준으로 비교합니다. 아직 재구성한 적이
+	 *          없으면 첫 검사에서 다시 만듭니다. 0 이하이면 해당 기능을 끕니다.
+	 * @param rotationBudget updatePairs 한 번에 회전을 시도할 내부 노드 수.
+	 * @param rebuildAreaRatio 전체 재구성을 시작할, 재구성 직후 표면적 비율에 대한 배율 (1보다 커야 함).
+	 */
+	void setTreeOptimization(int32_t rotationBudget, float rebuildAreaRatio);
+
+	/**
+	 * @brief 트리의 품질 지표를 계산합니다.
+	 * @return 표면적 비율, 높이, 리프 개수.
+	 */
+	TreeQuality getTreeQuality() const;
+
+	/**
+	 * @brief 트리 전체를 SAH로 다시 만듭니다.
+	 * @details 대량의 Proxy를 생성한 직후처럼 삽입 순서로 트리 품질이 나빠진 경우에 호출합니다.
+	 */
+	void rebuildTree();
+
   private:
 	/**
 	 * @brief BroadPhase의 내부 탐색을 위한 friend class 선언.
@@ -90,18 +212,47 @@ class BroadPhase
 	 */
 	bool queryCallback(int32_t proxyId);
 
+	/**
+	 * @brief Pair 버퍼를 기수 정렬(radix sort)합니다.
+	 * @details 정렬 후 같은 Pair는 연속해서 위치하므로 한 번의 순회로 중복을 제거할 수 있습니다.
+	 */
+	void sortPairs();
+
+	/**
+	 * @brief 설정된 정책에 따라 트리 회전과 주기적인 재구성을 수행합니다.
+	 */
+	void optimizeTree();
+
 	DynamicTree m_tree;
-	std::set<std::pair<int32_t, int32_t>> m_proxySet;
+	std::vector<uint64_t> m_pairBuffer;		/**< (작은 ID << 32 | 큰 ID) 형태의 후보 Pair 키 */
+	std::vector<uint64_t> m_pairSortBuffer; /**< 기수 정렬용 임시 버퍼 */
 	std::vector<int32_t> m_moveBuffer;
 
 	int32_t m_moveCapacity;
 	int32_t m_moveCount;
 	int32_t m_queryProxyId;
+	CollisionFilter m_queryFilter;
+	int32_t m_pairCount;
+	int32_t m_reinsertCount;
+
+	int32_t m_rotationBudget;
+	float m_rebuildAreaRatio;
+	float m_rebuiltAreaRatio; /**< 마지막 SAH 재구성 직후의 표면적 비율 */
+	int32_t m_qualityCheckCounter;
+
+	static const int32_t QUALITY_CHECK_INTERVAL; /**< 표면적 비율을 검사하는 updatePairs 호출 간격 */
 };
 
 
 template <typename T> void BroadPhase::updatePairs(T *callback)
 {
+	// 이전 step의 Pair는 버리고 용량만 재사용
+	m_pairBuffer.clear();
+
+	// 이번 step의 이동이 모두 반영된 트리를 정리한 뒤 쿼리용 4갈래 트리 갱신
+	optimizeTree();
+	m_tree.updateWideTree(m_moveCount);
+
 	for (int32_t i = 0; i < m_moveCount; ++i)
 	{
 		m_queryProxyId = m_moveBuffer[i];
@@ -111,29 +262,42 @@ template <typename T> void BroadPhase::updatePairs(T *callback)
 		}
 
 		const AABB &fatAABB = m_tree.getFatAABB(m_queryProxyId);
+		m_queryFilter = m_tree.getFilter(m_queryProxyId);
 
 		m_tree.query(this, fatAABB);
 	}
 
 	m_moveCount = 0;
-	for (auto &it = m_proxySet.begin(); it != m_proxySet.end();)
+
+	sortPairs();
+
+	// 정렬된 버퍼에서 연속된 중복 Pair는 건너뛰며 콜백 호출
+	size_t pairCount = m_pairBuffer.size();
+	size_t i = 0;
+	m_pairCount = 0;
+	while (i < pairCount)
 	{
-		auto primaryPair = it;
-		void *userDataA = m_tree.getUserData(primaryPair->first);
-		void *userDataB = m_tree.getUserData(primaryPair->second);
+		uint64_t primaryPair = m_pairBuffer[i];
+		void *userDataA = m_tree.getUserData(static_cast<int32_t>(primaryPair >> 32));
+		void *userDataB = m_tree.getUserData(static_cast<int32_t>(primaryPair & 0xFFFFFFFF));
 
 		callback->addPair(userDataA, userDataB);
-		++it;
-		while (it != m_proxySet.end())
+		++m_pairCount;
+		++i;
+		while (i < pairCount && m_pairBuffer[i] == primaryPair)
 		{
-			auto pair = it;
-
-			if (pair->first != primaryPair->first || pair->second != primaryPair->second)
-			{
-				break;
-			}
-			++it;
+			++i;
 		}
 	}
 }
+
+template <typename T> inline void BroadPhase::query(T *callback, const AABB &aabb) const
+{
+	m_tree.query(callback, aabb);
+}
+
+template <typename T> inline void BroadPhase::rayCast(T *callback, const RayCastInput &input) const
+{
+	m_tree.rayCast(callback, input);
+}
 } // namespace ale
\ No newline at end of file
@@ -94,6 +94,30 @@ struct AABB
 	alglm::vec3 upperBound;
 };
 
+/**
+ * @struct RayCastInput
+ * @brief Ray cast 입력 정보를 저장하는 구조체.
+ * @details p1에서 p1 + maxFraction * (p2 - p1)까지의 선분을 검사합니다. radius가 0보다 크면 해당 반지름의 구를
+ *          이동시키며 검사합니다(sphere cast).
+ */
+struct RayCastInput
+{
+	alglm::vec3 p1;	   /**< 시작점 */
+	alglm::vec3 p2;	   /**< 끝점 */
+	float maxFraction; /**< 검사할 최대 비율 (p2까지는 1) */
+	float radius;	   /**< 이동시킬 구의 반지름 (ray는 0) */
+};
+
+/**
+ * @struct RayCastOutput
+ * @brief Ray cast 결과를 저장하는 구조체.
+ */
+struct RayCastOutput
+{
+	alglm::vec3 normal; /**< 충돌 지점의 표면 법선 */
+	float fraction;		/**< 충돌 지점까지의 비율 (p1 + fraction * (p2 - p1)) */
+};
+
 /**
  * @struct Transform
  * @brief 물체의 위치(Position)와 회전(Rotation)을 나타내는 구조체.
@@ -141,6 +165,23 @@ struct Transform
 		return translationMatrix * rotationMatrix;
 	}
 
+	/**
+	 * @brief 회전 쿼터니언을 3x3 회전 행렬로 변환합니다.
+	 * @details 4x4 행렬을 거치지 않고 쿼터니언 성분에서 바로 계산합니다.
+	 * @return 회전 행렬.
+	 */
+	alglm::mat3 toRotationMatrix() const
+	{
+		alglm::quat q = alglm::normalize(orientation);
+		float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+		return alglm::mat3(alglm::vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)),
+						   alglm::vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)),
+						   alglm::vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)));
+	}
+
 	alglm::vec3 position;
 	alglm::quat orientation;
 };
@@ -176,18 +217,64 @@ inline bool testOverlap(const AABB &a, const AABB &b)
 	return true;
 }
 
+/**
+ * @struct CollisionFilter
+ * @brief Fixture 간 충돌 여부를 결정하는 필터.
+ * @details 같은 0이 아닌 groupIndex를 가지면 양수일 때 항상 충돌하고 음수일 때 충돌하지 않습니다.
+ *          그 외에는 서로의 maskBits가 상대의 categoryBits를 포함해야 충돌합니다.
+ */
+struct CollisionFilter
+{
+	uint32_t categoryBits = 0x00000001; /**< 이 Fixture가 속한 충돌 레이어 비트 */
+	uint32_t maskBits = 0xFFFFFFFF;		/**< 충돌할 상대 레이어 비트 */
+	int32_t groupIndex = 0;				/**< 충돌 그룹 (0이면 사용하지 않음) */
+};
+
+/**
+ * @brief 두 필터를 가진 Fixture가 충돌할 수 있는지 검사합니다.
+ * @param a 첫 번째 필터.
+ * @param b 두 번째 필터.
+ * @return 충돌할 수 있으면 true, 그렇지 않으면 false.
+ */
+inline bool testFilter(const CollisionFilter &a, const CollisionFilter &b)
+{
+	if (a.groupIndex == b.groupIndex && a.groupIndex != 0)
+	{
+		return a.groupIndex > 0;
+	}
+
+	return (a.maskBits & b.categoryBits) != 0 && (b.maskBits & a.categoryBits) != 0;
+}
+
+/**
+ * @struct ConvexInfo
+ * @brief 볼록 다면체(Convex Shape) 정보를 저장하는 구조체.
+ */
+struct ConvexInfo
+{
+	alglm::vec3 *points{nullptr};
+	alglm::vec3 *axes{nullptr};
+	int32_t pointsCount;
+	int32_t axesCount;
+	alglm::vec3 halfSize;
+	alglm::vec3 center;
+	float radius;
+	float height;
+};
+
 /**
  * @struct ManifoldPoint
  * @brief 충돌 지점(Contact Point)의 정보를 저장하는 구조체.
  */
 struct ManifoldPoint
 {
-	float normalImpulse;  // 법선 방향 충격량
-	float tangentImpulse; // 접촉면 충격량
-	float seperation;	  // 관통 깊이
-	alglm::vec3 pointA;	  // 충돌 지점의 위치
-	alglm::vec3 pointB;	  // 충돌 지점의 위치
-	alglm::vec3 normal;	  // 법선 벡터
+	float normalImpulse;		// 법선 방향 누적 충격량
+	alglm::vec3 tangentImpulse; // 접촉면 방향 누적 충격량
+	float seperation;			// 관통 깊이
+	alglm::vec3 pointA;			// 충돌 지점의 위치
+	alglm::vec3 pointB;			// 충돌 지점의 위치
+	alglm::vec3 normal;			// 법선 벡터
+	alglm::vec3 localPoint;		// bodyA 로컬 좌표계의 충돌 지점 (이전 프레임 충돌점과 매칭하는 ID)
 };
 
 const int32_t MAX_MANIFOLD_COUNT = 40;
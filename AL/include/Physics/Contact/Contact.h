@@ -2,6 +2,7 @@
 
 #include "Physics/Fixture.h"
 #include "Physics/PhysicsAllocator.h"
+#include "Physics/PhysicsStats.h"
 
 #include <cmath>
 
@@ -108,22 +109,7 @@ struct SimplexArray
 {
 	Simplex simplices[MAX_SIMPLEX_COUNT];
 	int32_t simplexCount;
-};
-
-/**
- * @struct ConvexInfo
- * @brief 볼록 다면체(Convex Shape) 정보를 저장하는 구조체.
- */
-struct ConvexInfo
-{
-	alglm::vec3 *points{nullptr};
-	alglm::vec3 *axes{nullptr};
-	int32_t pointsCount;
-	int32_t axesCount;
-	alglm::vec3 halfSize;
-	alglm::vec3 center;
-	float radius;
-	float height;
+	int32_t iterationCount; // GJK 반복 횟수
 };
 
 /**
@@ -134,6 +120,7 @@ struct EpaInfo
 {
 	alglm::vec3 normal;
 	float distance;
+	int32_t faceCount; // 종료 시 polytope의 면 개수
 };
 
 class Contact;
@@ -169,6 +156,7 @@ enum class EContactFlag
 {
 	ISLAND = (1 << 0),
 	TOUCHING = (1 << 2),
+	FILTER = (1 << 3), // Fixture 필터가 바뀌어 다음 collide에서 다시 검사해야 함
 };
 
 /**
@@ -208,6 +196,14 @@ class Contact
 	 */
 	static Contact *create(Fixture *fixtureA, Fixture *fixtureB, int32_t indexA, int32_t indexB);
 
+	/**
+	 * @brief Contact 객체를 소멸시키고 메모리를 반환하는 정적 함수.
+	 * @details 센서 충돌 중이던 Contact는 두 Fixture의 touchNum을 되돌립니다. World 리스트와 Body의 ContactLink에서
+	 *          분리하는 작업은 ContactManager::destroy에서 수행합니다.
+	 * @param contact 소멸시킬 Contact.
+	 */
+	static void destroy(Contact *contact);
+
 	/**
 	 * @brief Contact 생성자.
 	 * @param fixtureA 첫 번째 개체의 Fixture.
@@ -219,8 +215,9 @@ class Contact
 
 	/**
 	 * @brief 충돌 정보를 업데이트합니다.
+	 * @param stats GJK 반복 횟수와 EPA 면 개수를 누적할 통계.
 	 */
-	void update();
+	void update(PhysicsStats &stats);
 
 	/**
 	 * @brief 충돌 평가를 수행합니다.
@@ -228,8 +225,10 @@ class Contact
 	 * @param transformA 첫 번째 개체의 변환 정보.
 	 * @param transformB 두 번째 개체의 변환 정보.
 	 * @param isSensor 센서 여부.
+	 * @param stats GJK 반복 횟수와 EPA 면 개수를 누적할 통계.
 	 */
-	void evaluate(Manifold &manifold, const Transform &transformA, const Transform &transformB, bool isSensor);
+	void evaluate(Manifold &manifold, const Transform &transformA, const Transform &transformB, bool isSensor,
+				  PhysicsStats &stats);
 
 	/**
 	 * @brief 충돌 포인트를 생성합니다.
@@ -272,9 +271,18 @@ class Contact
 	 */
 	int32_t getFaceNormals(SimplexArray &simplexArray, FaceArray &faceArray);
 
+	/** @brief 이전 Contact 포인터를 반환합니다. */
+	Contact *getPrev();
+
 	/** @brief 다음 Contact 포인터를 반환합니다. */
 	Contact *getNext();
 
+	/** @brief Island 내부에서 첫 번째 개체의 인덱스를 반환합니다. */
+	int32_t getIslandIndexA() const;
+
+	/** @brief Island 내부에서 두 번째 개체의 인덱스를 반환합니다. */
+	int32_t getIslandIndexB() const;
+
 	/**
 	 * @brief 주어진 방향에서 충돌 지점(Support Point)을 찾습니다.
 	 * @param convexA 첫 번째 Convex 객체.
@@ -284,6 +292,17 @@ class Contact
 	 */
 	Simplex getSupportPoint(const ConvexInfo &convexA, const ConvexInfo &convexB, alglm::vec3 &dir);
 
+	/**
+	 * @brief GJK 알고리즘으로 두 Convex 사이의 최단 거리를 계산합니다.
+	 * @details Minkowski 차(A - B)에서 원점과 가장 가까운 점을 반복적으로 찾습니다. 연속 충돌 검사(TOI)에서
+	 *          Conservative Advancement의 거리 계산에 사용합니다.
+	 * @param convexA 첫 번째 Convex 객체.
+	 * @param convexB 두 번째 Convex 객체.
+	 * @param normal A에서 B를 향하는 최단 거리 방향을 저장할 벡터.
+	 * @return 두 Convex 사이의 거리. 겹쳐 있으면 0.
+	 */
+	float getGjkDistance(const ConvexInfo &convexA, const ConvexInfo &convexB, alglm::vec3 &normal);
+
 	/**
 	 * @brief EPA 알고리즘을 이용하여 충돌 깊이와 법선을 계산합니다.
 	 * @param convexA 첫 번째 Convex 객체.
@@ -317,6 +336,13 @@ class Contact
 	/** @brief 다음 Contact 포인터를 설정합니다. */
 	void setNext(Contact *contact);
 
+	/**
+	 * @brief Island 내부에서 두 개체의 인덱스를 설정합니다.
+	 * @param indexA 첫 번째 개체의 Island 인덱스.
+	 * @param indexB 두 번째 개체의 Island 인덱스.
+	 */
+	void setIslandIndices(int32_t indexA, int32_t indexB);
+
 	/**
 	 * @brief 충돌 플래그를 설정합니다.
 	 * @param flag 설정할 플래그.
@@ -333,8 +359,64 @@ class Contact
 	/** @brief 충돌 플래그를 해제합니다. */
 	void unsetFlag(EContactFlag flag);
 
+	/** @brief 충돌 플래그 전체를 반환합니다. */
+	int32_t getFlags() const;
+
+	/** @brief 이전 update에서 두 Fixture가 닿아 있었는지 반환합니다. */
+	bool wasTouched() const;
+
+	/**
+	 * @brief 스냅샷에 저장된 플래그와 접촉 여부로 되돌립니다.
+	 * @details Manifold는 getManifold()로 직접 복원합니다.
+	 * @param flags 복원할 충돌 플래그.
+	 * @param wasTouched 이전 update에서 닿아 있었는지 여부.
+	 */
+	void restoreState(int32_t flags, bool wasTouched);
+
+	/**
+	 * @brief 충돌 타입별로 해석적(analytic) 충돌 계산 사용 여부를 설정합니다.
+	 * @details 해석적 계산을 구현하지 않은 충돌 타입은 설정과 관계없이 GJK/EPA를 사용합니다.
+	 * @param typeMask 두 Shape 타입의 OR 값 (ex. EType::SPHERE | EType::BOX).
+	 * @param enabled 사용하면 true, GJK/EPA만 사용하면 false.
+	 */
+	static void setAnalyticEnabled(int32_t typeMask, bool enabled);
+
+	/**
+	 * @brief 충돌 타입의 해석적 충돌 계산 사용 여부를 반환합니다.
+	 * @param typeMask 두 Shape 타입의 OR 값.
+	 * @return 사용하면 true, 아니면 false.
+	 */
+	static bool isAnalyticEnabled(int32_t typeMask);
+
+	static const float WARM_START_DISTANCE_SQUARED; /**< 이전 충돌 지점과 같은 지점으로 볼 거리의 제곱 */
+	static const float WARM_START_NORMAL_COS;		/**< 이전 충돌 지점과 같은 지점으로 볼 법선 각도의 cos */
+	static const float EPA_FACE_TOLERANCE;			/**< 원점을 지나는 것으로 볼 EPA 면과 원점 사이의 음수 거리 */
+
   protected:
 	static contactMemberFunction createContactFunctions[32];
+	static bool analyticEnabled[32];
+
+	/**
+	 * @brief 닫힌 형태의 식으로 충돌 포인트를 계산하는 가상 함수.
+	 * @details 기본 구현은 false를 반환하여 GJK/EPA 경로를 사용하게 합니다.
+	 * @param convexA 첫 번째 개체의 ConvexInfo.
+	 * @param convexB 두 번째 개체의 ConvexInfo.
+	 * @param collisionInfo 충돌 정보를 저장할 구조체. 충돌하지 않으면 size는 0으로 유지됩니다.
+	 * @return 해석적으로 계산했으면 true, GJK/EPA로 계산해야 하면 false.
+	 */
+	virtual bool findAnalyticCollisionPoints(const ConvexInfo &convexA, const ConvexInfo &convexB,
+											 CollisionInfo &collisionInfo);
+
+	/**
+	 * @brief 두 구 사이의 충돌 포인트를 추가합니다.
+	 * @param centerA 첫 번째 구의 중심.
+	 * @param radiusA 첫 번째 구의 반지름.
+	 * @param centerB 두 번째 구의 중심.
+	 * @param radiusB 두 번째 구의 반지름.
+	 * @param collisionInfo 충돌 정보를 저장할 구조체.
+	 */
+	void addSphereCollisionPoint(const alglm::vec3 &centerA, float radiusA, const alglm::vec3 &centerB, float radiusB,
+								 CollisionInfo &collisionInfo);
 
 	/** @brief 라인 심플렉스를 처리합니다. */
 	bool handleLineSimplex(SimplexArray &simplexArray, alglm::vec3 &dir);
@@ -485,12 +567,6 @@ class Contact
 	 */
 	void sizeUpFaceArray(FaceArray &faceArray, int32_t newMaxCount);
 
-	/**
-	 * @brief ConvexInfo에 할당된 메모리를 해제합니다.
-	 * @param convexA 해제할 첫 번째 ConvexInfo.
-	 * @param convexB 해제할 두 번째 ConvexInfo.
-	 */
-	void freeConvexInfo(ConvexInfo &convexA, ConvexInfo &convexB);
 
 	bool m_wasTouched;
 	float m_friction;
@@ -504,6 +580,8 @@ class Contact
 	Fixture *m_fixtureB;
 	int32_t m_indexA;
 	int32_t m_indexB;
+	int32_t m_islandIndexA;
+	int32_t m_islandIndexB;
 	Manifold m_manifold;
 };
 } // namespace ale
\ No newline at end of file
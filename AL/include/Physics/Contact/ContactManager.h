@@ -31,11 +31,37 @@ class ContactManager
 	 */
 	void addPair(void *proxyUserDataA, void *proxyUserDataB);
 
+	/**
+	 * @brief Contact를 생성하여 World의 Contact 리스트와 두 Body의 ContactLink 앞에 추가합니다.
+	 * @details 충돌 가능 여부나 중복은 검사하지 않습니다.
+	 * @param fixtureA 첫 번째 Fixture.
+	 * @param fixtureB 두 번째 Fixture.
+	 * @param indexA 첫 번째 Fixture의 child 인덱스.
+	 * @param indexB 두 번째 Fixture의 child 인덱스.
+	 * @return 생성된 Contact.
+	 */
+	Contact *createContact(Fixture *fixtureA, Fixture *fixtureB, int32_t indexA, int32_t indexB);
+
+	/**
+	 * @brief Contact를 World의 Contact 리스트와 두 Body의 ContactLink에서 분리하고 소멸시킵니다.
+	 * @details 접촉 중이던 Contact를 제거하면 두 Body를 깨웁니다.
+	 * @param contact 제거할 Contact.
+	 */
+	void destroy(Contact *contact);
+
+	/**
+	 * @brief 모든 Contact를 소멸시키고 Body의 ContactLink를 비웁니다.
+	 * @details Body를 깨우지 않고 센서의 touchNum도 복구하지 않으므로 스냅샷 복원처럼 상태를 통째로 덮어쓸 때만
+	 *          사용합니다.
+	 */
+	void clear();
+
 	/**
 	 * @brief 새로운 충돌을 찾습니다.
 	 * @details BroadPhase를 통해 현재 존재하는 충돌을 감지하고 Contact 목록을 갱신합니다.
+	 * @param stats 후보 Pair 개수와 새 Contact 개수를 기록할 통계.
 	 */
-	void findNewContacts();
+	void findNewContacts(PhysicsStats &stats);
 
 	/**
 	 * @brief 기존 충돌과 동일한 충돌인지 확인합니다.
@@ -50,9 +76,18 @@ class ContactManager
 
 	/**
 	 * @brief 현재 존재하는 충돌을 처리합니다.
-	 * @details 모든 활성화된 충돌을 검사하고 필요한 물리 연산을 수행합니다.
+	 * @details 모든 활성화된 충돌을 검사하고 필요한 물리 연산을 수행합니다. 두 Fat AABB가 더 이상 겹치지 않는
+	 *          Contact는 제거합니다.
+	 * @param stats Contact 개수와 GJK/EPA 작업량을 기록할 통계.
+	 */
+	void collide(PhysicsStats &stats);
+
+	/**
+	 * @brief Contact를 이루는 두 Proxy의 Fat AABB가 겹치는지 확인합니다.
+	 * @param contact 확인할 Contact.
+	 * @return 겹치면 true, 아니면 false.
 	 */
-	void collide();
+	bool testFatAABBOverlap(Contact *contact) const;
 
 	BroadPhase m_broadPhase;
 	Contact *m_contactList;
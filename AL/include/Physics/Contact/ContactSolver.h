@@ -3,6 +3,11 @@
 #include "Physics/Island.h"
 #include "Physics/PhysicsAllocator.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define AL_CONTACT_SOLVER_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace ale
 {
 /**
@@ -29,6 +34,18 @@ struct ContactPositionConstraint
 	~ContactPositionConstraint() = default;
 };
 
+/**
+ * @struct VelocityConstraintPoint
+ * @brief 충돌 지점별로 반복 계산 전에 한 번만 구해두는 속도 제약 값.
+ */
+struct VelocityConstraintPoint
+{
+	alglm::vec3 rA;		// bodyA 질량 중심에서 충돌 지점까지의 벡터
+	alglm::vec3 rB;		// bodyB 질량 중심에서 충돌 지점까지의 벡터
+	float normalMass;	// 법선 방향 유효 질량
+	float velocityBias; // 반발 계수에 따른 목표 법선 속도
+};
+
 /**
  * @struct ContactVelocityConstraint
  * @brief 충돌 속도(Velocity) 제약 조건을 저장하는 구조체.
@@ -36,6 +53,7 @@ struct ContactPositionConstraint
 struct ContactVelocityConstraint
 {
 	ManifoldPoint *points;
+	VelocityConstraintPoint *constraintPoints;
 	int32_t pointCount;
 	alglm::vec3 worldCenterA;
 	alglm::vec3 worldCenterB;
@@ -49,6 +67,41 @@ struct ContactVelocityConstraint
 	~ContactVelocityConstraint() = default;
 };
 
+/**
+ * @struct SimdVelocityConstraintPoint
+ * @brief SimdVelocityConstraint에 묶인 4개 Contact의 같은 순번 충돌 지점을 lane별로 모은 SoA 속도 제약 값.
+ * @details 충돌 지점이 없는 lane은 유효 질량과 누적 충격량이 0이라 속도에 영향을 주지 않습니다.
+ */
+struct alignas(16) SimdVelocityConstraintPoint
+{
+	float rAX[4], rAY[4], rAZ[4];
+	float rBX[4], rBY[4], rBZ[4];
+	float normalX[4], normalY[4], normalZ[4];
+	float normalMass[4];
+	float velocityBias[4];
+	float normalImpulse[4];
+	float tangentImpulseX[4], tangentImpulseY[4], tangentImpulseZ[4];
+};
+
+/**
+ * @struct SimdVelocityConstraint
+ * @brief 서로 body를 공유하지 않는 최대 4개의 Contact를 lane별로 모은 SoA 속도 제약 조건.
+ * @details 관성 텐서는 열 우선 순서(col * 3 + row)로 저장합니다. 빈 lane은 contactIndex와 body 인덱스가 -1입니다.
+ */
+struct alignas(16) SimdVelocityConstraint
+{
+	float invIA[9][4];
+	float invIB[9][4];
+	float invMassA[4];
+	float invMassB[4];
+	float friction[4];
+	int32_t indexA[4];
+	int32_t indexB[4];
+	int32_t contactIndex[4];
+	int32_t pointOffset; // m_simdPoints에서 첫 충돌 지점의 위치
+	int32_t pointCount;	 // lane 중 가장 많은 충돌 지점 개수
+};
+
 /**
  * @class ContactSolver
  * @brief 물리 엔진에서 충돌을 해결하는 클래스.
@@ -66,9 +119,10 @@ class ContactSolver
 	 * @param velocities 개체들의 속도(Velocity) 배열.
 	 * @param bodyCount 물리 연산을 수행할 개체 개수.
 	 * @param contactCount 충돌 개수.
+	 * @param allocator 제약 조건 배열을 할당할 스택 할당자.
 	 */
 	ContactSolver(float duration, Contact **contacts, Position *positions, Velocity *velocities, int32_t bodyCount,
-				  int32_t contactCount);
+				  int32_t contactCount, StackAllocator &allocator);
 
 	/**
 	 * @brief ContactSolver 객체를 해제합니다.
@@ -77,14 +131,29 @@ class ContactSolver
 
 	/**
 	 * @brief 속도 제약 조건을 초기화합니다.
+	 * @details 충돌 지점별 유효 질량과 반발 속도를 반복 계산 전에 한 번만 계산하고, SIMD 경로에서는 Contact를
+	 *          색칠해 SoA 배치로 묶습니다.
 	 */
 	void initializeVelocityConstraints();
 
+	/**
+	 * @brief 이전 프레임에서 이어받은 누적 충격량을 속도에 적용합니다.
+	 */
+	void warmStart();
+
 	/**
 	 * @brief 속도 제약 조건을 해결합니다.
+	 * @details 같은 색의 Contact는 body를 공유하지 않으므로 4개씩 SIMD lane으로 동시에 계산합니다. 색을 배정받지
+	 *          못한 Contact는 마지막에 순서대로 계산합니다.
 	 */
 	void solveVelocityConstraints();
 
+	/**
+	 * @brief SoA 배치에 누적된 충격량을 Manifold에 기록합니다.
+	 * @details 다음 step의 warm starting에 사용되므로 속도 제약 반복이 끝난 뒤 호출해야 합니다.
+	 */
+	void storeImpulses();
+
 	/**
 	 * @brief 위치 제약 조건을 해결합니다.
 	 */
@@ -99,6 +168,9 @@ class ContactSolver
 	static const float TANGENT_STOP_VELOCITY;
 	static const float NORMAL_SLEEP_VELOCITY;
 	static const float TANGENT_SLEEP_VELOCITY;
+	static const float RESTITUTION_THRESHOLD;
+	static const int32_t SIMD_WIDTH;	  /**< SoA 배치 하나에 묶는 Contact 개수 */
+	static const int32_t MAX_COLOR_COUNT; /**< Contact 색칠에 사용하는 최대 색 개수 */
 
 	int32_t m_bodyCount;
 	int32_t m_contactCount;
@@ -108,6 +180,35 @@ class ContactSolver
 	Velocity *m_velocities;
 	ContactPositionConstraint *m_positionConstraints;
 	ContactVelocityConstraint *m_velocityConstraints;
+	VelocityConstraintPoint *m_constraintPoints;
+	SimdVelocityConstraint *m_simdConstraints;
+	SimdVelocityConstraintPoint *m_simdPoints;
+	int32_t *m_overflowContacts; // 색을 배정받지 못해 순서대로 계산하는 Contact 인덱스
+	int32_t m_simdConstraintCount;
+	int32_t m_overflowCount;
+	int32_t m_batchStackCount; // 배치 생성에 사용한 스택 할당 개수
+	StackAllocator &m_allocator;
+
+  private:
+	/**
+	 * @brief Contact를 색칠하고 같은 색끼리 SIMD_WIDTH개씩 SoA 배치로 묶습니다.
+	 * @details staticBody는 속도가 바뀌지 않으므로 색칠할 때 공유 여부를 따지지 않습니다.
+	 */
+	void buildBatches();
+
+	/**
+	 * @brief Contact 하나의 속도 제약 조건을 해결합니다.
+	 * @param index 해결할 Contact의 인덱스.
+	 */
+	void solveVelocityConstraint(int32_t index);
+
+#ifdef AL_CONTACT_SOLVER_SSE
+	/**
+	 * @brief SoA 배치 하나의 속도 제약 조건을 SIMD로 해결합니다.
+	 * @param constraint 해결할 SoA 배치.
+	 */
+	void solveSimdVelocityConstraint(const SimdVelocityConstraint &constraint);
+#endif
 };
 
 } // namespace ale
\ No newline at end of file
@@ -62,5 +62,15 @@ class SphereToBoxContact : public Contact
 	 */
 	virtual void findCollisionPoints(const ConvexInfo &sphere, const ConvexInfo &box, CollisionInfo &collisionInfo,
 									 EpaInfo &epaInfo, SimplexArray &simplexArray) override;
+
+	/**
+	 * @brief 구와 박스 간 충돌 포인트를 닫힌 형태의 식으로 계산합니다.
+	 * @param sphere 구의 ConvexInfo.
+	 * @param box 박스의 ConvexInfo.
+	 * @param collisionInfo 충돌 정보를 저장할 구조체.
+	 * @return 항상 true.
+	 */
+	virtual bool findAnalyticCollisionPoints(const ConvexInfo &sphere, const ConvexInfo &box,
+											 CollisionInfo &collisionInfo) override;
 };
 } // namespace ale
\ No newline at end of file
@@ -62,5 +62,15 @@ class SphereToCapsuleContact : public Contact
 	 */
 	virtual void findCollisionPoints(const ConvexInfo &sphere, const ConvexInfo &capsule, CollisionInfo &collisionInfo,
 									 EpaInfo &epaInfo, SimplexArray &simplexArray) override;
+
+	/**
+	 * @brief 구와 캡슐 간 충돌 포인트를 닫힌 형태의 식으로 계산합니다.
+	 * @param sphere 구의 ConvexInfo.
+	 * @param capsule 캡슐의 ConvexInfo.
+	 * @param collisionInfo 충돌 정보를 저장할 구조체.
+	 * @return 항상 true.
+	 */
+	virtual bool findAnalyticCollisionPoints(const ConvexInfo &sphere, const ConvexInfo &capsule,
+											 CollisionInfo &collisionInfo) override;
 };
 } // namespace ale
\ No newline at end of file
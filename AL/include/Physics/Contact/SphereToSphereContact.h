@@ -63,5 +63,15 @@ class SphereToSphereContact : public Contact
 	 */
 	virtual void findCollisionPoints(const ConvexInfo &sphereA, const ConvexInfo &sphereB, CollisionInfo &collisionInfo,
 									 EpaInfo &epaInfo, SimplexArray &simplexArray) override;
+
+	/**
+	 * @brief 두 개의 구 간 충돌 포인트를 닫힌 형태의 식으로 계산합니다.
+	 * @param sphereA 첫 번째 구의 ConvexInfo.
+	 * @param sphereB 두 번째 구의 ConvexInfo.
+	 * @param collisionInfo 충돌 정보를 저장할 구조체.
+	 * @return 항상 true.
+	 */
+	virtual bool findAnalyticCollisionPoints(const ConvexInfo &sphereA, const ConvexInfo &sphereB,
+											 CollisionInfo &collisionInfo) override;
 };
 } // namespace ale
\ No newline at end of file
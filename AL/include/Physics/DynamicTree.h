@@ -2,7 +2,13 @@
 
 #include "Physics/Collision.h"
 
-#include <stack>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define AL_DYNAMIC_TREE_SSE
+#include <xmmintrin.h>
+#endif
 
 #define nullNode (-1)
 
@@ -30,6 +36,7 @@ struct TreeNode
 	}
 	AABB aabb; // Enlarged AABB
 	void *userData;
+	CollisionFilter filter; // leaf 전용
 	union {
 		int32_t parent;
 		int32_t next;
@@ -39,6 +46,100 @@ struct TreeNode
 	int32_t height;
 };
 
+/**
+ * @struct WideTreeNode
+ * @brief 이진 트리를 4갈래로 접은 쿼리 전용 노드 구조체.
+ * @details 네 자식의 AABB를 축별 배열(SoA)로 저장하여 한 번의 SIMD 연산으로 네 자식의 겹침을 검사합니다.
+ *          사용하지 않는 슬롯은 뒤집힌 AABB(min = FLT_MAX, max = -FLT_MAX)를 가지므로 항상 겹치지 않습니다.
+ */
+struct alignas(16) WideTreeNode
+{
+	float minX[4];
+	float minY[4];
+	float minZ[4];
+	float maxX[4];
+	float maxY[4];
+	float maxZ[4];
+	int32_t children[4]; // 0 이상: WideTreeNode 인덱스, nullNode 미만: 리프 (-(proxyId) - 2)
+};
+
+/**
+ * @class GrowableStack
+ * @brief 처음 N개는 객체 안의 배열에 저장하고 넘칠 때만 힙으로 옮기는 스택.
+ * @details 이진 트리 순회 스택처럼 대부분 작지만 상한을 정할 수 없는 경우에 쿼리마다 힙 할당하지 않도록 사용합니다.
+ * @tparam T 원소 타입 (trivially copyable).
+ * @tparam N 객체 안에 저장할 원소 개수.
+ */
+template <typename T, int32_t N> class GrowableStack
+{
+	static_assert(std::is_trivially_copyable<T>::value, "GrowableStack element must be trivially copyable");
+
+  public:
+	GrowableStack() : m_data(m_array), m_count(0), m_capacity(N)
+	{
+	}
+
+	~GrowableStack()
+	{
+		if (m_data != m_array)
+		{
+			delete[] m_data;
+		}
+	}
+
+	GrowableStack(const GrowableStack &) = delete;
+	GrowableStack &operator=(const GrowableStack &) = delete;
+
+	void push(const T &value)
+	{
+		if (m_count == m_capacity)
+		{
+			grow();
+		}
+		m_data[m_count++] = value;
+	}
+
+	T pop()
+	{
+		return m_data[--m_count];
+	}
+
+	bool empty() const
+	{
+		return m_count == 0;
+	}
+
+  private:
+	void grow()
+	{
+		T *data = new T[m_capacity * 2];
+		std::copy(m_data, m_data + m_count, data);
+		if (m_data != m_array)
+		{
+			delete[] m_data;
+		}
+		m_data = data;
+		m_capacity *= 2;
+	}
+
+	T m_array[N];
+	T *m_data;
+	int32_t m_count;
+	int32_t m_capacity;
+};
+
+/**
+ * @struct TreeQuality
+ * @brief DynamicTree의 품질 지표.
+ */
+struct TreeQuality
+{
+	float areaRatio;	/**< 내부 노드 표면적 합 / 루트 표면적 (SAH 순회 비용, 낮을수록 좋음) */
+	int32_t height;		/**< 루트 높이 */
+	int32_t proxyCount; /**< 리프 개수 */
+	int32_t nodeCount;	/**< 할당된 노드 개수 (내부 노드 포함) */
+};
+
 /**
  * @class DynamicTree
  * @brief 동적 트리 기반 충돌 감지를 수행하는 클래스.
@@ -61,9 +162,11 @@ class DynamicTree
 	 * @brief AABB와 사용자 데이터를 기반으로 새로운 Proxy(노드)를 생성합니다.
 	 * @param aabb 삽입할 AABB.
 	 * @param userData 사용자 데이터 포인터.
+	 * @param filter Proxy의 충돌 필터.
+	 * @param margin Fat AABB에 더할 여백.
 	 * @return 생성된 Proxy ID.
 	 */
-	int32_t createProxy(const AABB &aabb, void *userData);
+	int32_t createProxy(const AABB &aabb, void *userData, const CollisionFilter &filter, float margin);
 
 	/**
 	 * @brief Proxy ID에 해당하는 노드를 제거합니다.
@@ -76,9 +179,20 @@ class DynamicTree
 	 * @param proxyId 이동할 Proxy ID.
 	 * @param aabb 새로운 AABB.
 	 * @param displacement 이동 벡터.
-	 * @return 이동 성공 여부 (true: 성공, false: 실패).
+	 * @param margin Fat AABB에 더할 여백.
+	 * @param predictionFactor 이동 방향으로 Fat AABB를 늘릴 이동 벡터의 배수.
+	 * @return 트리에 다시 삽입했으면 true, 기존 Fat AABB 안에 있으면 false.
 	 */
-	bool moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement);
+	bool moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement, float margin,
+				   float predictionFactor);
+
+	/**
+	 * @brief Proxy의 Fat AABB를 그대로 지정하고 트리를 재구성합니다.
+	 * @details 스냅샷 복원에 사용하며, 여백이나 이동 예측을 더하지 않습니다.
+	 * @param proxyId 변경할 Proxy ID.
+	 * @param fatAABB 지정할 Fat AABB.
+	 */
+	void setFatAABB(int32_t proxyId, const AABB &fatAABB);
 
 	/**
 	 * @brief Proxy ID에 해당하는 사용자 데이터를 반환합니다.
@@ -87,6 +201,20 @@ class DynamicTree
 	 */
 	void *getUserData(int32_t proxyId) const;
 
+	/**
+	 * @brief Proxy ID에 해당하는 충돌 필터를 반환합니다.
+	 * @param proxyId 조회할 Proxy ID.
+	 * @return 해당 Proxy의 충돌 필터.
+	 */
+	const CollisionFilter &getFilter(int32_t proxyId) const;
+
+	/**
+	 * @brief Proxy의 충돌 필터를 변경합니다.
+	 * @param proxyId 변경할 Proxy ID.
+	 * @param filter 새로운 충돌 필터.
+	 */
+	void setFilter(int32_t proxyId, const CollisionFilter &filter);
+
 	/**
 	 * @brief Proxy ID에 해당하는 AABB를 반환합니다.
 	 * @param proxyId 조회할 Proxy ID.
@@ -102,7 +230,158 @@ class DynamicTree
 	 */
 	template <typename T> void query(T *callback, const AABB &aabb) const;
 
+	/**
+	 * @brief 선분(또는 이동하는 구)과 겹치는 노드를 탐색합니다.
+	 * @details callback->rayCastCallback(input, proxyId)의 반환값으로 탐색을 제어합니다.
+	 *          0이면 탐색을 중단하고, 0보다 크면 그 값을 새로운 maxFraction으로 사용하여 이후 탐색 범위를 줄이며,
+	 *          0보다 작으면 해당 Proxy를 무시합니다.
+	 * @tparam T 콜백 함수 타입.
+	 * @param callback 검색된 노드를 처리할 콜백 함수.
+	 * @param input Ray cast 입력 정보. radius만큼 AABB를 늘려 검사합니다.
+	 */
+	template <typename T> void rayCast(T *callback, const RayCastInput &input) const;
+
+	/**
+	 * @brief 쿼리 횟수에 따라 쿼리용 4갈래 트리를 이진 트리로부터 다시 만듭니다.
+	 * @details 다시 접는 비용은 노드 수에 비례하므로, 트리가 바뀐 뒤 누적된 쿼리 횟수가 노드 수의
+	 *          1 / WIDE_TREE_QUERY_RATIO를 넘을 때만 다시 만듭니다. 다시 만들기 전까지 query는 이진 트리를 순회하는
+	 *          기존 경로를 사용합니다. 이진 트리가 바뀌지 않았다면 아무 작업도 하지 않습니다.
+	 * @param queryCount 다음 변경 전까지 실행할 쿼리 횟수.
+	 */
+	void updateWideTree(int32_t queryCount);
+
+	/**
+	 * @brief 트리의 품질 지표를 계산합니다.
+	 * @details 모든 노드를 순회하므로 매 step 호출하지 않습니다.
+	 * @return 표면적 비율, 높이, 리프 개수.
+	 */
+	TreeQuality computeQuality() const;
+
+	/**
+	 * @brief 내부 노드 일부에 트리 회전을 적용하여 표면적을 줄입니다.
+	 * @details 호출할 때마다 이전 호출이 멈춘 노드부터 이어서 nodeBudget개의 내부 노드를 검사합니다. 자식과 손자를
+	 *          바꿨을 때 형제 노드의 표면적이 줄어들고 두 노드의 자식 높이 차가 1 이하로 유지되면 바꾸고 조상의 높이를
+	 *          갱신합니다. 리프 집합과 AABB는 바뀌지 않으므로 쿼리용 4갈래 트리를 다시 만들 필요가 없습니다.
+	 * @param nodeBudget 이번 호출에서 검사할 최대 내부 노드 수.
+	 */
+	void optimize(int32_t nodeBudget);
+
+	/**
+	 * @brief 모든 리프를 모아 top-down binned SAH로 트리를 다시 만듭니다.
+	 * @details Proxy ID와 Fat AABB는 그대로 유지되고 내부 노드만 새로 할당됩니다. 쿼리용 4갈래 트리는 여전히
+	 *          정확하므로 다음 변경 때 함께 다시 만듭니다.
+	 */
+	void rebuild();
+
   private:
+	/**
+	 * @brief leaves 구간의 리프들로 SAH 하위 트리를 만듭니다.
+	 * @param leaves 리프 노드 ID 배열. 분할 과정에서 순서가 바뀝니다.
+	 * @param count 리프 개수.
+	 * @return 하위 트리의 루트 노드 ID.
+	 */
+	int32_t buildNode(int32_t *leaves, int32_t count);
+
+	/**
+	 * @brief 한 내부 노드에서 가능한 회전 중 표면적이 가장 많이 줄어드는 것을 적용합니다.
+	 * @param iA 검사할 내부 노드 ID.
+	 */
+	void rotate(int32_t iA);
+
+	/**
+	 * @brief swapWithGrandchild(iA, iX, iS, iY) 뒤에도 iA와 iS의 두 자식 높이 차가 1 이하인지 검사합니다.
+	 * @details 높이 차가 커지면 다음 삽입, 제거 경로의 balance가 표면적을 보지 않고 다시 회전시켜 트리 품질이
+	 *          나빠지므로, 이 조건을 만족하는 회전만 적용합니다.
+	 * @return 높이 균형이 유지되면 true.
+	 */
+	bool isBalancedSwap(int32_t iX, int32_t iS, int32_t iY) const;
+
+	/**
+	 * @brief iA의 자식 iX와 다른 자식 iS의 자식 iY를 바꾸고 높이를 갱신합니다.
+	 */
+	void swapWithGrandchild(int32_t iA, int32_t iX, int32_t iS, int32_t iY);
+
+	/**
+	 * @brief 이진 트리를 순회하며 AABB와 겹치는 노드를 탐색합니다.
+	 * @tparam T 콜백 함수 타입.
+	 * @param callback 검색된 노드를 처리할 콜백 함수.
+	 * @param aabb 검색할 AABB 영역.
+	 */
+	template <typename T> void queryBinary(T *callback, const AABB &aabb) const;
+
+	/**
+	 * @brief 이진 트리를 순회하며 선분과 겹치는 노드를 탐색합니다.
+	 * @tparam T 콜백 함수 타입.
+	 * @param callback 검색된 노드를 처리할 콜백 함수.
+	 * @param input Ray cast 입력 정보.
+	 */
+	template <typename T> void rayCastBinary(T *callback, const RayCastInput &input) const;
+
+	/**
+	 * @brief 선분이 radius만큼 늘린 AABB를 [0, maxFraction] 구간 안에서 지나는지 slab 검사합니다.
+	 * @param lower 검사할 AABB의 최솟값.
+	 * @param upper 검사할 AABB의 최댓값.
+	 * @param p1 선분의 시작점.
+	 * @param invD 선분 방향 벡터의 성분별 역수.
+	 * @param radius AABB를 늘릴 크기.
+	 * @param maxFraction 검사할 최대 비율.
+	 * @return 지나면 true.
+	 */
+	static bool testRayOverlap(const alglm::vec3 &lower, const alglm::vec3 &upper, const alglm::vec3 &p1,
+							   const alglm::vec3 &invD, float radius, float maxFraction)
+	{
+		float tMin = 0.0f;
+		float tMax = maxFraction;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			float t1 = (lower[i] - radius - p1[i]) * invD[i];
+			float t2 = (upper[i] + radius - p1[i]) * invD[i];
+			tMin = std::max(tMin, std::min(t1, t2));
+			tMax = std::min(tMax, std::max(t1, t2));
+		}
+		return tMin <= tMax;
+	}
+
+	/**
+	 * @brief 선분 방향 벡터의 성분별 역수를 구합니다.
+	 * @details 0인 성분은 FLT_MAX를 사용하여 slab 검사에서 NaN 없이 무한대로 처리되도록 합니다.
+	 */
+	static alglm::vec3 getInverseDirection(const alglm::vec3 &d)
+	{
+		return alglm::vec3(d.x != 0.0f ? 1.0f / d.x : FLT_MAX, d.y != 0.0f ? 1.0f / d.y : FLT_MAX,
+						   d.z != 0.0f ? 1.0f / d.z : FLT_MAX);
+	}
+
+	/**
+	 * @brief 쿼리용 4갈래 트리를 이진 트리로부터 다시 만듭니다.
+	 * @details 이진 트리의 높이가 WIDE_TREE_MAX_HEIGHT를 넘으면 고정 크기 스택이 넘칠 수 있으므로 만들지 않고, query는
+	 *          이진 트리를 순회합니다.
+	 */
+	void rebuildWideTree();
+
+	/**
+	 * @brief 이진 트리의 내부 노드를 4갈래 노드로 접습니다.
+	 * @param nodeId 접을 이진 트리 노드 ID.
+	 * @return 생성된 WideTreeNode 인덱스.
+	 */
+	int32_t collapseNode(int32_t nodeId);
+
+	/**
+	 * @brief 리프 Proxy ID를 WideTreeNode 자식 값으로 변환합니다.
+	 */
+	static int32_t encodeWideLeaf(int32_t proxyId)
+	{
+		return -proxyId - 2;
+	}
+
+	/**
+	 * @brief WideTreeNode 자식 값을 리프 Proxy ID로 변환합니다.
+	 */
+	static int32_t decodeWideLeaf(int32_t child)
+	{
+		return -child - 2;
+	}
+
 	/**
 	 * @brief 새로운 노드를 할당합니다.
 	 * @return 할당된 노드 ID.
@@ -168,23 +447,115 @@ class DynamicTree
 	int32_t m_nodeCount;
 	int32_t m_nodeCapacity;
 	std::vector<TreeNode> m_nodes;
+
+	std::vector<WideTreeNode> m_wideNodes;
+	int32_t m_wideRoot;
+	bool m_isWideTreeDirty;
+	int32_t m_staleQueryCount; /**< 4갈래 트리가 바뀐 뒤 이진 트리로 실행한 쿼리 횟수 */
+
+	int32_t m_optimizeCursor;			  /**< optimize가 다음에 검사할 노드 ID */
+	std::vector<int32_t> m_rebuildLeaves; /**< rebuild에서 리프를 모으는 버퍼 */
+
+	static const int32_t SAH_BIN_COUNT = 16;			/**< rebuild에서 분할 후보를 나누는 구간 수 */
+	static const int32_t WIDE_QUERY_STACK_SIZE = 256;	/**< 4갈래 트리 순회 스택 크기 */
+	static const int32_t BINARY_QUERY_STACK_SIZE = 256;	/**< 이진 트리 순회 스택을 힙으로 옮기기 전 크기 */
+	static const int32_t WIDE_TREE_MAX_HEIGHT;			/**< 4갈래 트리를 만드는 최대 이진 트리 높이 */
+	static const int32_t WIDE_TREE_QUERY_RATIO;			/**< 다시 접기 전에 누적할 쿼리 횟수의 노드 수 대비 비율 */
 };
 
 template <typename T> inline void DynamicTree::query(T *callback, const AABB &aabb) const
 {
-	std::stack<int32_t> stack;
+	if (m_isWideTreeDirty)
+	{
+		queryBinary(callback, aabb);
+		return;
+	}
+
+	if (m_wideRoot == nullNode)
+	{
+		return;
+	}
+
+	// 4갈래 트리는 이진 트리 높이가 WIDE_TREE_MAX_HEIGHT 이하일 때만 만들어지므로 고정 크기 스택이 넘치지 않음
+	int32_t stack[WIDE_QUERY_STACK_SIZE];
+	int32_t stackCount = 0;
+	stack[stackCount++] = m_wideRoot;
+
+#ifdef AL_DYNAMIC_TREE_SSE
+	const __m128 queryMinX = _mm_set1_ps(aabb.lowerBound.x);
+	const __m128 queryMinY = _mm_set1_ps(aabb.lowerBound.y);
+	const __m128 queryMinZ = _mm_set1_ps(aabb.lowerBound.z);
+	const __m128 queryMaxX = _mm_set1_ps(aabb.upperBound.x);
+	const __m128 queryMaxY = _mm_set1_ps(aabb.upperBound.y);
+	const __m128 queryMaxZ = _mm_set1_ps(aabb.upperBound.z);
+#endif
+
+	while (stackCount > 0)
+	{
+		const WideTreeNode &node = m_wideNodes[stack[--stackCount]];
+
+#ifdef AL_DYNAMIC_TREE_SSE
+		// 네 자식의 AABB 겹침 검사를 한 번에 수행
+		__m128 overlap = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.minX), queryMaxX),
+									_mm_cmple_ps(queryMinX, _mm_load_ps(node.maxX)));
+		overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(node.minY), queryMaxY));
+		overlap = _mm_and_ps(overlap, _mm_cmple_ps(queryMinY, _mm_load_ps(node.maxY)));
+		overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(node.minZ), queryMaxZ));
+		overlap = _mm_and_ps(overlap, _mm_cmple_ps(queryMinZ, _mm_load_ps(node.maxZ)));
+		int32_t mask = _mm_movemask_ps(overlap);
+#else
+		int32_t mask = 0;
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			if (node.minX[i] <= aabb.upperBound.x && aabb.lowerBound.x <= node.maxX[i] &&
+				node.minY[i] <= aabb.upperBound.y && aabb.lowerBound.y <= node.maxY[i] &&
+				node.minZ[i] <= aabb.upperBound.z && aabb.lowerBound.z <= node.maxZ[i])
+			{
+				mask |= 1 << i;
+			}
+		}
+#endif
+
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			if ((mask & (1 << i)) == 0)
+			{
+				continue;
+			}
+
+			int32_t child = node.children[i];
+			if (child < nullNode)
+			{
+				bool proceed = callback->queryCallback(decodeWideLeaf(child));
+				if (proceed == false)
+				{
+					return;
+				}
+			}
+			else
+			{
+				assert(stackCount < WIDE_QUERY_STACK_SIZE);
+				stack[stackCount++] = child;
+			}
+		}
+	}
+}
+
+template <typename T> inline void DynamicTree::queryBinary(T *callback, const AABB &aabb) const
+{
+	// 트리가 바뀐 step의 쿼리는 모두 이 경로를 거치므로 쿼리마다 힙 할당하지 않는 스택 사용
+	GrowableStack<int32_t, BINARY_QUERY_STACK_SIZE> stack;
 	stack.push(m_root);
 
 	while (!stack.empty())
 	{
-		int32_t nodeId = stack.top();
-		stack.pop();
+		int32_t nodeId = stack.pop();
 		if (nodeId == nullNode)
 		{
 			continue;
 		}
 
-		const TreeNode node = m_nodes[nodeId];
+		const TreeNode &node = m_nodes[nodeId];
 		if (testOverlap(node.aabb, aabb))
 		{
 			if (node.isLeaf())
@@ -203,4 +574,149 @@ template <typename T> inline void DynamicTree::query(T *callback, const AABB &aa
 		}
 	}
 }
-} // namespace ale
\ No newline at end of file
+template <typename T> inline void DynamicTree::rayCast(T *callback, const RayCastInput &input) const
+{
+	if (m_isWideTreeDirty)
+	{
+		rayCastBinary(callback, input);
+		return;
+	}
+
+	if (m_wideRoot == nullNode)
+	{
+		return;
+	}
+
+	const alglm::vec3 p1 = input.p1;
+	const alglm::vec3 invD = getInverseDirection(input.p2 - input.p1);
+	const float radius = input.radius;
+	float maxFraction = input.maxFraction;
+
+	int32_t stack[WIDE_QUERY_STACK_SIZE];
+	int32_t stackCount = 0;
+	stack[stackCount++] = m_wideRoot;
+
+#ifdef AL_DYNAMIC_TREE_SSE
+	const __m128 originX = _mm_set1_ps(p1.x);
+	const __m128 originY = _mm_set1_ps(p1.y);
+	const __m128 originZ = _mm_set1_ps(p1.z);
+	const __m128 invDX = _mm_set1_ps(invD.x);
+	const __m128 invDY = _mm_set1_ps(invD.y);
+	const __m128 invDZ = _mm_set1_ps(invD.z);
+	const __m128 radiusV = _mm_set1_ps(radius);
+#endif
+
+	while (stackCount > 0)
+	{
+		const WideTreeNode &node = m_wideNodes[stack[--stackCount]];
+
+#ifdef AL_DYNAMIC_TREE_SSE
+		// 네 자식의 slab 검사를 한 번에 수행
+		__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(node.minX), radiusV), originX), invDX);
+		__m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(node.maxX), radiusV), originX), invDX);
+		__m128 tMin = _mm_max_ps(_mm_setzero_ps(), _mm_min_ps(t1, t2));
+		__m128 tMax = _mm_min_ps(_mm_set1_ps(maxFraction), _mm_max_ps(t1, t2));
+
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(node.minY), radiusV), originY), invDY);
+		t2 = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(node.maxY), radiusV), originY), invDY);
+		tMin = _mm_max_ps(tMin, _mm_min_ps(t1, t2));
+		tMax = _mm_min_ps(tMax, _mm_max_ps(t1, t2));
+
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(node.minZ), radiusV), originZ), invDZ);
+		t2 = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(node.maxZ), radiusV), originZ), invDZ);
+		tMin = _mm_max_ps(tMin, _mm_min_ps(t1, t2));
+		tMax = _mm_min_ps(tMax, _mm_max_ps(t1, t2));
+
+		int32_t mask = _mm_movemask_ps(_mm_cmple_ps(tMin, tMax));
+#else
+		int32_t mask = 0;
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			alglm::vec3 lower(node.minX[i], node.minY[i], node.minZ[i]);
+			alglm::vec3 upper(node.maxX[i], node.maxY[i], node.maxZ[i]);
+			if (testRayOverlap(lower, upper, p1, invD, radius, maxFraction))
+			{
+				mask |= 1 << i;
+			}
+		}
+#endif
+
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			// 빈 슬롯의 뒤집힌 AABB는 slab 검사에서 겹치는 것으로 나올 수 있으므로 따로 제외
+			int32_t child = node.children[i];
+			if ((mask & (1 << i)) == 0 || child == nullNode)
+			{
+				continue;
+			}
+
+			if (child < nullNode)
+			{
+				RayCastInput subInput = input;
+				subInput.maxFraction = maxFraction;
+
+				float value = callback->rayCastCallback(subInput, decodeWideLeaf(child));
+				if (value == 0.0f)
+				{
+					return;
+				}
+				if (value > 0.0f)
+				{
+					maxFraction = value;
+				}
+			}
+			else
+			{
+				assert(stackCount < WIDE_QUERY_STACK_SIZE);
+				stack[stackCount++] = child;
+			}
+		}
+	}
+}
+
+template <typename T> inline void DynamicTree::rayCastBinary(T *callback, const RayCastInput &input) const
+{
+	const alglm::vec3 invD = getInverseDirection(input.p2 - input.p1);
+	float maxFraction = input.maxFraction;
+
+	GrowableStack<int32_t, BINARY_QUERY_STACK_SIZE> stack;
+	stack.push(m_root);
+
+	while (!stack.empty())
+	{
+		int32_t nodeId = stack.pop();
+		if (nodeId == nullNode)
+		{
+			continue;
+		}
+
+		const TreeNode &node = m_nodes[nodeId];
+		if (testRayOverlap(node.aabb.lowerBound, node.aabb.upperBound, input.p1, invD, input.radius, maxFraction) ==
+			false)
+		{
+			continue;
+		}
+
+		if (node.isLeaf())
+		{
+			RayCastInput subInput = input;
+			subInput.maxFraction = maxFraction;
+
+			float value = callback->rayCastCallback(subInput, nodeId);
+			if (value == 0.0f)
+			{
+				return;
+			}
+			if (value > 0.0f)
+			{
+				maxFraction = value;
+			}
+		}
+		else
+		{
+			stack.push(node.child1);
+			stack.push(node.child2);
+		}
+	}
+}
+} // namespace ale
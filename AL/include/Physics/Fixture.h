@@ -38,6 +38,7 @@ struct FixtureDef
 	float restitution;
 	bool isSensor;
 	int32_t touchNum;
+	CollisionFilter filter;
 };
 
 /**
@@ -97,6 +98,15 @@ class Fixture
 	 */
 	void synchronize(BroadPhase *broadPhase, const Transform &xf1, const Transform &xf2);
 
+	/**
+	 * @brief 스냅샷에 저장된 Proxy의 AABB와 Fat AABB로 되돌립니다.
+	 * @param broadPhase BroadPhase 객체.
+	 * @param childIndex 복원할 Proxy의 child 인덱스.
+	 * @param aabb Proxy에 저장할 AABB.
+	 * @param fatAABB 트리에 저장할 Fat AABB.
+	 */
+	void restoreProxy(BroadPhase *broadPhase, int32_t childIndex, const AABB &aabb, const AABB &fatAABB);
+
 	/**
 	 * @brief 마찰 계수를 반환합니다.
 	 * @return 마찰 계수.
@@ -133,6 +143,19 @@ class Fixture
 	 */
 	bool isSeonsor() const;
 
+	/**
+	 * @brief 충돌 필터를 반환합니다.
+	 * @return CollisionFilter 참조.
+	 */
+	const CollisionFilter &getFilter() const;
+
+	/**
+	 * @brief 충돌 필터를 변경합니다.
+	 * @details BroadPhase의 Proxy 필터를 갱신하고, 이 Fixture의 기존 Contact는 다음 step에서 다시 필터링합니다.
+	 * @param filter 새로운 충돌 필터.
+	 */
+	void setFilter(const CollisionFilter &filter);
+
 	/**
 	 * @brief 현재 터치(충돌) 횟수를 반환합니다.
 	 * @return 터치 횟수.
@@ -149,13 +172,47 @@ class Fixture
 	 */
 	void decreaseTouchNum();
 
+	/**
+	 * @brief 터치(충돌) 횟수를 설정합니다.
+	 * @param touchNum 설정할 터치 횟수.
+	 */
+	void setTouchNum(int32_t touchNum);
+
 	/**
 	 * @brief Fixture의 프록시 정보를 반환합니다.
 	 * @return FixtureProxy 포인터.
 	 */
 	const FixtureProxy *getFixtureProxy() const;
 
+	/**
+	 * @brief Fixture의 프록시 개수를 반환합니다.
+	 * @return FixtureProxy 개수.
+	 */
+	int32_t getProxyCount() const;
+
+	/**
+	 * @brief 주어진 Transform에서의 world space ConvexInfo를 반환합니다.
+	 * @details 마지막으로 계산한 Transform과 같으면 캐시된 값을 그대로 반환하므로,
+	 *          한 step 안에서 같은 Fixture를 사용하는 모든 contact가 한 번 계산한 결과를 공유합니다.
+	 * @param transform Body의 Transform.
+	 * @return ConvexInfo 참조. 다음 호출에서 Transform이 바뀌면 갱신됩니다.
+	 */
+	const ConvexInfo &getConvexInfo(const Transform &transform);
+
+	/**
+	 * @brief Body의 현재 Transform에서 Shape에 Ray(또는 구)를 쏘아 첫 충돌 지점을 계산합니다.
+	 * @param output 충돌 결과를 저장할 포인터.
+	 * @param input Ray cast 입력 정보.
+	 * @return 충돌하면 true.
+	 */
+	bool rayCast(RayCastOutput *output, const RayCastInput &input) const;
+
   protected:
+	/**
+	 * @brief 캐시된 ConvexInfo의 메모리를 해제합니다.
+	 */
+	void freeConvexInfo();
+
 	Rigidbody *m_body;
 	Shape *m_shape;
 	float m_density;
@@ -163,9 +220,14 @@ class Fixture
 	float m_restitution;
 	bool m_isSensor;
 	int32_t m_touchNum;
+	CollisionFilter m_filter;
 
 	FixtureProxy *m_proxies;
 	int32_t m_proxyCount;
+
+	ConvexInfo m_convexInfo;
+	Transform m_convexTransform;
+	bool m_hasConvexInfo;
 	// void *userData;
 
   private:
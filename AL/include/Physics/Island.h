@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Physics/Contact/Contact.h"
+#include "Memory/StackAllocator.h"
 
 namespace ale
 {
@@ -30,8 +31,6 @@ struct Velocity
 {
 	alglm::vec3 linearVelocity;
 	alglm::vec3 angularVelocity;
-	alglm::vec3 linearVelocityBuffer;
-	alglm::vec3 angularVelocityBuffer;
 };
 
 /**
@@ -44,21 +43,25 @@ class Island
   public:
 	/**
 	 * @brief Island 생성자.
-	 * @param bodyCount 포함할 Rigidbody 개수.
-	 * @param contactCount 포함할 Contact 개수.
+	 * @details Island는 World가 할당한 body/contact 배열의 일부 구간을 사용합니다.
+	 * @param bodies Island의 Rigidbody들이 저장될 배열의 시작 위치.
+	 * @param contacts Island의 Contact들이 저장될 배열의 시작 위치.
 	 */
-	Island(int32_t bodyCount, int32_t contactCount);
+	Island(Rigidbody **bodies, Contact **contacts);
 
 	/**
 	 * @brief Island 내의 물리 연산을 해결합니다.
+	 * @details 다른 Island와 동시에 실행될 수 있으므로 BroadPhase는 건드리지 않습니다.
 	 * @param duration 시뮬레이션 시간 간격.
+	 * @param allocator 연산에 사용할 워커 전용 스택 할당자.
 	 */
-	void solve(float duration);
+	void solve(float duration, StackAllocator &allocator);
 
 	/**
-	 * @brief Island를 정리하고 할당된 자원을 해제합니다.
+	 * @brief solve 이후 Island에 속한 body들의 Fixture를 BroadPhase에 동기화합니다.
+	 * @details BroadPhase는 스레드 안전하지 않으므로 모든 Island의 solve가 끝난 뒤 메인 스레드에서 호출합니다.
 	 */
-	void destroy();
+	void synchronizeFixtures();
 
 	/**
 	 * @brief Rigidbody를 Island에 추가합니다.
@@ -73,9 +76,11 @@ class Island
 	void add(Contact *contact);
 
 	/**
-	 * @brief Island의 모든 객체를 초기화합니다.
+	 * @brief Island 구성이 끝난 뒤 Contact들에 Island 내부 인덱스를 기록합니다.
+	 * @details staticBody는 여러 Island에 속할 수 있어 body의 islandIndex가 다음 Island 구성 시 덮어써지므로,
+	 *          구성 직후의 인덱스를 Contact에 저장해 둡니다.
 	 */
-	void clear();
+	void bindContactIndices();
 
 	static const int32_t VELOCITY_ITERATION;
 	static const int32_t POSITION_ITERATION;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ale
+{
+/**
+ * @file
+ * @brief 물리 step의 작업량과 단계별 소요 시간을 저장하는 PhysicsStats 구조체 정의.
+ */
+
+const int32_t ISLAND_HISTOGRAM_SIZE = 8; /**< Island 크기 히스토그램 구간 개수 */
+
+/**
+ * @struct PhysicsStats
+ * @brief 마지막 물리 step의 작업량과 단계별 소요 시간.
+ * @details 고정 timestep으로 한 프레임에 여러 step을 실행하면 마지막 step의 값만 남습니다. 시간은 모두 밀리초
+ *          단위입니다.
+ */
+struct PhysicsStats
+{
+	int32_t bodyCount;			  /**< 전체 Rigidbody 개수 */
+	int32_t awakeBodyCount;		  /**< 적분한 깨어 있는 Rigidbody 개수 */
+	int32_t pairCount;			  /**< BroadPhase가 찾은 중복 없는 후보 Pair 개수 */
+	int32_t reinsertCount;		  /**< Fat AABB를 벗어나 트리에 다시 삽입된 Proxy 개수 */
+	int32_t newContactCount;	  /**< 이번 step에 새로 생성된 Contact 개수 */
+	int32_t contactCount;		  /**< narrowphase가 끝난 뒤의 전체 Contact 개수 */
+	int32_t touchingContactCount; /**< 실제로 닿아 있는 Contact 개수 */
+	int32_t gjkIterations;		  /**< 모든 Contact의 GJK 반복 횟수 합 */
+	int32_t epaFaces;			  /**< 모든 Contact의 EPA 종료 시 polytope 면 개수 합 */
+	int32_t islandCount;		  /**< solve한 Island 개수 */
+	int32_t largestIslandSize;	  /**< 가장 큰 Island의 body 개수 */
+
+	/**
+	 * @brief body 개수별 Island 개수.
+	 * @details i번째 구간은 body 개수가 2^i 이상 2^(i+1) 미만인 Island 수이며, 마지막 구간은 그 이상을 모두
+	 *          포함합니다.
+	 */
+	int32_t islandSizeHistogram[ISLAND_HISTOGRAM_SIZE];
+
+	float integrateTime;   /**< 외력 적용, 적분, Proxy 동기화 시간 */
+	float broadPhaseTime;  /**< 새 Pair 탐색과 Contact 생성 시간 */
+	float narrowPhaseTime; /**< Contact 충돌 검사와 Manifold 생성 시간 */
+	float islandTime;	   /**< Island 생성 시간 (병렬 solve와 겹치는 구간 포함) */
+	float solveTime;	   /**< Island solve 대기와 Proxy 동기화 시간 */
+	float toiTime;		   /**< bullet 연속 충돌 처리 시간 */
+	float stepTime;		   /**< runPhysics 전체 시간 */
+};
+} // namespace ale
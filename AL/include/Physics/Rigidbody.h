@@ -1,7 +1,8 @@
 #pragma once
 
-#include <queue>
+#include <vector>
 
+#include "Physics/BodyData.h"
 #include "Physics/Shape/BoxShape.h"
 #include "Physics/Shape/SphereShape.h"
 
@@ -61,10 +62,14 @@ struct BodyDef
 		m_canSleep = true;
 		m_isAwake = true;
 		m_useGravity = true;
+		m_isBullet = false;
+		m_userData = 0;
 		m_type = EBodyType::STATIC_BODY;
 		m_gravityScale = 15.0f;
-		alglm::vec3 m_posFreeze = alglm::vec3(1.0f);
-		alglm::vec3 m_rotFreeze = alglm::vec3(1.0f);
+		m_posFreeze = alglm::vec3(1.0f);
+		m_rotFreeze = alglm::vec3(1.0f);
+		m_aabbMargin = -1.0f;
+		m_aabbPredictionFactor = -1.0f;
 	}
 
 	EBodyType m_type;
@@ -82,14 +87,51 @@ struct BodyDef
 	bool m_canSleep;
 	bool m_isAwake;
 	bool m_useGravity;
+	bool m_isBullet;
+	uint64_t m_userData;
 	// void *userData;
 	float m_gravityScale;
+	float m_aabbMargin;			  /**< Fat AABB 여백 (음수이면 World 기본값 사용) */
+	float m_aabbPredictionFactor; /**< Fat AABB 이동 예측 배수 (음수이면 World 기본값 사용) */
 	int32_t m_xfId;
 };
 
+/**
+ * @struct BodyHandle
+ * @brief World가 발급하는 Rigidbody의 고정 핸들.
+ * @details index는 World의 핸들 슬롯이며, body가 제거된 뒤 슬롯이 재사용되면 generation이 달라져
+ *          이전 핸들은 무효가 됩니다.
+ */
+struct BodyHandle
+{
+	int32_t index = -1;
+	int32_t generation = 0;
+};
+
+/**
+ * @struct BodyState
+ * @brief World 스냅샷에 저장하는 Rigidbody의 시뮬레이션 상태.
+ * @details 질량, 형태처럼 생성 후 바뀌지 않는 값은 저장하지 않습니다.
+ */
+struct BodyState
+{
+	int32_t bodyId;	 /**< 복원할 Rigidbody가 같은지 확인하는 ID */
+	Transform xf;
+	Transform previousXf;
+	Sweep sweep;
+	alglm::vec3 linearVelocity;
+	alglm::vec3 angularVelocity;
+	alglm::vec3 acceleration;
+	float sleepTime;
+	bool isAwake;
+	int32_t forceCount; /**< 다음 step에 적용할 등록된 외력 개수 */
+};
+
 /**
  * @class Rigidbody
  * @brief 물리 엔진에서 강체(Rigidbody)의 동작을 담당하는 클래스.
+ * @details Transform, 속도, 누적 힘 같은 매 step 접근하는 상태는 World의 BodyData 배열에 저장하고,
+ *          Rigidbody는 그 인덱스와 Fixture, 외력 목록 같은 나머지 데이터를 가집니다.
  */
 class Rigidbody
 {
@@ -98,8 +140,10 @@ class Rigidbody
 	 * @brief Rigidbody 생성자.
 	 * @param bd Rigidbody 설정 정보.
 	 * @param world Rigidbody가 속할 물리 월드.
+	 * @param data 상태를 저장할 World의 BodyData.
+	 * @param dataIndex BodyData에서 이 Rigidbody 상태의 인덱스.
 	 */
-	Rigidbody(const BodyDef *bd, World *world);
+	Rigidbody(const BodyDef *bd, World *world, BodyData *data, int32_t dataIndex);
 
 	/**
 	 * @brief Rigidbody 소멸자.
@@ -118,9 +162,6 @@ class Rigidbody
 	/** @brief 외부에서 가해지는 토크(회전력)를 추가합니다. */
 	void addTorque(const alglm::vec3 &torque);
 
-	/** @brief 중력을 추가합니다. */
-	void addGravity();
-
 	/** @brief Rigidbody의 운동 방정식을 적용합니다. */
 	void integrate(float duration);
 
@@ -133,6 +174,9 @@ class Rigidbody
 	/** @brief 새로운 충돌 형태(Fixture)를 추가합니다. */
 	void createFixture(Shape *shape);
 
+	/** @brief 모든 Fixture의 Proxy를 BroadPhase에서 제거합니다. */
+	void destroyFixtureProxies();
+
 	/** @brief 새로운 충돌 형태(Fixture)를 추가합니다. */
 	void createFixture(const FixtureDef *fd);
 
@@ -175,9 +219,39 @@ class Rigidbody
 	/** @brief Rigidbody의 타입을 반환합니다. */
 	EBodyType getType() const;
 
+	/** @brief 사용자 데이터를 반환합니다. (Scene에서는 Entity UUID) */
+	uint64_t getUserData() const;
+
 	/** @brief Rigidbody가 포함된 ContactLink 리스트를 반환합니다. */
 	ContactLink *getContactLinks();
 
+	/** @brief Rigidbody가 속한 World를 반환합니다. */
+	World *getWorld() const;
+
+	/** @brief World가 발급한 핸들을 반환합니다. */
+	BodyHandle getHandle() const;
+
+	/**
+	 * @brief Fixture Proxy의 Fat AABB 설정을 지정합니다.
+	 * @details 빠르게 움직이는 body는 예측 배수를 키워 재삽입을 줄이고, 밀집한 body는 여백을 줄여 후보 Pair를
+	 *          줄입니다. 음수를 넘기면 World 기본값을 사용합니다. 다음 재삽입부터 적용됩니다.
+	 * @param margin Fat AABB 여백.
+	 * @param predictionFactor 이동 방향으로 Fat AABB를 늘릴 step 이동량의 배수.
+	 */
+	void setAABBSettings(float margin, float predictionFactor);
+
+	/** @brief Fat AABB 여백을 반환합니다. (body 설정이 없으면 World 기본값) */
+	float getAABBMargin() const;
+
+	/** @brief Fat AABB 이동 예측 배수를 반환합니다. (body 설정이 없으면 World 기본값) */
+	float getAABBPredictionFactor() const;
+
+	/** @brief World가 발급한 핸들을 설정합니다. */
+	void setHandle(BodyHandle handle);
+
+	/** @brief BodyData에서 옮겨진 상태의 인덱스를 설정합니다. */
+	void setDataIndex(int32_t dataIndex);
+
 	/**
 	 * @brief Rigidbody의 특정 로컬 좌표를 월드 좌표계로 변환합니다.
 	 * @param point 변환할 로컬 좌표.
@@ -197,6 +271,19 @@ class Rigidbody
 	/** @brief Rigidbody의 변환 행렬을 반환합니다. */
 	const alglm::mat4 &getTransformMatrix() const;
 
+	/** @brief 다음 고정 step 전에 현재 Transform을 이전 Transform으로 저장합니다. */
+	void storePreviousTransform();
+
+	/** @brief storePreviousTransform으로 저장한 이전 step의 Transform을 반환합니다. */
+	const Transform &getPreviousTransform() const;
+
+	/**
+	 * @brief 이전 step과 현재 step의 Transform을 보간하여 반환합니다.
+	 * @param alpha 보간 비율 (0: 이전 Transform, 1: 현재 Transform).
+	 * @return 보간된 Transform.
+	 */
+	Transform getInterpolatedTransform(float alpha) const;
+
 	/** @brief Rigidbody의 선형 속도를 반환합니다. */
 	const alglm::vec3 &getLinearVelocity() const;
 
@@ -285,11 +372,21 @@ class Rigidbody
 	void setAngularVelocity(alglm::vec3 &angularVelocity);
 
 	/**
-	 * @brief Rigidbody를 수면(비활성) 상태로 설정합니다.
-	 * @param duration 수면 상태로 유지할 시간.
+	 * @brief 정지 상태로 보낸 시간을 누적합니다.
+	 * @details 실제로 잠드는 것은 Island 전체의 누적 시간이 START_SLEEP_TIME을 넘었을 때입니다.
+	 * @param duration 누적할 시간.
 	 */
 	void setSleep(float duration);
 
+	/** @brief 정지 상태로 보낸 누적 시간을 반환합니다. */
+	float getSleepTime() const;
+
+	/**
+	 * @brief Rigidbody를 수면(비활성) 상태로 전환합니다.
+	 * @details 속도를 0으로 만들고, 깨어날 때까지 적분, 충돌 갱신, Island solve에서 제외됩니다.
+	 */
+	void sleep();
+
 	/** @brief Rigidbody를 활성 상태로 설정합니다. */
 	void setAwake();
 
@@ -305,50 +402,79 @@ class Rigidbody
 	/** @brief Rigidbody가 센서인지 확인*/
 	bool isSensor() const;
 
+	/** @brief 연속 충돌 검사(CCD)를 수행하는 bullet인지 여부를 반환합니다. */
+	bool isBullet() const;
+
+	/**
+	 * @brief 연속 충돌 검사(CCD) 사용 여부를 설정합니다.
+	 * @details bullet은 step 이동 경로 전체에 대해 충돌 시간(TOI)을 계산하므로 빠르게 움직여도 얇은 물체를 통과하지
+	 *          않습니다.
+	 * @param flag bullet이면 true.
+	 */
+	void setBullet(bool flag);
+
 	int32_t getTouchNum() const;
 
+	/** @brief Fixture 배열을 반환합니다. */
+	Fixture *getFixtures();
+
+	/** @brief Fixture 개수를 반환합니다. */
+	int32_t getFixtureCount() const;
+
+	/**
+	 * @brief 스냅샷에 저장할 시뮬레이션 상태를 기록합니다.
+	 * @param state 상태를 기록할 구조체. forceCount에는 getRegisteredForces()의 개수가 기록됩니다.
+	 */
+	void getState(BodyState &state) const;
+
+	/**
+	 * @brief 스냅샷의 시뮬레이션 상태로 되돌립니다.
+	 * @details 변환 행렬과 world 관성 텐서도 다시 계산합니다. Fixture Proxy와 Contact는 World가 복원합니다.
+	 * @param state 복원할 상태.
+	 * @param forces 다음 step에 적용할 등록된 외력 배열 (state.forceCount개).
+	 */
+	void setState(const BodyState &state, const alglm::vec3 *forces);
+
+	/** @brief 다음 step에 적용할 등록된 외력 목록을 반환합니다. */
+	const std::vector<alglm::vec3> &getRegisteredForces() const;
+
 	Rigidbody *next;
 	Rigidbody *prev;
 
+	static const float START_SLEEP_TIME; /**< Island가 잠들기 위해 정지해 있어야 하는 시간 */
+
   protected:
+	/** @brief useGravity와 gravityScale로 BodyData의 중력 가속도를 갱신합니다. */
+	void updateGravity();
+
 	static int32_t BODY_COUNT;
-	static const float START_SLEEP_TIME;
 
 	World *m_world;
+	BodyData *m_data;
+	int32_t m_dataIndex;
 
-	Sweep m_sweep;
-	Transform m_xf;
-	alglm::vec3 m_linearVelocity;
-	alglm::vec3 m_angularVelocity;
-	alglm::mat3 m_inverseInertiaTensorWorld;
-	alglm::mat3 m_inverseInertiaTensor;
-	alglm::mat4 m_transformMatrix;
-	alglm::vec3 m_forceAccum;
-	alglm::vec3 m_torqueAccum;
-	alglm::vec3 m_acceleration;
-	alglm::vec3 m_lastFrameAcceleration;
-	std::queue<alglm::vec3> m_forceRegistry;
+	Transform m_previousXf; // 렌더링 보간용 이전 step의 Transform
+	std::vector<alglm::vec3> m_forceRegistry;
 
 	int32_t m_fixtureCount;
 	Fixture *m_fixtures = nullptr;
 
 	// float motion;
-	bool m_isAwake;
 	bool m_canSleep;
 	bool m_useGravity;
+	bool m_isBullet;
 	float m_sleepTime;
 
-	float m_inverseMass;
-	float m_linearDamping;
-	float m_angularDamping;
 	float m_gravityScale;
+	float m_aabbMargin;
+	float m_aabbPredictionFactor;
 	int32_t m_xfId;
 	int32_t m_flags;
 	int32_t m_islandIndex;
 	int32_t m_bodyID;
+	BodyHandle m_handle;
+	uint64_t m_userData;
 	EBodyType m_type;
-	alglm::vec3 m_posFreeze;
-	alglm::vec3 m_rotFreeze;
 
 	ContactLink *m_contactLinks;
 
@@ -33,6 +33,12 @@ class BoxShape : public Shape
 	 */
 	BoxShape *clone() const;
 
+	/**
+	 * @brief BoxShape 객체의 크기를 반환합니다.
+	 * @return 객체 크기 (바이트 단위).
+	 */
+	int32_t getSize() const;
+
 	/**
 	 * @brief 자식(하위) 충돌 개수를 반환합니다.
 	 * @return 자식 충돌 개수.
@@ -60,6 +66,15 @@ class BoxShape : public Shape
 	 */
 	virtual ConvexInfo getShapeInfo(const Transform &transform) const override;
 
+	/**
+	 * @brief Ray(또는 구)를 Shape에 쏘아 첫 충돌 지점을 계산합니다.
+	 * @param output 충돌 결과를 저장할 포인터.
+	 * @param input Ray cast 입력 정보.
+	 * @param xf Shape가 속한 Body의 Transform.
+	 * @return 충돌하면 true.
+	 */
+	virtual bool rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const override;
+
 	// Vertex Info needed
 	std::set<alglm::vec3, Vec3Comparator> m_vertices;
 	alglm::vec3 m_halfSize;
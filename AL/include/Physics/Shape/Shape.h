@@ -57,6 +57,35 @@ int32_t operator|(EType type1, EType type2);
 
 struct ConvexInfo;
 
+/**
+ * @brief 선분과 구의 첫 교차 지점을 계산합니다.
+ * @details 시작점이 구 내부에 있으면 교차하지 않은 것으로 처리합니다.
+ * @param output 교차 결과를 저장할 포인터.
+ * @param p1 선분의 시작점.
+ * @param d 선분의 방향 벡터 (p2 - p1).
+ * @param maxFraction 검사할 최대 비율.
+ * @param center 구의 중심.
+ * @param radius 구의 반지름.
+ * @return 교차하면 true.
+ */
+bool rayCastSphere(RayCastOutput *output, const alglm::vec3 &p1, const alglm::vec3 &d, float maxFraction,
+				   const alglm::vec3 &center, float radius);
+
+/**
+ * @brief 선분과 캡슐(a에서 b까지의 선분을 반지름만큼 부풀린 형태)의 첫 교차 지점을 계산합니다.
+ * @details 시작점이 캡슐 내부에 있으면 교차하지 않은 것으로 처리합니다.
+ * @param output 교차 결과를 저장할 포인터.
+ * @param p1 선분의 시작점.
+ * @param d 선분의 방향 벡터 (p2 - p1).
+ * @param maxFraction 검사할 최대 비율.
+ * @param a 캡슐 중심선의 한쪽 끝점.
+ * @param b 캡슐 중심선의 다른 쪽 끝점.
+ * @param radius 캡슐의 반지름.
+ * @return 교차하면 true.
+ */
+bool rayCastCapsule(RayCastOutput *output, const alglm::vec3 &p1, const alglm::vec3 &d, float maxFraction,
+					const alglm::vec3 &a, const alglm::vec3 &b, float radius);
+
 /**
  * @class Shape
  * @brief 모든 충돌 형태(Shape)의 기본 클래스.
@@ -77,6 +106,13 @@ class Shape
 	 */
 	virtual Shape *clone() const = 0;
 
+	/**
+	 * @brief 실제 Shape 객체의 크기를 반환합니다.
+	 * @details clone()이 할당한 블록을 같은 크기로 해제할 때 사용합니다.
+	 * @return 객체 크기 (바이트 단위).
+	 */
+	virtual int32_t getSize() const = 0;
+
 	/**
 	 * @brief 자식(하위) 충돌 개수를 반환합니다.
 	 * @return 자식 충돌 개수.
@@ -97,6 +133,16 @@ class Shape
 	 */
 	virtual ConvexInfo getShapeInfo(const Transform &transform) const = 0;
 
+	/**
+	 * @brief Ray(또는 input.radius 반지름의 구)를 Shape에 쏘아 첫 충돌 지점을 계산합니다.
+	 * @details 시작점이 Shape 내부에 있으면 충돌하지 않은 것으로 처리합니다.
+	 * @param output 충돌 결과를 저장할 포인터.
+	 * @param input Ray cast 입력 정보.
+	 * @param xf Shape가 속한 Body의 Transform.
+	 * @return 충돌하면 true.
+	 */
+	virtual bool rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const = 0;
+
 	/**
 	 * @brief Shape의 유형(Type)을 반환합니다.
 	 * @return Shape의 유형(EType).
@@ -35,6 +35,12 @@ class SphereShape : public Shape
 	 */
 	SphereShape *clone() const;
 
+	/**
+	 * @brief SphereShape 객체의 크기를 반환합니다.
+	 * @return 객체 크기 (바이트 단위).
+	 */
+	int32_t getSize() const;
+
 	/**
 	 * @brief 자식(하위) 충돌 개수를 반환합니다.
 	 * @return 자식 충돌 개수.
@@ -62,6 +68,15 @@ class SphereShape : public Shape
 	 */
 	virtual ConvexInfo getShapeInfo(const Transform &transform) const override;
 
+	/**
+	 * @brief Ray(또는 구)를 Shape에 쏘아 첫 충돌 지점을 계산합니다.
+	 * @param output 충돌 결과를 저장할 포인터.
+	 * @param input Ray cast 입력 정보.
+	 * @param xf Shape가 속한 Body의 Transform.
+	 * @return 충돌하면 true.
+	 */
+	virtual bool rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const override;
+
 	float m_radius;
 };
 } // namespace ale
\ No newline at end of file
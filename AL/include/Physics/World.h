@@ -1,8 +1,10 @@
 #pragma once
 
+#include "Core/JobSystem.h"
 #include "Physics/Contact/ContactManager.h"
 #include "Physics/Island.h"
 
+#include <memory>
 #include <stack>
 
 class Model;
@@ -20,6 +22,30 @@ class SphereShape;
  * @brief 물리 시뮬레이션을 관리하는 World 클래스 정의.
  */
 
+/**
+ * @struct RayCastHit
+ * @brief World 쿼리의 충돌 결과를 저장하는 구조체.
+ */
+struct RayCastHit
+{
+	Rigidbody *body;	/**< 충돌한 Rigidbody. 충돌하지 않았으면 nullptr */
+	Fixture *fixture;	/**< 충돌한 Fixture */
+	alglm::vec3 point;	/**< 충돌 지점 */
+	alglm::vec3 normal; /**< 충돌 지점의 표면 법선 */
+	float distance;		/**< 시작점에서 충돌할 때까지 이동한 거리 */
+};
+
+/**
+ * @struct Ray
+ * @brief 일괄 ray cast에 사용하는 ray 정보.
+ */
+struct Ray
+{
+	alglm::vec3 origin;	   /**< 시작점 */
+	alglm::vec3 direction; /**< 방향 (정규화하지 않아도 됨) */
+	float maxDistance;	   /**< 최대 거리 */
+};
+
 /**
  * @class World
  * @brief 물리 시뮬레이션을 관리하는 클래스.
@@ -30,9 +56,16 @@ class World
   public:
 	/**
 	 * @brief World 기본 생성자.
+	 * @details 하드웨어 스레드 개수만큼 Island solve 워커를 생성합니다.
 	 */
 	World();
 
+	/**
+	 * @brief Island solve에 사용할 워커 개수를 지정하는 World 생성자.
+	 * @param workerCount 메인 스레드를 포함한 워커 개수. 0 이하이면 하드웨어 스레드 개수를 사용합니다.
+	 */
+	explicit World(int32_t workerCount);
+
 	/**
 	 * @brief World 소멸자.
 	 */
@@ -49,18 +82,97 @@ class World
 	 */
 	void runPhysics(float duration);
 
+	/**
+	 * @brief 프레임 시간만큼 시뮬레이션을 진행합니다.
+	 * @details 고정 timestep 모드에서는 프레임 시간을 누적하여 고정 간격으로 최대 getMaxSubSteps()번 runPhysics를
+	 *          실행하고, 남은 시간 비율을 보간 비율로 저장합니다. 고정 timestep 모드가 아니면 프레임 시간으로 한 번
+	 *          실행합니다.
+	 * @param frameTime 이번 프레임의 시간 간격.
+	 * @return 이번 프레임에 실행한 step 횟수.
+	 */
+	int32_t step(float frameTime);
+
 	/**
 	 * @brief 충돌 및 물리 해석을 해결합니다.
+	 * @details DFS로 완성된 Island를 즉시 JobSystem에 제출하여 Island들을 병렬로 solve 합니다.
 	 * @param duration 시간 간격.
 	 */
 	void solve(float duration);
 
+	/**
+	 * @brief bullet Rigidbody의 연속 충돌을 해결합니다.
+	 * @details island solve가 끝난 뒤, bullet이 이전 step Transform에서 현재 Transform까지 이동하는 동안 contact
+	 *          상대와 처음 닿는 시간(TOI)을 Conservative Advancement로 계산합니다. 충돌하면 bullet을 TOI 위치로 되돌리고
+	 *          반발 충격량을 적용합니다.
+	 */
+	void solveTOI();
+
+	/**
+	 * @brief 핸들에 해당하는 Rigidbody를 반환합니다.
+	 * @details 핸들 슬롯에서 dense 배열 인덱스를 찾으므로 O(1)입니다.
+	 * @param handle createBody가 발급한 핸들.
+	 * @return Rigidbody 포인터. 제거되었거나 잘못된 핸들이면 nullptr.
+	 */
+	Rigidbody *getBody(BodyHandle handle) const;
+
 	/**
 	 * @brief 특정 Rigidbody에 외력을 등록합니다.
-	 * @param idx 적용할 Rigidbody의 인덱스.
+	 * @param handle 적용할 Rigidbody의 핸들. 무효한 핸들은 무시합니다.
 	 * @param force 적용할 외력 벡터.
 	 */
-	void registerBodyForce(int32_t idx, const alglm::vec3 &force);
+	void registerBodyForce(BodyHandle handle, const alglm::vec3 &force);
+
+	/**
+	 * @brief 여러 Rigidbody에 외력을 한 번에 등록합니다.
+	 * @param handles 적용할 Rigidbody 핸들 배열.
+	 * @param forces handles[i]에 적용할 외력 배열.
+	 * @param count 배열 길이.
+	 */
+	void registerBodyForces(const BodyHandle *handles, const alglm::vec3 *forces, int32_t count);
+
+	/**
+	 * @brief ray를 쏘아 가장 먼저 닿는 Rigidbody를 찾습니다.
+	 * @details sensor Fixture는 무시합니다. 시작점이 Shape 내부에 있으면 해당 Shape는 충돌하지 않은 것으로 봅니다.
+	 * @param origin 시작점.
+	 * @param direction 방향 (정규화하지 않아도 됨).
+	 * @param maxDistance 최대 거리.
+	 * @param hit 충돌 결과를 저장할 구조체.
+	 * @return 충돌하면 true.
+	 */
+	bool rayCast(const alglm::vec3 &origin, const alglm::vec3 &direction, float maxDistance, RayCastHit &hit);
+
+	/**
+	 * @brief 구를 이동시켜 가장 먼저 닿는 Rigidbody를 찾습니다.
+	 * @details hit.point는 구 표면의 충돌 지점입니다. 박스는 모서리를 둥글게 처리한 정확한 형태와, 실린더는
+	 *          반지름과 높이를 늘린 실린더와 검사합니다.
+	 * @param origin 구 중심의 시작점.
+	 * @param radius 구의 반지름.
+	 * @param direction 방향 (정규화하지 않아도 됨).
+	 * @param maxDistance 최대 거리.
+	 * @param hit 충돌 결과를 저장할 구조체.
+	 * @return 충돌하면 true.
+	 */
+	bool sphereCast(const alglm::vec3 &origin, float radius, const alglm::vec3 &direction, float maxDistance,
+					RayCastHit &hit);
+
+	/**
+	 * @brief AABB와 겹치는 Rigidbody를 찾습니다.
+	 * @details BroadPhase에 등록된 Fixture의 AABB를 기준으로 검사하며 sensor Fixture는 무시합니다.
+	 * @param aabb 검사할 AABB.
+	 * @param bodies 겹치는 Rigidbody를 저장할 배열. 기존 내용은 지워집니다.
+	 * @return 겹치는 Rigidbody 개수.
+	 */
+	int32_t overlapAABB(const AABB &aabb, std::vector<Rigidbody *> &bodies);
+
+	/**
+	 * @brief 여러 ray를 한 번에 쏩니다.
+	 * @details ray 개수가 많으면 JobSystem 워커에 나누어 병렬로 처리합니다.
+	 * @param rays ray 배열.
+	 * @param count ray 개수.
+	 * @param hits 각 ray의 충돌 결과를 저장할 배열. 충돌하지 않은 ray는 body가 nullptr입니다.
+	 * @return 충돌한 ray 개수.
+	 */
+	int32_t rayCastBatch(const Ray *rays, int32_t count, RayCastHit *hits);
 
 	/**
 	 * @brief 새로운 Rigidbody를 생성합니다.
@@ -69,6 +181,14 @@ class World
 	 */
 	Rigidbody *createBody(BodyDef &bdDef);
 
+	/**
+	 * @brief Rigidbody를 제거합니다.
+	 * @details Rigidbody의 Contact와 BroadPhase Proxy를 모두 제거한 뒤 메모리를 반환합니다. step 도중에는 호출할 수
+	 *          없습니다.
+	 * @param body 제거할 Rigidbody.
+	 */
+	void destroyBody(Rigidbody *body);
+
 	/**
 	 * @brief 현재 World에 존재하는 Rigidbody 리스트의 시작 포인터를 반환합니다.
 	 * @return Rigidbody 리스트의 시작 포인터.
@@ -78,10 +198,200 @@ class World
 		return m_rigidbodies;
 	}
 
+	/**
+	 * @brief Island solve에 사용하는 워커 개수를 반환합니다.
+	 * @return 메인 스레드를 포함한 워커 개수.
+	 */
+	int32_t getWorkerCount() const;
+
+	/**
+	 * @brief 마지막 step의 물리 통계를 반환합니다.
+	 * @details runPhysics를 실행할 때마다 갱신되며, 각 단계는 Instrumentor 세션이 열려 있으면 Chrome trace에도
+	 *          기록됩니다.
+	 * @return 마지막 step의 PhysicsStats.
+	 */
+	const PhysicsStats &getStats() const;
+
+	/**
+	 * @brief World와 워커들의 스택 할당자 사용량을 합쳐 반환합니다.
+	 * @details capacity와 overflowCount는 합계, highWater는 할당자 하나의 최대값입니다. 가장 큰 씬에서 측정한
+	 *          highWater로 STACK_SIZE를 정하면 step 도중 블록을 추가하지 않습니다.
+	 * @return 스택 할당자 통계.
+	 */
+	StackAllocatorStats getStackAllocatorStats() const;
+
+	/**
+	 * @brief 결정론적 모드 사용 여부를 설정합니다.
+	 * @details 결정론적 모드에서는 Island를 생성 순서대로 호출한 스레드에서 solve하여, 같은 빌드와 같은 입력이면
+	 *          워커 개수나 스레드 스케줄링과 관계없이 매번 같은 결과를 냅니다.
+	 * @param enabled 사용하면 true.
+	 */
+	void setDeterministic(bool enabled);
+
+	/** @brief 결정론적 모드 사용 여부를 반환합니다. */
+	bool isDeterministic() const;
+
+	/**
+	 * @brief BroadPhase 트리의 품질 유지 정책을 설정합니다.
+	 * @details 기본값은 둘 다 0으로 꺼져 있습니다.
+	 * @param rotationBudget step마다 회전을 시도할 내부 노드 수.
+	 * @param rebuildAreaRatio 트리 전체를 다시 만들 표면적 비율 (내부 노드 표면적 합 / 루트 표면적)의 마지막 SAH 재구성
+	 *        직후 값에 대한 배율.
+	 */
+	void setBroadPhaseOptimization(int32_t rotationBudget, float rebuildAreaRatio);
+
+	/**
+	 * @brief BroadPhase 트리의 품질 지표를 계산합니다.
+	 * @return 표면적 비율, 높이, Proxy 개수.
+	 */
+	TreeQuality getBroadPhaseQuality() const;
+
+	/**
+	 * @brief BroadPhase 트리 전체를 SAH로 다시 만듭니다.
+	 * @details 씬 로드처럼 많은 body를 한 번에 생성한 뒤 호출합니다.
+	 */
+	void rebuildBroadPhase();
+
+	/**
+	 * @brief 시뮬레이션 상태 전체를 바이너리 스냅샷으로 저장합니다.
+	 * @details Rigidbody 상태와 Sweep, Fixture Proxy의 AABB, BroadPhase move buffer, Contact와 Manifold를 리스트
+	 *          순서 그대로 기록합니다. 버퍼의 기존 내용은 지워지며, 같은 버퍼를 재사용하면 메모리를 다시 할당하지
+	 *          않습니다. step 도중에는 호출할 수 없습니다.
+	 * @param buffer 스냅샷을 기록할 버퍼.
+	 */
+	void saveState(std::vector<uint8_t> &buffer);
+
+	/**
+	 * @brief saveState로 저장한 스냅샷으로 시뮬레이션 상태를 되돌립니다.
+	 * @details 스냅샷을 저장한 뒤 Rigidbody를 생성하거나 제거하지 않은 World에서만 복원할 수 있습니다. Contact는
+	 *          리스트 순서가 저장할 때와 같도록 다시 생성되므로 복원 후 step 결과는 저장 시점에서 진행한 결과와
+	 *          비트 단위로 같습니다.
+	 * @param data 스냅샷 데이터.
+	 * @param size 스냅샷 크기 (바이트 단위).
+	 */
+	void restoreState(const uint8_t *data, size_t size);
+
+	/**
+	 * @brief 고정 timestep 모드 사용 여부를 설정합니다.
+	 * @param enabled 사용하면 true, 프레임 시간으로 한 번씩 실행하면 false.
+	 */
+	void setFixedTimestepEnabled(bool enabled);
+
+	/** @brief 고정 timestep 모드 사용 여부를 반환합니다. */
+	bool isFixedTimestepEnabled() const;
+
+	/**
+	 * @brief 고정 timestep의 초당 step 횟수를 설정합니다.
+	 * @param hz 초당 step 횟수.
+	 */
+	void setFixedTimestepHz(float hz);
+
+	/** @brief 고정 timestep의 초당 step 횟수를 반환합니다. */
+	float getFixedTimestepHz() const;
+
+	/**
+	 * @brief 한 프레임에 실행할 최대 step 횟수를 설정합니다.
+	 * @details 최대 횟수를 넘는 누적 시간은 버려서 프레임이 튀어도 물리 연산 비용이 늘어나지 않도록 합니다.
+	 * @param maxSubSteps 최대 step 횟수.
+	 */
+	void setMaxSubSteps(int32_t maxSubSteps);
+
+	/** @brief 한 프레임에 실행할 최대 step 횟수를 반환합니다. */
+	int32_t getMaxSubSteps() const;
+
+	/**
+	 * @brief Fat AABB 설정의 World 기본값을 지정합니다.
+	 * @details 여백이 크거나 예측 배수가 크면 Proxy 재삽입은 줄지만 후보 Pair가 늘어납니다. 개별 설정이 없는
+	 *          body에는 다음 재삽입부터 적용되며, PhysicsStats::reinsertCount와 pairCount로 조정 결과를 확인할 수
+	 *          있습니다.
+	 * @param margin Fat AABB 여백.
+	 * @param predictionFactor 이동 방향으로 Fat AABB를 늘릴 step 이동량의 배수.
+	 */
+	void setAABBSettings(float margin, float predictionFactor);
+
+	/** @brief Fat AABB 여백의 World 기본값을 반환합니다. */
+	float getAABBMargin() const;
+
+	/** @brief Fat AABB 이동 예측 배수의 World 기본값을 반환합니다. */
+	float getAABBPredictionFactor() const;
+
+	/**
+	 * @brief 마지막 step 이후 남은 누적 시간의 비율을 반환합니다.
+	 * @return Rigidbody::getInterpolatedTransform에 넘길 보간 비율 (0 ~ 1).
+	 */
+	float getInterpolationAlpha() const;
+
+	static const float DEFAULT_FIXED_TIMESTEP_HZ;
+	static const int32_t DEFAULT_MAX_SUB_STEPS;
+	static const float DEFAULT_AABB_MARGIN;
+	static const float DEFAULT_AABB_PREDICTION_FACTOR;
+	static const int32_t TOI_ITERATION;		 /**< Conservative Advancement 최대 반복 횟수 */
+	static const float TOI_TARGET_DISTANCE; /**< TOI 위치에서 두 물체 사이에 남길 거리 */
+	static const float TOI_TOLERANCE;		 /**< 목표 거리로 인정할 오차 */
+	static const int32_t RAY_CAST_BATCH_SIZE; /**< 일괄 ray cast에서 작업 하나가 처리할 ray 개수 */
+	static const uint32_t STATE_MAGIC;		  /**< 스냅샷 식별 값 */
+	static const uint32_t STATE_VERSION;	  /**< 스냅샷 형식 버전 */
+
 	ContactManager m_contactManager;
 
   private:
+	/**
+	 * @brief bullet과 contact 상대가 처음 닿는 시간을 계산합니다.
+	 * @param bullet 연속 충돌을 검사할 bullet Rigidbody.
+	 * @param contact bullet이 포함된 Contact.
+	 * @param toi 충돌 시간(0 ~ 1)을 저장할 변수.
+	 * @param normal bullet에서 상대를 향하는 충돌 법선을 저장할 벡터.
+	 * @return 이동 도중 충돌하면 true, 시작부터 닿아 있거나 충돌하지 않으면 false.
+	 */
+	bool computeTOI(Rigidbody *bullet, Contact *contact, float &toi, alglm::vec3 &normal);
+
+	/**
+	 * @brief 선분(또는 이동하는 구)과 가장 먼저 닿는 Fixture를 찾습니다.
+	 * @details 여러 워커에서 동시에 호출해도 안전하도록 World 상태를 바꾸지 않습니다.
+	 * @param origin 시작점.
+	 * @param direction 방향.
+	 * @param maxDistance 최대 거리.
+	 * @param radius 이동시킬 구의 반지름 (ray는 0).
+	 * @param hit 충돌 결과를 저장할 구조체.
+	 * @return 충돌하면 true.
+	 */
+	bool castClosest(const alglm::vec3 &origin, const alglm::vec3 &direction, float maxDistance, float radius,
+					 RayCastHit &hit) const;
+
+	/**
+	 * @struct BodySlot
+	 * @brief 핸들 index가 가리키는 슬롯. 사용 중이면 dense 배열 인덱스를, 비어 있으면 다음 빈 슬롯을 가집니다.
+	 */
+	struct BodySlot
+	{
+		int32_t denseIndex;
+		int32_t generation;
+		int32_t nextFree;
+	};
+
 	Rigidbody *m_rigidbodies;
 	int32_t m_rigidbodyCount;
+
+	std::vector<BodySlot> m_bodySlots;
+	std::vector<Rigidbody *> m_bodyArray; /**< 살아 있는 body의 dense 배열 (제거 시 마지막 원소로 채움) */
+	BodyData m_bodyData;				  /**< m_bodyArray와 같은 순서로 저장한 body 상태 배열 */
+	int32_t m_freeBodySlot;
+
+	std::unique_ptr<JobSystem> m_jobSystem;
+	StackAllocator m_stackAllocator; /**< Island 생성에 쓰는 메인 스레드 스택 할당자 */
+	std::vector<std::unique_ptr<StackAllocator>> m_workerStackAllocators; /**< 워커별 스택 할당자 */
+	std::vector<Island> m_islands;
+
+	bool m_isFixedTimestep;
+	float m_fixedTimestep;
+	int32_t m_maxSubSteps;
+	float m_accumulator;
+	float m_aabbMargin;
+	float m_aabbPredictionFactor;
+	float m_interpolationAlpha;
+	bool m_isDeterministic;
+	PhysicsStats m_stats;
+
+	std::vector<alglm::vec3> m_stateForces; /**< 스냅샷 복원 시 외력을 읽어 두는 버퍼 */
 };
 } // namespace ale
\ No newline at end of file
@@ -22,6 +22,8 @@
 #include "Scene/Scene.h"
 #include "Scene/SceneCamera.h"
 
+#include <memory_resource>
+
 namespace ale
 {
 /**
@@ -319,7 +321,8 @@ class Renderer
 
 	// shadowmap ssbo 추가 부분
 	std::vector<std::map<std::string, std::vector<alglm::mat4>>> m_shadowMapModels;
-	std::vector<std::map<uint32_t, std::vector<alglm::mat4>>> m_shadowMapMeshes;
+	using ShadowMapMeshes = std::pmr::map<uint32_t, std::pmr::vector<alglm::mat4>>;
+	std::vector<ShadowMapMeshes *> m_shadowMapMeshes; /**< FrameAllocator에 생성한 프레임별 mesh의 모델 행렬 */
 
 	std::unique_ptr<DescriptorSetLayout> m_shadowMapDescriptorSetLayoutSSBO;
 	VkDescriptorSetLayout shadowMapDescriptorSetLayoutSSBO;
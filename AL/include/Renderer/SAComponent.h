@@ -138,12 +138,12 @@ class SAComponent
 	 */
 	float getCurrentTime();
 	/** @brief 본 블렌드.
+	 * @details 블렌드 결과를 to에 저장하며, 본 개수가 다르면 to를 그대로 둡니다.
 	 * @param to 대상 본 벡터.
 	 * @param from 원본 본 벡터.
 	 * @param blendFactor 블렌드 계수.
-	 * @return 블렌드된 본 벡터.
 	 */
-	Bones blendBones(Bones& to, Bones& from, float blendFactor);
+	void blendBones(Bones& to, const Bones& from, float blendFactor);
 	/** @brief SAData 반환.
 	 * @param index 인덱스 (기본값 0).
 	 * @return SAData 구조체.
@@ -210,6 +210,7 @@ private:
 	std::vector<bool> m_Repeats;                                             /**< 각 애니메이션 별 반복 벡터 */
 	uint32_t m_FrameCounter;                                                 /**< 프레임 카운터 */
 	Bones m_CapturedPose;                                                    /**< 캡처된 포즈 */
+	Bones m_BlendPose;                                                       /**< 블렌드할 이전 애니메이션 포즈 */
 	std::vector<alglm::mat4> m_CurrentPose;                                  /**< 현재 포즈 행렬 벡터 (UBO)*/
 	std::vector<SAData> m_Data;                                              /**< 각 애니메이션 별 키프레임 데이터(SAData) 벡터 */
 };
@@ -44,6 +44,24 @@ class VulkanUtil
 	 * @return uint32_t 메모리 타입
 	 */
 	static uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+	/**
+	 * @brief 디바이스 메모리 할당
+	 * @details 할당한 크기를 MemoryTracker의 Renderer 태그에 기록합니다.
+	 *
+	 * @param device 논리 디바이스
+	 * @param allocInfo 메모리 할당 정보
+	 * @param memory 할당된 메모리
+	 * @return VkResult vkAllocateMemory 결과
+	 */
+	static VkResult allocateMemory(VkDevice device, const VkMemoryAllocateInfo &allocInfo, VkDeviceMemory &memory);
+	/**
+	 * @brief 디바이스 메모리 해제
+	 * @details allocateMemory로 할당한 메모리면 MemoryTracker에 해제를 기록합니다.
+	 *
+	 * @param device 논리 디바이스
+	 * @param memory 해제할 메모리
+	 */
+	static void freeMemory(VkDevice device, VkDeviceMemory memory);
 	/**
 	 * @brief 이미지 뷰 생성
 	 *
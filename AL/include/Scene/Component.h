@@ -201,6 +201,7 @@ struct RigidbodyComponent
 	float m_Damping = 0.001f;
 	float m_AngularDamping = 0.001f;
 	bool m_UseGravity = true;
+	bool m_IsBullet = false;
 	int32_t m_TouchNum = 0;
 
 	RigidbodyComponent() = default;
@@ -221,6 +222,11 @@ struct BoxColliderComponent
 	bool m_IsActive = true;
 	std::shared_ptr<ShaderResourceManager> m_colliderShaderResourceManager;
 
+	// 충돌 필터 (레이어)
+	uint32_t m_CategoryBits = 0x00000001;
+	uint32_t m_MaskBits = 0xFFFFFFFF;
+	int32_t m_GroupIndex = 0;
+
 	float m_Friction = 0.7f;
 	float m_Restitution = 0.4f;
 
@@ -240,6 +246,11 @@ struct SphereColliderComponent
 	bool m_IsActive = true;
 	std::shared_ptr<ShaderResourceManager> m_colliderShaderResourceManager;
 
+	// 충돌 필터 (레이어)
+	uint32_t m_CategoryBits = 0x00000001;
+	uint32_t m_MaskBits = 0xFFFFFFFF;
+	int32_t m_GroupIndex = 0;
+
 	float m_Friction = 0.4f;
 	float m_Restitution = 0.8f;
 
@@ -260,6 +271,11 @@ struct CapsuleColliderComponent
 	bool m_IsActive = true;
 	std::shared_ptr<ShaderResourceManager> m_colliderShaderResourceManager;
 
+	// 충돌 필터 (레이어)
+	uint32_t m_CategoryBits = 0x00000001;
+	uint32_t m_MaskBits = 0xFFFFFFFF;
+	int32_t m_GroupIndex = 0;
+
 	float m_Friction = 0.4f;
 	float m_Restitution = 0.4f;
 
@@ -280,6 +296,11 @@ struct CylinderColliderComponent
 	bool m_IsActive = true;
 	std::shared_ptr<ShaderResourceManager> m_colliderShaderResourceManager;
 
+	// 충돌 필터 (레이어)
+	uint32_t m_CategoryBits = 0x00000001;
+	uint32_t m_MaskBits = 0xFFFFFFFF;
+	int32_t m_GroupIndex = 0;
+
 	float m_Friction = 0.4f;
 	float m_Restitution = 0.4f;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Log.h"
+#include "Memory/MemoryTracker.h"
 #include "Renderer/Common.h"
 
 namespace ale
@@ -275,7 +276,7 @@ class CullTree
 	int32_t m_freeNode;
 	int32_t m_nodeCount;
 	int32_t m_nodeCapacity;
-	std::vector<CullTreeNode> m_nodes;
+	std::vector<CullTreeNode, TrackedAllocator<CullTreeNode, MemoryTag::Scene>> m_nodes;
 };
 
 } // namespace ale
@@ -4,6 +4,7 @@
 
 #include "Core/Timestep.h"
 #include "Core/UUID.h"
+#include "Memory/MemoryTracker.h"
 #include <alglm/include/alglm.h>
 #include <glm/glm.hpp>
 
@@ -274,6 +275,15 @@ class Scene
 		return m_isSelectedEntity;
 	}
 
+	/**
+	 * @brief 물리 World를 반환합니다.
+	 * @return World 포인터. 런타임이 시작되지 않았으면 nullptr.
+	 */
+	World *getPhysicsWorld()
+	{
+		return m_World;
+	}
+
   private:
 	template <typename T> void onComponentAdded(Entity entity, T &component);
 
@@ -299,7 +309,9 @@ class Scene
 	bool m_frustumFlag = true;
 	int32_t m_StepFrames = 0;
 
-	std::unordered_map<UUID, entt::entity> m_EntityMap;
+	std::unordered_map<UUID, entt::entity, std::hash<UUID>, std::equal_to<UUID>,
+					   TrackedAllocator<std::pair<const UUID, entt::entity>, MemoryTag::Scene>>
+		m_EntityMap;
 	std::queue<entt::entity> m_DestroyQueue;
 
 	DefaultTextures m_defaultTextures;
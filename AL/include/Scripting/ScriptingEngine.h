@@ -256,6 +256,9 @@ class ScriptingEngine
 	/// @brief ScriptingEngine 종료.
 	static void shutDown();
 
+	/// @brief Mono GC 힙 사용량을 MemoryTracker의 Scripting 태그에 기록하는 함수.
+	static void sampleMemoryUsage();
+
 	/// @brief ScriptCore를 읽어 저장하는 함수.
 	/// @param filepath ScriptCore file 경로.
 	/// @return true 읽는데 성공.
@@ -2,6 +2,8 @@
 #include "ALpch.h"
 #include <GLFW/glfw3.h>
 
+#include "Memory/FrameAllocator.h"
+#include "Memory/MemoryTracker.h"
 #include "Scripting/ScriptingEngine.h"
 
 namespace ale
@@ -56,6 +58,11 @@ void App::run()
 {
 	while (m_Running)
 	{
+		// 두 프레임 전의 임시 메모리를 비우고 서브시스템별 메모리 사용량 집계
+		FrameAllocator::get().beginFrame();
+		ScriptingEngine::sampleMemoryUsage();
+		MemoryTracker::beginFrame();
+
 		// set delta time
 		// float time = (float)glfwGetTime();
 		auto time = std::chrono::high_resolution_clock::now();
@@ -0,0 +1,148 @@
+#include "alpch.h"
+
+#include "Core/JobSystem.h"
+
+namespace ale
+{
+JobSystem::JobSystem(int32_t workerCount)
+	: m_pendingJobs(0), m_queuedJobs(0), m_nextQueue(0), m_isRunning(true), m_workerCount(workerCount)
+{
+	if (m_workerCount <= 0)
+	{
+		m_workerCount = std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+	}
+
+	m_queues.reserve(m_workerCount);
+	for (int32_t i = 0; i < m_workerCount; ++i)
+	{
+		m_queues.push_back(std::make_unique<WorkerQueue>());
+	}
+
+	// 마지막 인덱스는 wait()를 호출하는 메인 스레드 몫
+	m_threads.reserve(m_workerCount - 1);
+	for (int32_t i = 0; i < m_workerCount - 1; ++i)
+	{
+		m_threads.emplace_back(&JobSystem::workerLoop, this, i);
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_isRunning = false;
+	}
+	m_wakeCondition.notify_all();
+
+	for (std::thread &thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+void JobSystem::submit(Job job)
+{
+	uint32_t queueIndex = m_nextQueue.fetch_add(1) % static_cast<uint32_t>(m_workerCount);
+
+	m_pendingJobs.fetch_add(1);
+	{
+		std::lock_guard<std::mutex> lock(m_queues[queueIndex]->mutex);
+		m_queues[queueIndex]->jobs.push_back(std::move(job));
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_queuedJobs.fetch_add(1);
+	}
+	m_wakeCondition.notify_one();
+}
+
+void JobSystem::wait()
+{
+	int32_t mainIndex = m_workerCount - 1;
+	Job job;
+
+	while (m_pendingJobs.load() > 0)
+	{
+		if (popJob(mainIndex, job))
+		{
+			runJob(job, mainIndex);
+			continue;
+		}
+
+		// 남은 작업은 다른 워커가 실행 중이므로 끝날 때까지 대기
+		std::unique_lock<std::mutex> lock(m_wakeMutex);
+		m_doneCondition.wait(lock, [this]() { return m_pendingJobs.load() == 0 || m_queuedJobs.load() > 0; });
+	}
+}
+
+int32_t JobSystem::getWorkerCount() const
+{
+	return m_workerCount;
+}
+
+void JobSystem::workerLoop(int32_t workerIndex)
+{
+	Job job;
+
+	while (true)
+	{
+		if (popJob(workerIndex, job))
+		{
+			runJob(job, workerIndex);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_wakeMutex);
+		m_wakeCondition.wait(lock, [this]() { return !m_isRunning || m_queuedJobs.load() > 0; });
+
+		if (!m_isRunning)
+		{
+			return;
+		}
+	}
+}
+
+bool JobSystem::popJob(int32_t workerIndex, Job &job)
+{
+	// 자신의 큐는 뒤에서 꺼냄 (최근에 넣은 작업 우선)
+	{
+		WorkerQueue &queue = *m_queues[workerIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.jobs.empty())
+		{
+			job = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+			m_queuedJobs.fetch_sub(1);
+			return true;
+		}
+	}
+
+	// 다른 워커의 큐는 앞에서 훔쳐 옴
+	for (int32_t i = 1; i < m_workerCount; ++i)
+	{
+		WorkerQueue &queue = *m_queues[(workerIndex + i) % m_workerCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.jobs.empty())
+		{
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+			m_queuedJobs.fetch_sub(1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::runJob(Job &job, int32_t workerIndex)
+{
+	job(workerIndex);
+	job = nullptr;
+
+	if (m_pendingJobs.fetch_sub(1) == 1)
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_doneCondition.notify_all();
+	}
+}
+} // namespace ale
@@ -25,15 +25,90 @@ int32_t BlockAllocator::s_blockSizes[BLOCK_SIZE_COUNT] = {
 
 uint8_t BlockAllocator::s_blockSizeLookup[MAX_BLOCK_SIZE + 1];
 bool BlockAllocator::s_blockSizeLookupInitialized;
+std::atomic<uint32_t> BlockAllocator::s_nextId(1);
 
-BlockAllocator::BlockAllocator()
+namespace
+{
+// 스레드마다 BlockAllocator별 캐시를 기억하는 슬롯 (allocatorId 0은 빈 슬롯)
+struct ThreadCacheSlot
+{
+	uint32_t allocatorId;
+	BlockCache *cache;
+};
+
+struct ThreadCacheSlots
+{
+	~ThreadCacheSlots()
+	{
+		// 스레드가 종료되면 남은 블록과 함께 캐시를 반환하여 다른 스레드가 재사용
+		for (ThreadCacheSlot &slot : slots)
+		{
+			if (slot.cache != nullptr)
+			{
+				slot.cache->isInUse.store(false, std::memory_order_release);
+			}
+		}
+	}
+
+	ThreadCacheSlot slots[MAX_THREAD_CACHE_SLOTS] = {};
+};
+
+thread_local ThreadCacheSlots t_cacheSlots;
+
+void *alignedAlloc(size_t size, size_t alignment)
+{
+#ifdef _WIN32
+	return _aligned_malloc(size, alignment);
+#else
+	// aligned_alloc은 크기가 정렬 단위의 배수여야 함
+	return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void alignedFree(void *pointer)
+{
+#ifdef _WIN32
+	_aligned_free(pointer);
+#else
+	std::free(pointer);
+#endif
+}
+
+// 캐시의 블록 수는 한 스레드만 쓰고 통계 수집 시 다른 스레드가 읽음
+int32_t getCount(const BlockCache &cache, int32_t index)
+{
+	return cache.counts[index].load(std::memory_order_relaxed);
+}
+
+void setCount(BlockCache &cache, int32_t index, int32_t count)
+{
+	cache.counts[index].store(count, std::memory_order_relaxed);
+}
+
+void resetCache(BlockCache &cache)
+{
+	for (int32_t i = 0; i < BLOCK_SIZE_COUNT; ++i)
+	{
+		cache.blocks[i] = nullptr;
+		setCount(cache, i, 0);
+	}
+	cache.next = nullptr;
+}
+} // namespace
+
+BlockAllocator::BlockAllocator(MemoryTag tag) : m_tag(tag)
 {
 	m_chunkSpace = CHUNK_ARRAY_INCREMENT;
 	m_chunkCount = 0;
-	m_chunks = (Chunk *)_aligned_malloc(m_chunkSpace * sizeof(Chunk), 16);
+	m_chunks = (Chunk *)alignedAlloc(m_chunkSpace * sizeof(Chunk), 16);
 
 	memset(m_chunks, 0, m_chunkSpace * sizeof(Chunk));
-	memset(m_availableBlocks, 0, sizeof(m_availableBlocks));
+	memset(m_chunkCounts, 0, sizeof(m_chunkCounts));
+
+	m_caches = nullptr;
+	resetCache(m_sharedCache);
+	m_sharedCache.isInUse.store(true);
+	m_id = s_nextId.fetch_add(1);
 
 	// 블록 크기 조회 배열 초기화
 	if (s_blockSizeLookupInitialized == false)
@@ -64,14 +139,27 @@ BlockAllocator::BlockAllocator()
 
 BlockAllocator::~BlockAllocator()
 {
+	// 아직 살아 있는 스레드가 가진 캐시는 스레드 종료 시 접근하므로 남겨 둠
+	BlockCache *cache = m_caches;
+	while (cache != nullptr)
+	{
+		BlockCache *next = cache->next;
+		if (cache->isInUse.load(std::memory_order_acquire) == false)
+		{
+			delete cache;
+		}
+		cache = next;
+	}
+
 	// 모든 청크의 블록 해제
 	for (int32_t i = 0; i < m_chunkCount; ++i)
 	{
-		_aligned_free(m_chunks[i].blocks);
+		alignedFree(m_chunks[i].blocks);
+		MemoryTracker::recordFree(m_tag, CHUNK_SIZE);
 	}
 
 	// 청크 리스트 해제
-	_aligned_free(m_chunks);
+	alignedFree(m_chunks);
 }
 
 void *BlockAllocator::allocateBlock(int32_t size)
@@ -89,49 +177,29 @@ void *BlockAllocator::allocateBlock(int32_t size)
 
 	int32_t index = s_blockSizeLookup[size];
 
-	if (m_availableBlocks[index] != nullptr)
+	BlockCache *cache = getThreadCache();
+	std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+	if (cache == nullptr)
 	{
-		// 청크 내부에 할당된 블록이 존재하는 경우 해당 블록 return
-		Block *block = m_availableBlocks[index];
-		m_availableBlocks[index] = block->next;
-		return block;
+		// 캐시 슬롯이 부족한 스레드는 잠금을 잡고 공용 캐시 사용
+		cache = &m_sharedCache;
+		lock.lock();
 	}
-	else
-	{
-		// 할당된 블록이 없는 경우 블록 새로 할당
-		if (m_chunkCount == m_chunkSpace)
-		{
-			// 청크가 꽉찬 경우 크기 증가
-			Chunk *oldChunks = m_chunks;
-			m_chunkSpace += CHUNK_ARRAY_INCREMENT;
-			m_chunks = (Chunk *)_aligned_malloc(m_chunkSpace * sizeof(Chunk), 16);
-			memcpy(m_chunks, oldChunks, m_chunkCount * sizeof(Chunk));
-			_aligned_free(oldChunks);
-		}
-
-		// 새로운 청크 생성
-		Chunk *chunk = m_chunks + m_chunkCount;
-		chunk->blocks = (Block *)_aligned_malloc(CHUNK_SIZE, 16);
-
-		// 청크 내부 블록들 생성
-		int32_t blockSize = s_blockSizes[index];
-		chunk->blockSize = blockSize;
-		int32_t blockCount = CHUNK_SIZE / blockSize;
 
-		Block *block = chunk->blocks;
-		for (int32_t i = 1; i < blockCount; ++i)
+	if (cache->blocks[index] == nullptr)
+	{
+		// 캐시가 비었으면 공유 저장소에서 Magazine 하나를 가져옴
+		if (lock.owns_lock() == false)
 		{
-			Block *next = (Block *)((int8_t *)chunk->blocks + blockSize * i);
-			block->next = next;
-			block = next;
+			lock.lock();
 		}
-		block->next = nullptr;
-
-		m_availableBlocks[index] = chunk->blocks->next;
-		++m_chunkCount;
-
-		return chunk->blocks;
+		refillCache(*cache, index);
 	}
+
+	Block *block = cache->blocks[index];
+	cache->blocks[index] = block->next;
+	setCount(*cache, index, getCount(*cache, index) - 1);
+	return block;
 }
 
 void BlockAllocator::freeBlock(void *pointer, int32_t size)
@@ -147,9 +215,335 @@ void BlockAllocator::freeBlock(void *pointer, int32_t size)
 	}
 	int32_t index = s_blockSizeLookup[size];
 
-	// free한 pointer를 다시 avilableBlock에 편입
+	BlockCache *cache = getThreadCache();
+	std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+	if (cache == nullptr)
+	{
+		cache = &m_sharedCache;
+		lock.lock();
+	}
+
+	// free한 pointer를 다시 캐시에 편입
 	Block *block = (Block *)pointer;
-	block->next = m_availableBlocks[index];
-	m_availableBlocks[index] = block;
+	block->next = cache->blocks[index];
+	cache->blocks[index] = block;
+	int32_t count = getCount(*cache, index) + 1;
+	setCount(*cache, index, count);
+
+	// 캐시가 Magazine 두 개 분량을 넘으면 하나를 공유 저장소로 반환
+	if (count > 2 * MAGAZINE_SIZE)
+	{
+		Magazine magazine = detachMagazine(*cache, index);
+		if (lock.owns_lock() == false)
+		{
+			lock.lock();
+		}
+		m_magazines[index].push_back(magazine);
+	}
+}
+
+int64_t BlockAllocator::trim()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// 다른 스레드가 접근하지 않는 캐시의 블록을 공유 저장소로 모음
+	for (ThreadCacheSlot &slot : t_cacheSlots.slots)
+	{
+		if (slot.allocatorId == m_id)
+		{
+			flushCache(*slot.cache);
+		}
+	}
+	for (BlockCache *cache = m_caches; cache != nullptr; cache = cache->next)
+	{
+		// 종료된 스레드의 캐시는 m_mutex를 잡고 있는 동안 다른 스레드가 넘겨받지 못함
+		if (cache->isInUse.load(std::memory_order_acquire) == false)
+		{
+			flushCache(*cache);
+		}
+	}
+	flushCache(m_sharedCache);
+
+	// 블록 주소로 청크를 찾기 위해 청크 시작 주소 순으로 정렬
+	std::vector<int32_t> order(m_chunkCount);
+	for (int32_t i = 0; i < m_chunkCount; ++i)
+	{
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(),
+			  [this](int32_t a, int32_t b) { return m_chunks[a].blocks < m_chunks[b].blocks; });
+
+	auto findChunk = [&](Block *block) {
+		auto it = std::upper_bound(order.begin(), order.end(), block,
+								   [this](Block *value, int32_t chunk) { return value < m_chunks[chunk].blocks; });
+		return *(it - 1);
+	};
+
+	// 청크별 남은 블록 수를 세어 모든 블록이 남은 청크를 찾음
+	std::vector<int32_t> freeCounts(m_chunkCount, 0);
+	for (int32_t index = 0; index < BLOCK_SIZE_COUNT; ++index)
+	{
+		for (const Magazine &magazine : m_magazines[index])
+		{
+			for (Block *block = magazine.blocks; block != nullptr; block = block->next)
+			{
+				++freeCounts[findChunk(block)];
+			}
+		}
+	}
+
+	std::vector<bool> released(m_chunkCount, false);
+	bool hasReleased = false;
+	for (int32_t i = 0; i < m_chunkCount; ++i)
+	{
+		released[i] = freeCounts[i] == CHUNK_SIZE / m_chunks[i].blockSize;
+		hasReleased = hasReleased || released[i];
+	}
+
+	if (hasReleased == false)
+	{
+		return 0;
+	}
+
+	// 해제할 청크의 블록을 빼고 공유 저장소를 Magazine 단위로 다시 구성
+	for (int32_t index = 0; index < BLOCK_SIZE_COUNT; ++index)
+	{
+		std::vector<Magazine> magazines;
+		Magazine current = {nullptr, 0};
+		for (const Magazine &magazine : m_magazines[index])
+		{
+			Block *block = magazine.blocks;
+			while (block != nullptr)
+			{
+				Block *next = block->next;
+				if (released[findChunk(block)] == false)
+				{
+					block->next = current.blocks;
+					current.blocks = block;
+					if (++current.count == MAGAZINE_SIZE)
+					{
+						magazines.push_back(current);
+						current = {nullptr, 0};
+					}
+				}
+				block = next;
+			}
+		}
+
+		if (current.count > 0)
+		{
+			magazines.push_back(current);
+		}
+		m_magazines[index].swap(magazines);
+	}
+
+	// 청크 해제 후 남은 청크를 앞으로 모음
+	int64_t releasedBytes = 0;
+	int32_t chunkCount = 0;
+	for (int32_t i = 0; i < m_chunkCount; ++i)
+	{
+		if (released[i])
+		{
+			--m_chunkCounts[s_blockSizeLookup[m_chunks[i].blockSize]];
+			alignedFree(m_chunks[i].blocks);
+			MemoryTracker::recordFree(m_tag, CHUNK_SIZE);
+			releasedBytes += CHUNK_SIZE;
+		}
+		else
+		{
+			m_chunks[chunkCount++] = m_chunks[i];
+		}
+	}
+	m_chunkCount = chunkCount;
+
+	return releasedBytes;
+}
+
+BlockAllocatorStats BlockAllocator::getStats()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	BlockAllocatorStats stats;
+	stats.reservedBytes = static_cast<int64_t>(m_chunkCount) * CHUNK_SIZE;
+	stats.liveBytes = 0;
+	for (int32_t index = 0; index < BLOCK_SIZE_COUNT; ++index)
+	{
+		int32_t freeBlocks = getCount(m_sharedCache, index);
+		for (const Magazine &magazine : m_magazines[index])
+		{
+			freeBlocks += magazine.count;
+		}
+		for (BlockCache *cache = m_caches; cache != nullptr; cache = cache->next)
+		{
+			freeBlocks += getCount(*cache, index);
+		}
+
+		int32_t totalBlocks = m_chunkCounts[index] * (CHUNK_SIZE / s_blockSizes[index]);
+		stats.chunkCounts[index] = m_chunkCounts[index];
+		stats.freeBlocks[index] = freeBlocks;
+		stats.liveBlocks[index] = std::max(totalBlocks - freeBlocks, 0);
+		stats.liveBytes += static_cast<int64_t>(stats.liveBlocks[index]) * s_blockSizes[index];
+	}
+
+	return stats;
+}
+
+void BlockAllocator::logStats()
+{
+	BlockAllocatorStats stats = getStats();
+
+	AL_CORE_INFO("BlockAllocator: {0} KB reserved, {1} KB live", stats.reservedBytes / 1024, stats.liveBytes / 1024);
+	for (int32_t index = 0; index < BLOCK_SIZE_COUNT; ++index)
+	{
+		if (stats.chunkCounts[index] == 0)
+		{
+			continue;
+		}
+
+		AL_CORE_INFO("  {0} bytes: {1} chunks, {2} live, {3} free", s_blockSizes[index], stats.chunkCounts[index],
+					 stats.liveBlocks[index], stats.freeBlocks[index]);
+	}
+}
+
+int32_t BlockAllocator::getBlockSize(int32_t index)
+{
+	return s_blockSizes[index];
+}
+
+BlockCache *BlockAllocator::getThreadCache()
+{
+	ThreadCacheSlot *emptySlot = nullptr;
+	for (ThreadCacheSlot &slot : t_cacheSlots.slots)
+	{
+		if (slot.allocatorId == m_id)
+		{
+			return slot.cache;
+		}
+
+		if (slot.allocatorId == 0 && emptySlot == nullptr)
+		{
+			emptySlot = &slot;
+		}
+	}
+
+	if (emptySlot == nullptr)
+	{
+		return nullptr;
+	}
+
+	emptySlot->allocatorId = m_id;
+	emptySlot->cache = acquireCache();
+	return emptySlot->cache;
+}
+
+BlockCache *BlockAllocator::acquireCache()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// 종료된 스레드가 반환한 캐시를 남은 블록과 함께 재사용
+	for (BlockCache *cache = m_caches; cache != nullptr; cache = cache->next)
+	{
+		bool expected = false;
+		if (cache->isInUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+		{
+			return cache;
+		}
+	}
+
+	BlockCache *cache = new BlockCache();
+	resetCache(*cache);
+	cache->isInUse.store(true, std::memory_order_relaxed);
+	cache->next = m_caches;
+	m_caches = cache;
+	return cache;
+}
+
+void BlockAllocator::refillCache(BlockCache &cache, int32_t index)
+{
+	if (m_magazines[index].empty())
+	{
+		allocateChunk(index);
+	}
+
+	Magazine magazine = m_magazines[index].back();
+	m_magazines[index].pop_back();
+
+	cache.blocks[index] = magazine.blocks;
+	setCount(cache, index, magazine.count);
+}
+
+Magazine BlockAllocator::detachMagazine(BlockCache &cache, int32_t index)
+{
+	Magazine magazine;
+	magazine.blocks = cache.blocks[index];
+	magazine.count = MAGAZINE_SIZE;
+
+	Block *last = magazine.blocks;
+	for (int32_t i = 1; i < MAGAZINE_SIZE; ++i)
+	{
+		last = last->next;
+	}
+
+	cache.blocks[index] = last->next;
+	setCount(cache, index, getCount(cache, index) - MAGAZINE_SIZE);
+	last->next = nullptr;
+	return magazine;
+}
+
+void BlockAllocator::flushCache(BlockCache &cache)
+{
+	for (int32_t index = 0; index < BLOCK_SIZE_COUNT; ++index)
+	{
+		if (cache.blocks[index] == nullptr)
+		{
+			continue;
+		}
+
+		m_magazines[index].push_back({cache.blocks[index], getCount(cache, index)});
+		cache.blocks[index] = nullptr;
+		setCount(cache, index, 0);
+	}
+}
+
+void BlockAllocator::allocateChunk(int32_t index)
+{
+	if (m_chunkCount == m_chunkSpace)
+	{
+		// 청크가 꽉찬 경우 크기 증가
+		Chunk *oldChunks = m_chunks;
+		m_chunkSpace += CHUNK_ARRAY_INCREMENT;
+		m_chunks = (Chunk *)alignedAlloc(m_chunkSpace * sizeof(Chunk), 16);
+		memcpy(m_chunks, oldChunks, m_chunkCount * sizeof(Chunk));
+		alignedFree(oldChunks);
+	}
+
+	// 새로운 청크 생성
+	Chunk *chunk = m_chunks + m_chunkCount;
+	chunk->blocks = (Block *)alignedAlloc(CHUNK_SIZE, 16);
+	MemoryTracker::recordAllocation(m_tag, CHUNK_SIZE);
+	++m_chunkCount;
+	++m_chunkCounts[index];
+
+	// 청크 내부 블록들을 MAGAZINE_SIZE개씩 연결하여 공유 저장소에 추가
+	int32_t blockSize = s_blockSizes[index];
+	chunk->blockSize = blockSize;
+	int32_t blockCount = CHUNK_SIZE / blockSize;
+
+	for (int32_t first = 0; first < blockCount; first += MAGAZINE_SIZE)
+	{
+		int32_t count = std::min(MAGAZINE_SIZE, blockCount - first);
+		Block *head = (Block *)((int8_t *)chunk->blocks + blockSize * first);
+
+		Block *block = head;
+		for (int32_t i = 1; i < count; ++i)
+		{
+			Block *next = (Block *)((int8_t *)head + blockSize * i);
+			block->next = next;
+			block = next;
+		}
+		block->next = nullptr;
+
+		m_magazines[index].push_back({head, count});
+	}
 }
-} // namespace ale
\ No newline at end of file
+} // namespace ale
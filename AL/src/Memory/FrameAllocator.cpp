@@ -0,0 +1,135 @@
+#include "alpch.h"
+
+#include "Memory/FrameAllocator.h"
+
+namespace ale
+{
+FrameAllocator::Resource::Resource(FrameAllocator *allocator) : m_allocator(allocator)
+{
+}
+
+void *FrameAllocator::Resource::do_allocate(size_t bytes, size_t alignment)
+{
+	return m_allocator->allocate(bytes, alignment);
+}
+
+void FrameAllocator::Resource::do_deallocate(void *, size_t, size_t)
+{
+	// 버퍼를 다시 사용할 때 한꺼번에 비움
+}
+
+bool FrameAllocator::Resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+FrameAllocator::FrameAllocator(size_t capacity)
+	: m_buffers(), m_current(0), m_capacity(capacity), m_resource(this), m_stats(), m_frameHeapAllocations(0)
+{
+	m_stats.capacity = capacity;
+}
+
+FrameAllocator::~FrameAllocator()
+{
+	for (FrameBuffer &buffer : m_buffers)
+	{
+		for (const std::pair<void *, size_t> &overflow : buffer.overflow)
+		{
+			::operator delete(overflow.first, std::align_val_t(overflow.second));
+		}
+		::operator delete(buffer.data);
+	}
+}
+
+FrameAllocator &FrameAllocator::get()
+{
+	static FrameAllocator s_instance;
+	return s_instance;
+}
+
+void FrameAllocator::beginFrame()
+{
+	FrameBuffer &finished = m_buffers[m_current];
+	uint64_t heapAllocations = getHeapAllocationCount();
+
+	m_stats.bytesUsed = finished.offset + finished.overflowBytes;
+	m_stats.highWater = std::max(m_stats.highWater, m_stats.bytesUsed);
+	m_stats.allocationCount = finished.allocationCount;
+	m_stats.overflowCount = static_cast<int32_t>(finished.overflow.size());
+	m_stats.heapAllocationCount = heapAllocations - m_frameHeapAllocations;
+	m_frameHeapAllocations = heapAllocations;
+
+	// 두 프레임 전에 사용한 버퍼를 비워 이번 프레임에 사용
+	m_current = (m_current + 1) % FRAME_BUFFER_COUNT;
+	resetBuffer(m_buffers[m_current]);
+	m_stats.capacity = m_capacity;
+}
+
+void *FrameAllocator::allocate(size_t size, size_t alignment)
+{
+	FrameBuffer &buffer = m_buffers[m_current];
+	++buffer.allocationCount;
+
+	if (!buffer.data)
+	{
+		buffer.data = static_cast<char *>(::operator new(m_capacity));
+		buffer.capacity = m_capacity;
+	}
+
+	uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data);
+	uintptr_t address = (base + buffer.offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+	size_t end = static_cast<size_t>(address - base) + size;
+	if (end <= buffer.capacity)
+	{
+		buffer.offset = end;
+		return reinterpret_cast<void *>(address);
+	}
+
+	// 버퍼가 부족하면 힙에서 할당하고 버퍼를 비울 때 해제
+	void *p = ::operator new(size, std::align_val_t(alignment));
+	buffer.overflow.push_back({p, alignment});
+	buffer.overflowBytes += size;
+	return p;
+}
+
+std::pmr::memory_resource *FrameAllocator::getResource()
+{
+	return &m_resource;
+}
+
+const FrameAllocatorStats &FrameAllocator::getStats() const
+{
+	return m_stats;
+}
+
+void FrameAllocator::resetBuffer(FrameBuffer &buffer)
+{
+	for (const std::pair<void *, size_t> &overflow : buffer.overflow)
+	{
+		::operator delete(overflow.first, std::align_val_t(overflow.second));
+	}
+
+	if (!buffer.overflow.empty())
+	{
+		size_t used = buffer.offset + buffer.overflowBytes;
+		AL_CORE_WARN("FrameAllocator overflow: {0} bytes used in a {1} byte buffer", used, buffer.capacity);
+		while (m_capacity < used)
+		{
+			m_capacity *= 2;
+		}
+		buffer.overflow.clear();
+	}
+
+	// 새 크기보다 작은 버퍼는 다음 할당 때 다시 만듦
+	if (buffer.capacity < m_capacity)
+	{
+		::operator delete(buffer.data);
+		buffer.data = nullptr;
+		buffer.capacity = 0;
+	}
+
+	buffer.offset = 0;
+	buffer.overflowBytes = 0;
+	buffer.allocationCount = 0;
+}
+} // namespace ale
@@ -0,0 +1,197 @@
+#include "alpch.h"
+
+#include "Memory/FrameAllocator.h"
+
+#include <atomic>
+#include <cstdlib>
+
+// 힙 할당 횟수를 세기 위해 전역 operator new / delete를 교체하는 TU
+// 모든 할당에 원자 연산이 추가되므로 AL_COUNT_HEAP_ALLOCATIONS 옵션을 켠 빌드에서만 교체함
+// FrameAllocator::getHeapAllocationCount가 이 TU에 있으므로 정적 라이브러리에서도 교체 함수가 함께 링크됨
+
+namespace
+{
+std::atomic<uint64_t> s_heapAllocationCount{0};
+} // namespace
+
+#ifdef AL_COUNT_HEAP_ALLOCATIONS
+
+namespace
+{
+void *allocateCounted(std::size_t size, std::size_t alignment)
+{
+	s_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (size == 0)
+	{
+		size = 1;
+	}
+	while (true)
+	{
+		void *p;
+		if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			p = std::malloc(size);
+		}
+		else
+		{
+#ifdef _WIN32
+			p = _aligned_malloc(size, alignment);
+#else
+			// aligned_alloc은 크기가 정렬 단위의 배수여야 함
+			p = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+		}
+
+		if (p)
+		{
+			return p;
+		}
+		std::new_handler handler = std::get_new_handler();
+		if (!handler)
+		{
+			throw std::bad_alloc();
+		}
+		handler();
+	}
+}
+
+void freeCounted(void *p, std::size_t alignment) noexcept
+{
+	if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		std::free(p);
+		return;
+	}
+#ifdef _WIN32
+	_aligned_free(p);
+#else
+	std::free(p);
+#endif
+}
+} // namespace
+
+// 표준 라이브러리 구현마다 배열, nothrow 버전이 어떤 함수를 거치는지 다르므로 모두 교체함
+void *operator new(std::size_t size)
+{
+	return allocateCounted(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new[](std::size_t size)
+{
+	return allocateCounted(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+	return allocateCounted(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return allocateCounted(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	try
+	{
+		return allocateCounted(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+	}
+	catch (const std::bad_alloc &)
+	{
+		return nullptr;
+	}
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return operator new(size, std::nothrow);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	try
+	{
+		return allocateCounted(size, static_cast<std::size_t>(alignment));
+	}
+	catch (const std::bad_alloc &)
+	{
+		return nullptr;
+	}
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	return operator new(size, alignment, std::nothrow);
+}
+
+void operator delete(void *p) noexcept
+{
+	freeCounted(p, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void *p) noexcept
+{
+	freeCounted(p, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+	freeCounted(p, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+	freeCounted(p, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+	freeCounted(p, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+	freeCounted(p, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void *p, std::align_val_t alignment) noexcept
+{
+	freeCounted(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *p, std::align_val_t alignment) noexcept
+{
+	freeCounted(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t alignment) noexcept
+{
+	freeCounted(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *p, std::size_t, std::align_val_t alignment) noexcept
+{
+	freeCounted(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *p, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	freeCounted(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *p, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	freeCounted(p, static_cast<std::size_t>(alignment));
+}
+
+#endif
+
+namespace ale
+{
+uint64_t FrameAllocator::getHeapAllocationCount()
+{
+	return s_heapAllocationCount.load(std::memory_order_relaxed);
+}
+} // namespace ale
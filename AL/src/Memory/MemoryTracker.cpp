@@ -0,0 +1,131 @@
+#include "alpch.h"
+
+#include "Memory/MemoryTracker.h"
+
+namespace ale
+{
+std::atomic<int64_t> MemoryTracker::s_trackedBytes[MEMORY_TAG_COUNT] = {};
+std::atomic<int64_t> MemoryTracker::s_externalBytes[MEMORY_TAG_COUNT] = {};
+std::atomic<int64_t> MemoryTracker::s_peakBytes[MEMORY_TAG_COUNT] = {};
+std::atomic<int32_t> MemoryTracker::s_liveAllocations[MEMORY_TAG_COUNT] = {};
+std::atomic<int64_t> MemoryTracker::s_allocationCounts[MEMORY_TAG_COUNT] = {};
+int64_t MemoryTracker::s_frameStartCounts[MEMORY_TAG_COUNT] = {};
+int32_t MemoryTracker::s_frameAllocations[MEMORY_TAG_COUNT] = {};
+int64_t MemoryTracker::s_budgets[MEMORY_TAG_COUNT] = {};
+bool MemoryTracker::s_overBudget[MEMORY_TAG_COUNT] = {};
+
+static const char *s_tagNames[MEMORY_TAG_COUNT] = {"Physics", "Renderer", "Assets", "Scripting", "Scene"};
+
+void MemoryTracker::recordAllocation(MemoryTag tag, int64_t size)
+{
+	int32_t index = static_cast<int32_t>(tag);
+	s_trackedBytes[index].fetch_add(size, std::memory_order_relaxed);
+	s_liveAllocations[index].fetch_add(1, std::memory_order_relaxed);
+	s_allocationCounts[index].fetch_add(1, std::memory_order_relaxed);
+	updatePeak(index);
+}
+
+void MemoryTracker::recordFree(MemoryTag tag, int64_t size)
+{
+	int32_t index = static_cast<int32_t>(tag);
+	s_trackedBytes[index].fetch_sub(size, std::memory_order_relaxed);
+	s_liveAllocations[index].fetch_sub(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::setExternalBytes(MemoryTag tag, int64_t size)
+{
+	int32_t index = static_cast<int32_t>(tag);
+	s_externalBytes[index].store(size, std::memory_order_relaxed);
+	updatePeak(index);
+}
+
+void MemoryTracker::setBudget(MemoryTag tag, int64_t size)
+{
+	int32_t index = static_cast<int32_t>(tag);
+	s_budgets[index] = std::max<int64_t>(size, 0);
+	s_overBudget[index] = false;
+}
+
+void MemoryTracker::beginFrame()
+{
+	for (int32_t index = 0; index < MEMORY_TAG_COUNT; ++index)
+	{
+		int64_t count = s_allocationCounts[index].load(std::memory_order_relaxed);
+		s_frameAllocations[index] = static_cast<int32_t>(count - s_frameStartCounts[index]);
+		s_frameStartCounts[index] = count;
+
+		if (s_budgets[index] == 0)
+		{
+			continue;
+		}
+
+		// 예산을 넘는 순간 한 번만 경고하고, 예산 안으로 돌아오면 다시 경고할 수 있게 함
+		int64_t current = s_trackedBytes[index].load(std::memory_order_relaxed) +
+						  s_externalBytes[index].load(std::memory_order_relaxed);
+		if (current > s_budgets[index])
+		{
+			if (s_overBudget[index] == false)
+			{
+				AL_CORE_WARN("Memory budget exceeded: {0} uses {1} KB of {2} KB", s_tagNames[index], current / 1024,
+							 s_budgets[index] / 1024);
+				s_overBudget[index] = true;
+			}
+		}
+		else
+		{
+			s_overBudget[index] = false;
+		}
+	}
+}
+
+MemoryTagStats MemoryTracker::getStats(MemoryTag tag)
+{
+	int32_t index = static_cast<int32_t>(tag);
+
+	MemoryTagStats stats;
+	stats.externalBytes = s_externalBytes[index].load(std::memory_order_relaxed);
+	stats.currentBytes = s_trackedBytes[index].load(std::memory_order_relaxed) + stats.externalBytes;
+	stats.peakBytes = std::max(s_peakBytes[index].load(std::memory_order_relaxed), stats.currentBytes);
+	stats.budgetBytes = s_budgets[index];
+	stats.liveAllocations = s_liveAllocations[index].load(std::memory_order_relaxed);
+	stats.frameAllocations = s_frameAllocations[index];
+	return stats;
+}
+
+void MemoryTracker::resetPeaks()
+{
+	for (int32_t index = 0; index < MEMORY_TAG_COUNT; ++index)
+	{
+		int64_t current = s_trackedBytes[index].load(std::memory_order_relaxed) +
+						  s_externalBytes[index].load(std::memory_order_relaxed);
+		s_peakBytes[index].store(current, std::memory_order_relaxed);
+	}
+}
+
+void MemoryTracker::logStats()
+{
+	AL_CORE_INFO("Memory usage");
+	for (int32_t index = 0; index < MEMORY_TAG_COUNT; ++index)
+	{
+		MemoryTagStats stats = getStats(static_cast<MemoryTag>(index));
+		AL_CORE_INFO("  {0}: {1} KB (peak {2} KB, budget {3} KB), {4} live allocations", s_tagNames[index],
+					 stats.currentBytes / 1024, stats.peakBytes / 1024, stats.budgetBytes / 1024,
+					 stats.liveAllocations);
+	}
+}
+
+const char *MemoryTracker::getTagName(MemoryTag tag)
+{
+	return s_tagNames[static_cast<int32_t>(tag)];
+}
+
+void MemoryTracker::updatePeak(int32_t index)
+{
+	int64_t current =
+		s_trackedBytes[index].load(std::memory_order_relaxed) + s_externalBytes[index].load(std::memory_order_relaxed);
+	int64_t peak = s_peakBytes[index].load(std::memory_order_relaxed);
+	while (current > peak && !s_peakBytes[index].compare_exchange_weak(peak, current, std::memory_order_relaxed))
+	{
+	}
+}
+} // namespace ale
@@ -2,62 +2,140 @@
 
 #include "Memory/StackAllocator.h"
 
+#include <new>
+
 namespace ale
 {
-StackAllocator::StackAllocator() : m_index(0), m_entryCount(0) {};
+StackAllocator::StackAllocator(MemoryTag tag, int32_t initialSize)
+	: m_blockIndex(0), m_initialSize(initialSize), m_tag(tag), m_allocation(0), m_stats()
+{
+	m_entries.reserve(STACK_ENTRY_RESERVE);
+}
 
 StackAllocator::~StackAllocator()
 {
-	while (m_entryCount >= 0)
+	for (StackBlock &block : m_blocks)
 	{
-		StackEntry *entry = m_entries + m_entryCount;
-
-		--m_entryCount;
+		::operator delete(block.data, std::align_val_t(STACK_ALIGNMENT));
+		MemoryTracker::recordFree(m_tag, block.size);
 	}
 }
 
 void *StackAllocator::allocateStack(int32_t size)
 {
-	if (size % 16 != 0)
+	if (size % STACK_ALIGNMENT != 0)
+	{
+		size = (size / STACK_ALIGNMENT + 1) * STACK_ALIGNMENT;
+	}
+
+	if (m_blocks.empty())
+	{
+		addBlock(std::max(m_initialSize, size));
+	}
+	else if (m_blocks[m_blockIndex].used + size > m_blocks[m_blockIndex].size)
 	{
-		size = (size / 16 + 1) * 16;
+		// 현재 블록이 부족하면 비어 있는 다음 블록을 쓰거나 새 블록을 이어 붙임
+		int32_t next = m_blockIndex + 1;
+		if (next < static_cast<int32_t>(m_blocks.size()) && m_blocks[next].size >= size)
+		{
+			m_blockIndex = next;
+		}
+		else
+		{
+			AL_CORE_WARN("StackAllocator overflow: {0} bytes in use, requested {1}", m_allocation, size);
+			addBlock(std::max(m_blocks[m_blockIndex].size, size));
+			++m_stats.overflowCount;
+		}
 	}
-	
-	if (m_entryCount == MAX_STACK_ENTRY_SIZE)
+
+	StackBlock &block = m_blocks[m_blockIndex];
+
+	StackEntry entry;
+	entry.data = block.data + block.used;
+	entry.size = size;
+	entry.blockIndex = m_blockIndex;
+	m_entries.push_back(entry);
+
+	block.used += size;
+	m_allocation += size;
+	m_stats.highWater = std::max(m_stats.highWater, m_allocation);
+
+	return entry.data;
+}
+
+void StackAllocator::freeStack()
+{
+	if (m_entries.empty())
 	{
-		AL_CORE_ERROR("Requested size: {0}", size);
-		throw std::runtime_error("stack overflow");
+		return;
 	}
 
-	StackEntry *entry = m_entries + m_entryCount;
-	entry->size = size;
-	if (m_index + size > STACK_SIZE)
+	const StackEntry &entry = m_entries.back();
+	m_blocks[entry.blockIndex].used -= entry.size;
+	m_allocation -= entry.size;
+	m_entries.pop_back();
+
+	if (m_entries.empty())
 	{
-		AL_CORE_ERROR("Requested size: {0}", size);
-		throw std::runtime_error("stack overflow");
+		m_blockIndex = 0;
+		mergeBlocks();
 	}
 	else
 	{
-		entry->data = m_data + m_index;
-		m_index += size;
+		m_blockIndex = m_entries.back().blockIndex;
 	}
+}
 
-	++m_entryCount;
+const StackAllocatorStats &StackAllocator::getStats() const
+{
+	return m_stats;
+}
 
-	return entry->data;
+void StackAllocator::resetStats()
+{
+	m_stats.highWater = m_allocation;
+	m_stats.overflowCount = 0;
 }
 
-void StackAllocator::freeStack()
+void StackAllocator::addBlock(int32_t size)
 {
-	if (m_entryCount == 0)
+	// 현재 블록 뒤의 블록은 비어 있으므로 크기가 부족한 블록은 해제
+	int32_t next = m_blocks.empty() ? 0 : m_blockIndex + 1;
+	for (int32_t i = next; i < static_cast<int32_t>(m_blocks.size()); ++i)
 	{
-		return;
+		m_stats.capacity -= m_blocks[i].size;
+		::operator delete(m_blocks[i].data, std::align_val_t(STACK_ALIGNMENT));
+		MemoryTracker::recordFree(m_tag, m_blocks[i].size);
 	}
+	m_blocks.resize(next);
 
-	StackEntry *entry = m_entries + m_entryCount - 1;
+	StackBlock block;
+	block.data = static_cast<char *>(::operator new(size, std::align_val_t(STACK_ALIGNMENT)));
+	MemoryTracker::recordAllocation(m_tag, size);
+	block.size = size;
+	block.used = 0;
+	m_blocks.push_back(block);
 
-	m_index -= entry->size;
+	m_blockIndex = next;
+	m_stats.capacity += size;
+}
+
+void StackAllocator::mergeBlocks()
+{
+	if (m_blocks.size() <= 1)
+	{
+		return;
+	}
+
+	int32_t capacity = m_stats.capacity;
+	for (StackBlock &block : m_blocks)
+	{
+		::operator delete(block.data, std::align_val_t(STACK_ALIGNMENT));
+		MemoryTracker::recordFree(m_tag, block.size);
+	}
+	m_blocks.clear();
+	m_stats.capacity = 0;
 
-	--m_entryCount;
+	addBlock(capacity);
 }
 } // namespace ale
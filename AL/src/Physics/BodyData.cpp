@@ -0,0 +1,149 @@
+#include "Physics/BodyData.h"
+
+namespace ale
+{
+template <typename T> static inline void _removeSwap(std::vector<T> &values, int32_t index)
+{
+	values[index] = values.back();
+	values.pop_back();
+}
+
+int32_t BodyData::push()
+{
+	Transform xf;
+	xf.position = alglm::vec3(0.0f);
+	xf.orientation = alglm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+	Sweep sweep;
+	sweep.p = xf.position;
+	sweep.q = xf.orientation;
+	sweep.alpha = 0.0f;
+
+	transforms.push_back(xf);
+	sweeps.push_back(sweep);
+	linearVelocities.push_back(alglm::vec3(0.0f));
+	angularVelocities.push_back(alglm::vec3(0.0f));
+	accelerations.push_back(alglm::vec3(0.0f));
+	forceAccums.push_back(alglm::vec3(0.0f));
+	torqueAccums.push_back(alglm::vec3(0.0f));
+	transformMatrices.push_back(alglm::mat4(1.0f));
+	inverseInertiaTensors.push_back(alglm::mat3(0.0f));
+	inverseInertiaTensorWorlds.push_back(alglm::mat3(0.0f));
+	inverseMasses.push_back(0.0f);
+	linearDampings.push_back(0.0f);
+	angularDampings.push_back(0.0f);
+	gravities.push_back(0.0f);
+	posFreezes.push_back(alglm::vec3(1.0f));
+	rotFreezes.push_back(alglm::vec3(1.0f));
+	awakeFlags.push_back(1);
+	movableFlags.push_back(0);
+
+	return static_cast<int32_t>(transforms.size()) - 1;
+}
+
+void BodyData::remove(int32_t index)
+{
+	_removeSwap(transforms, index);
+	_removeSwap(sweeps, index);
+	_removeSwap(linearVelocities, index);
+	_removeSwap(angularVelocities, index);
+	_removeSwap(accelerations, index);
+	_removeSwap(forceAccums, index);
+	_removeSwap(torqueAccums, index);
+	_removeSwap(transformMatrices, index);
+	_removeSwap(inverseInertiaTensors, index);
+	_removeSwap(inverseInertiaTensorWorlds, index);
+	_removeSwap(inverseMasses, index);
+	_removeSwap(linearDampings, index);
+	_removeSwap(angularDampings, index);
+	_removeSwap(gravities, index);
+	_removeSwap(posFreezes, index);
+	_removeSwap(rotFreezes, index);
+	_removeSwap(awakeFlags, index);
+	_removeSwap(movableFlags, index);
+}
+
+int32_t BodyData::getCount() const
+{
+	return static_cast<int32_t>(transforms.size());
+}
+
+void BodyData::integrate(float duration)
+{
+	int32_t count = getCount();
+	for (int32_t i = 0; i < count; ++i)
+	{
+		if (awakeFlags[i] == 0 || movableFlags[i] == 0)
+		{
+			continue;
+		}
+		integrate(i, duration);
+	}
+}
+
+void BodyData::integrate(int32_t index, float duration)
+{
+	Transform &xf = transforms[index];
+	alglm::vec3 &linearVelocity = linearVelocities[index];
+	alglm::vec3 &angularVelocity = angularVelocities[index];
+
+	// Set acceleration by F = ma, gravity
+	alglm::vec3 acceleration = accelerations[index] + forceAccums[index] * inverseMasses[index];
+	acceleration.y -= gravities[index];
+
+	// set angular acceleration
+	alglm::vec3 angularAcceleration = inverseInertiaTensorWorlds[index] * torqueAccums[index];
+
+	// set velocity by accerleration
+	linearVelocity += (acceleration * duration) * posFreezes[index];
+	angularVelocity += (angularAcceleration * duration) * rotFreezes[index];
+
+	// impose drag
+	linearVelocity *= (1.0f - linearDampings[index]);
+	angularVelocity *= (1.0f - angularDampings[index]);
+
+	// set sweep (previous Transform)
+	sweeps[index].p = xf.position;
+	sweeps[index].q = xf.orientation;
+
+	// set position
+	xf.position += (linearVelocity * duration);
+
+	// set orientation
+	alglm::quat angularVelocityQuat = alglm::quat(0.0f, angularVelocity * duration); // 각속도를 쿼터니언으로 변환
+	xf.orientation += 0.5f * angularVelocityQuat * xf.orientation;				   // 쿼터니언 미분 공식
+	xf.orientation = alglm::normalize(xf.orientation);								   // 정규화하여 안정성 유지
+
+	calculateDerivedData(index);
+	forceAccums[index] = alglm::vec3(0.0f);
+	torqueAccums[index] = alglm::vec3(0.0f);
+}
+
+void BodyData::calculateDerivedData()
+{
+	int32_t count = getCount();
+	for (int32_t i = 0; i < count; ++i)
+	{
+		calculateDerivedData(i);
+	}
+}
+
+void BodyData::calculateDerivedData(int32_t index)
+{
+	const Transform &xf = transforms[index];
+	alglm::quat q = alglm::normalize(xf.orientation);
+
+	alglm::mat4 rotationMatrix = alglm::toMat4(q);
+	alglm::mat4 translationMatrix = alglm::translate(alglm::mat4(1.0f), xf.position);
+	transformMatrices[index] = translationMatrix * rotationMatrix;
+
+	alglm::mat3 rotation = alglm::mat3(rotationMatrix);
+	inverseInertiaTensorWorlds[index] = rotation * inverseInertiaTensors[index] * alglm::transpose(rotation);
+}
+
+void BodyData::clearAccumulators()
+{
+	std::fill(forceAccums.begin(), forceAccums.end(), alglm::vec3(0.0f));
+	std::fill(torqueAccums.begin(), torqueAccums.end(), alglm::vec3(0.0f));
+}
+} // namespace ale
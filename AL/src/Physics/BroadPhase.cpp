@@ -2,33 +2,56 @@
 
 namespace ale
 {
+const int32_t BroadPhase::QUALITY_CHECK_INTERVAL = 60;
+
 BroadPhase::BroadPhase()
 {
 	m_moveCount = 0;
+	m_pairCount = 0;
+	m_reinsertCount = 0;
+	m_rotationBudget = 0;
+	m_rebuildAreaRatio = 0.0f;
+	m_rebuiltAreaRatio = 0.0f;
+	m_qualityCheckCounter = 0;
 	m_moveCapacity = 16;
 	m_moveBuffer.resize(m_moveCapacity);
 }
 
-int32_t BroadPhase::createProxy(const AABB &aabb, void *userData)
+int32_t BroadPhase::createProxy(const AABB &aabb, void *userData, const CollisionFilter &filter, float margin)
 {
-	int32_t proxyId = m_tree.createProxy(aabb, userData);
+	int32_t proxyId = m_tree.createProxy(aabb, userData, filter, margin);
 	bufferMove(proxyId);
 	return proxyId;
 }
 
 void BroadPhase::destroyProxy(int32_t proxyId)
 {
+	unbufferMove(proxyId);
+	m_tree.destroyProxy(proxyId);
 }
 
-void BroadPhase::moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement)
+void BroadPhase::moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement, float margin,
+						   float predictionFactor)
 {
-	bool buffer = m_tree.moveProxy(proxyId, aabb, displacement);
+	bool buffer = m_tree.moveProxy(proxyId, aabb, displacement, margin, predictionFactor);
 	if (buffer)
 	{
+		++m_reinsertCount;
 		bufferMove(proxyId);
 	}
 }
 
+void BroadPhase::setFatAABB(int32_t proxyId, const AABB &fatAABB)
+{
+	m_tree.setFatAABB(proxyId, fatAABB);
+}
+
+void BroadPhase::setFilter(int32_t proxyId, const CollisionFilter &filter)
+{
+	m_tree.setFilter(proxyId, filter);
+	bufferMove(proxyId);
+}
+
 void BroadPhase::bufferMove(int32_t proxyId)
 {
 	if (m_moveCount == m_moveCapacity)
@@ -40,6 +63,106 @@ void BroadPhase::bufferMove(int32_t proxyId)
 	++m_moveCount;
 }
 
+void BroadPhase::unbufferMove(int32_t proxyId)
+{
+	// 제거된 proxy ID는 재사용될 수 있으므로 move buffer에서 무효화
+	for (int32_t i = 0; i < m_moveCount; ++i)
+	{
+		if (m_moveBuffer[i] == proxyId)
+		{
+			m_moveBuffer[i] = NULL_PROXY;
+		}
+	}
+}
+
+int32_t BroadPhase::getMoveCount() const
+{
+	return m_moveCount;
+}
+
+const int32_t *BroadPhase::getMoveBuffer() const
+{
+	return m_moveBuffer.data();
+}
+
+void BroadPhase::clearMoveBuffer()
+{
+	m_moveCount = 0;
+}
+
+void BroadPhase::updateQueryTree(int32_t queryCount)
+{
+	m_tree.updateWideTree(queryCount);
+}
+
+int32_t BroadPhase::getPairCount() const
+{
+	return m_pairCount;
+}
+
+int32_t BroadPhase::getReinsertCount() const
+{
+	return m_reinsertCount;
+}
+
+void BroadPhase::resetReinsertCount()
+{
+	m_reinsertCount = 0;
+}
+
+void BroadPhase::setTreeOptimization(int32_t rotationBudget, float rebuildAreaRatio)
+{
+	m_rotationBudget = rotationBudget;
+	m_rebuildAreaRatio = rebuildAreaRatio;
+	m_qualityCheckCounter = 0;
+}
+
+TreeQuality BroadPhase::getTreeQuality() const
+{
+	return m_tree.computeQuality();
+}
+
+void BroadPhase::rebuildTree()
+{
+	m_tree.rebuild();
+	m_rebuiltAreaRatio = m_tree.computeQuality().areaRatio;
+}
+
+void BroadPhase::optimizeTree()
+{
+	if (m_rotationBudget > 0)
+	{
+		m_tree.optimize(m_rotationBudget);
+	}
+
+	if (m_rebuildAreaRatio <= 0.0f || ++m_qualityCheckCounter < QUALITY_CHECK_INTERVAL)
+	{
+		return;
+	}
+
+	m_qualityCheckCounter = 0;
+	float areaRatio = m_tree.computeQuality().areaRatio;
+	if (m_rebuiltAreaRatio <= 0.0f || areaRatio > m_rebuiltAreaRatio * m_rebuildAreaRatio)
+	{
+		rebuildTree();
+	}
+}
+
+void *BroadPhase::getUserData(int32_t proxyId) const
+{
+	return m_tree.getUserData(proxyId);
+}
+
+const AABB &BroadPhase::getFatAABB(int32_t proxyId) const
+{
+	return m_tree.getFatAABB(proxyId);
+}
+
+bool BroadPhase::testOverlap(int32_t proxyIdA, int32_t proxyIdB) const
+{
+	return ale::testOverlap(m_tree.getFatAABB(proxyIdA), m_tree.getFatAABB(proxyIdB));
+}
+
 bool BroadPhase::queryCallback(int32_t proxyId)
 {
 	if (proxyId == m_queryProxyId)
@@ -47,7 +170,66 @@ bool BroadPhase::queryCallback(int32_t proxyId)
 		return true;
 	}
 
-	m_proxySet.insert({std::min(proxyId, m_queryProxyId), std::max(proxyId, m_queryProxyId)});
+	// 필터로 걸러지는 Pair는 버퍼에 넣지 않음
+	if (testFilter(m_queryFilter, m_tree.getFilter(proxyId)) == false)
+	{
+		return true;
+	}
+
+	uint64_t minId = static_cast<uint32_t>(std::min(proxyId, m_queryProxyId));
+	uint64_t maxId = static_cast<uint32_t>(std::max(proxyId, m_queryProxyId));
+	m_pairBuffer.push_back((minId << 32) | maxId);
 	return true;
 }
+
+void BroadPhase::sortPairs()
+{
+	size_t pairCount = m_pairBuffer.size();
+	if (pairCount < 2)
+	{
+		return;
+	}
+
+	m_pairSortBuffer.resize(pairCount);
+	uint64_t *src = m_pairBuffer.data();
+	uint64_t *dst = m_pairSortBuffer.data();
+
+	// 8비트씩 LSD 기수 정렬
+	for (int32_t shift = 0; shift < 64; shift += 8)
+	{
+		size_t count[256] = {};
+		for (size_t i = 0; i < pairCount; ++i)
+		{
+			++count[(src[i] >> shift) & 0xFF];
+		}
+
+		// 모든 키의 현재 자리값이 같으면 이번 자리는 건너뜀 (ID가 작으면 대부분의 상위 자리가 해당)
+		if (count[(src[0] >> shift) & 0xFF] == pairCount)
+		{
+			continue;
+		}
+
+		size_t offset = 0;
+		for (int32_t digit = 0; digit < 256; ++digit)
+		{
+			size_t digitCount = count[digit];
+			count[digit] = offset;
+			offset += digitCount;
+		}
+
+		for (size_t i = 0; i < pairCount; ++i)
+		{
+			uint64_t key = src[i];
+			dst[count[(key >> shift) & 0xFF]++] = key;
+		}
+
+		std::swap(src, dst);
+	}
+
+	// 정렬 결과가 임시 버퍼에 있으면 버퍼를 교체
+	if (src != m_pairBuffer.data())
+	{
+		m_pairBuffer.swap(m_pairSortBuffer);
+	}
+}
 } // namespace ale
\ No newline at end of file
@@ -58,6 +58,15 @@ contactMemberFunction Contact::createContactFunctions[32] = {
 	nullptr,							// 11111
 };
 
+const float Contact::WARM_START_DISTANCE_SQUARED = 0.02f * 0.02f;
+const float Contact::WARM_START_NORMAL_COS = 0.95f;
+const float Contact::EPA_FACE_TOLERANCE = 1e-4f;
+
+bool Contact::analyticEnabled[32] = {
+	true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true,
+	true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true,
+};
+
 Contact::Contact(Fixture *fixtureA, Fixture *fixtureB, int32_t indexA, int32_t indexB)
 	: m_fixtureA(fixtureA), m_fixtureB(fixtureB), m_indexA(indexA), m_indexB(indexB)
 {
@@ -68,11 +77,14 @@ Contact::Contact(Fixture *fixtureA, Fixture *fixtureB, int32_t indexA, int32_t i
 
 	m_indexA = indexA;
 	m_indexB = indexB;
+	m_islandIndexA = -1;
+	m_islandIndexB = -1;
 
 	m_prev = nullptr;
 	m_next = nullptr;
 
 	m_wasTouched = false;
+	m_manifold.pointsCount = 0;
 	m_nodeA.contact = nullptr;
 	m_nodeA.prev = nullptr;
 	m_nodeA.next = nullptr;
@@ -106,36 +118,79 @@ Contact *Contact::create(Fixture *fixtureA, Fixture *fixtureB, int32_t indexA, i
 	return createContactFunctions[type1 | type2](fixtureA, fixtureB, indexA, indexB);
 }
 
-void Contact::evaluate(Manifold &manifold, const Transform &transformA, const Transform &transformB, bool isSensor)
+void Contact::destroy(Contact *contact)
 {
-	Shape *shapeA = m_fixtureA->getShape();
-	Shape *shapeB = m_fixtureB->getShape();
+	// 파생 Contact는 멤버를 추가하지 않으므로 모두 sizeof(Contact) 크기의 블록을 사용
+	static_assert(sizeof(SphereToSphereContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(SphereToBoxContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(SphereToCapsuleContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(SphereToCylinderContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(BoxToBoxContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(BoxToCapsuleContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(BoxToCylinderContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(CylinderToCapsuleContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(CylinderToCylinderContact) == sizeof(Contact), "contact size mismatch");
+	static_assert(sizeof(CapsuleToCapsuleContact) == sizeof(Contact), "contact size mismatch");
+
+	// 센서 충돌 중이던 경우 touchNum 복구
+	if (contact->m_wasTouched && (contact->m_fixtureA->isSeonsor() || contact->m_fixtureB->isSeonsor()))
+	{
+		contact->m_fixtureA->decreaseTouchNum();
+		contact->m_fixtureB->decreaseTouchNum();
+	}
 
-	ConvexInfo convexA = shapeA->getShapeInfo(transformA);
-	ConvexInfo convexB = shapeB->getShapeInfo(transformB);
+	contact->~Contact();
+	PhysicsAllocator::m_blockAllocator.freeBlock(contact, sizeof(Contact));
+}
+
+void Contact::evaluate(Manifold &manifold, const Transform &transformA, const Transform &transformB, bool isSensor,
+					   PhysicsStats &stats)
+{
+	// Fixture가 Transform별로 캐시한 world space 정보를 모든 contact가 공유
+	const ConvexInfo &convexA = m_fixtureA->getConvexInfo(transformA);
+	const ConvexInfo &convexB = m_fixtureB->getConvexInfo(transformB);
 
 	SimplexArray simplexArray;
 	CollisionInfo collisionInfo;
 
 	simplexArray.simplexCount = 0;
+	simplexArray.iterationCount = 0;
 	collisionInfo.size = 0;
 
+	// 닫힌 형태의 식이 있는 충돌 타입은 GJK/EPA를 건너뜀
+	if (analyticEnabled[m_fixtureA->getType() | m_fixtureB->getType()] &&
+		findAnalyticCollisionPoints(convexA, convexB, collisionInfo))
+	{
+		if (collisionInfo.size > 0)
+		{
+			if (isSensor)
+			{
+				manifold.pointsCount = 1;
+			}
+			else
+			{
+				generateManifolds(collisionInfo, manifold, m_fixtureA, m_fixtureB);
+			}
+		}
+		return;
+	}
+
 	bool isCollide = getGjkResult(convexA, convexB, simplexArray);
+	stats.gjkIterations += simplexArray.iterationCount;
 
 	if (isCollide)
 	{
 		if (isSensor)
 		{
 			manifold.pointsCount = 1;
-			freeConvexInfo(convexA, convexB);
 			return;
 		}
 
 		EpaInfo epaInfo = getEpaResult(convexA, convexB, simplexArray);
+		stats.epaFaces += epaInfo.faceCount;
 
 		if (epaInfo.distance == -1.0f)
 		{
-			freeConvexInfo(convexA, convexB);
 			return;
 		}
 
@@ -143,11 +198,9 @@ void Contact::evaluate(Manifold &manifold, const Transform &transformA, const Tr
 
 		generateManifolds(collisionInfo, manifold, m_fixtureA, m_fixtureB);
 	}
-
-	freeConvexInfo(convexA, convexB);
 }
 
-void Contact::update()
+void Contact::update(PhysicsStats &stats)
 {
 	// 이전 프레임에서 두 객체가 충돌중이었는지 확인
 	bool touching = false;
@@ -163,7 +216,7 @@ void Contact::update()
 	{
 		isSensor = true;
 		m_manifold.pointsCount = 0;
-		evaluate(m_manifold, transformA, transformB, isSensor);
+		evaluate(m_manifold, transformA, transformB, isSensor, stats);
 		touching = m_manifold.pointsCount > 0;
 	}
 	else
@@ -175,19 +228,39 @@ void Contact::update()
 		// 3. manifold의 내부 값을 impulse를 제외하고 채워줌
 		// 4. 실제 충돌이 일어나지 않은 경우 manifold.pointCount = 0인 충돌 생성
 
-		// manifold의 충격량 0으로 초기화 및 old manifold 중
-		// 같은 충돌이 있는경우 Impulse 재사용
-		// id 는 충돌 도형의 type과 vertex 또는 line의 index 정보를 압축하여 결정
+		// 이전 manifold를 보관해 두고 같은 충돌 지점의 누적 충격량을 재사용 (warm starting)
+		// 충돌 지점은 polygon clipping으로 생성되어 feature index가 없으므로 bodyA 로컬 좌표를 ID로 사용
+		int32_t oldPointsCount = m_manifold.pointsCount;
+		ManifoldPoint oldPoints[MAX_MANIFOLD_COUNT];
+		std::copy(m_manifold.points, m_manifold.points + oldPointsCount, oldPoints);
+
 		m_manifold.pointsCount = 0;
-		evaluate(m_manifold, transformA, transformB, isSensor);
+		evaluate(m_manifold, transformA, transformB, isSensor, stats);
 		touching = m_manifold.pointsCount > 0;
 
+		alglm::mat3 rotationA = alglm::mat3(alglm::toMat4(alglm::normalize(transformA.orientation)));
+		alglm::mat3 inverseRotationA = alglm::transpose(rotationA);
+
 		for (int32_t i = 0; i < m_manifold.pointsCount; ++i)
 		{
 			ManifoldPoint &manifoldPoint = m_manifold.points[i];
 
+			manifoldPoint.localPoint = inverseRotationA * (manifoldPoint.pointA - transformA.position);
 			manifoldPoint.normalImpulse = 0.0f;
-			manifoldPoint.tangentImpulse = 0.0f;
+			manifoldPoint.tangentImpulse = alglm::vec3(0.0f);
+
+			for (int32_t j = 0; j < oldPointsCount; ++j)
+			{
+				const ManifoldPoint &oldPoint = oldPoints[j];
+
+				if (alglm::length2(oldPoint.localPoint - manifoldPoint.localPoint) < WARM_START_DISTANCE_SQUARED &&
+					alglm::dot(oldPoint.normal, manifoldPoint.normal) > WARM_START_NORMAL_COS)
+				{
+					manifoldPoint.normalImpulse = oldPoint.normalImpulse;
+					manifoldPoint.tangentImpulse = oldPoint.tangentImpulse;
+					break;
+				}
+			}
 		}
 	}
 
@@ -227,6 +300,11 @@ float Contact::getRestitution() const
 	return m_restitution;
 }
 
+Contact *Contact::getPrev()
+{
+	return m_prev;
+}
+
 Contact *Contact::getNext()
 {
 	return m_next;
@@ -252,6 +330,16 @@ int32_t Contact::getChildIndexB() const
 	return m_indexB;
 }
 
+int32_t Contact::getIslandIndexA() const
+{
+	return m_islandIndexA;
+}
+
+int32_t Contact::getIslandIndexB() const
+{
+	return m_islandIndexB;
+}
+
 ContactLink *Contact::getNodeA()
 {
 	return &m_nodeA;
@@ -277,6 +365,12 @@ void Contact::setNext(Contact *contact)
 	m_next = contact;
 }
 
+void Contact::setIslandIndices(int32_t indexA, int32_t indexB)
+{
+	m_islandIndexA = indexA;
+	m_islandIndexB = indexB;
+}
+
 void Contact::setFlag(EContactFlag flag)
 {
 	m_flags = m_flags | static_cast<int32_t>(flag);
@@ -287,6 +381,22 @@ void Contact::unsetFlag(EContactFlag flag)
 	m_flags = m_flags & ~static_cast<int32_t>(flag);
 }
 
+int32_t Contact::getFlags() const
+{
+	return m_flags;
+}
+
+bool Contact::wasTouched() const
+{
+	return m_wasTouched;
+}
+
+void Contact::restoreState(int32_t flags, bool wasTouched)
+{
+	m_flags = flags;
+	m_wasTouched = wasTouched;
+}
+
 bool Contact::hasFlag(EContactFlag flag)
 {
 	return (m_flags & static_cast<int32_t>(flag)) == static_cast<int32_t>(flag);
@@ -488,6 +598,45 @@ bool Contact::isDuplicatedPoint(const SimplexArray &simplexArray, const alglm::v
 	return false;
 }
 
+void Contact::setAnalyticEnabled(int32_t typeMask, bool enabled)
+{
+	analyticEnabled[typeMask] = enabled;
+}
+
+bool Contact::isAnalyticEnabled(int32_t typeMask)
+{
+	return analyticEnabled[typeMask];
+}
+
+bool Contact::findAnalyticCollisionPoints(const ConvexInfo &convexA, const ConvexInfo &convexB,
+										  CollisionInfo &collisionInfo)
+{
+	return false;
+}
+
+void Contact::addSphereCollisionPoint(const alglm::vec3 &centerA, float radiusA, const alglm::vec3 &centerB,
+									  float radiusB, CollisionInfo &collisionInfo)
+{
+	alglm::vec3 d = centerB - centerA;
+	float distance = alglm::length(d);
+	float radiusSum = radiusA + radiusB;
+
+	if (distance > radiusSum)
+	{
+		return;
+	}
+
+	// 중심이 겹친 경우 법선을 정할 수 없으므로 임의의 축 사용
+	alglm::vec3 normal = distance > 1e-6f ? d / distance : alglm::vec3(0.0f, 1.0f, 0.0f);
+
+	int32_t index = collisionInfo.size;
+	collisionInfo.normal[index] = normal;
+	collisionInfo.seperation[index] = radiusSum - distance;
+	collisionInfo.pointA[index] = centerA + normal * radiusA;
+	collisionInfo.pointB[index] = centerB - normal * radiusB;
+	++collisionInfo.size;
+}
+
 bool Contact::checkSphereToSphereCollide(const ConvexInfo &convexA, const ConvexInfo &convexB)
 {
 	if (alglm::length(convexA.center - convexB.center) < (convexA.radius + convexB.radius))
@@ -540,6 +689,7 @@ bool Contact::getGjkResult(const ConvexInfo &convexA, const ConvexInfo &convexB,
 
 		// 만약 newSupport가 direction과 내적(dot)했을 때 0 이하라면
 		// 더 이상 원점을 "방향 dir" 쪽에서 감쌀 수 없음 => 충돌X
+		simplexArray.iterationCount = iter + 1;
 		if (alglm::dot(supportPoint, dir) < 0 || isDuplicatedPoint(simplexArray, supportPoint))
 		{
 			return false; // 교차하지 않음
@@ -561,6 +711,241 @@ bool Contact::getGjkResult(const ConvexInfo &convexA, const ConvexInfo &convexB,
 	return false;
 }
 
+// 선분 위에서 원점과 가장 가까운 점을 구하고, 그 점을 표현하는 데 필요한 꼭짓점만 남김
+static alglm::vec3 _closestPointOnSegment(alglm::vec3 *points, int32_t &count)
+{
+	alglm::vec3 a = points[0];
+	alglm::vec3 b = points[1];
+	alglm::vec3 ab = b - a;
+
+	float t = alglm::dot(-a, ab);
+	float denom = alglm::dot(ab, ab);
+	if (t <= 0.0f || denom < 1e-12f)
+	{
+		count = 1;
+		return a;
+	}
+	if (t >= denom)
+	{
+		points[0] = b;
+		count = 1;
+		return b;
+	}
+
+	return a + ab * (t / denom);
+}
+
+// 삼각형 위에서 원점과 가장 가까운 점 (Voronoi 영역 검사)
+static alglm::vec3 _closestPointOnTriangle(alglm::vec3 *points, int32_t &count)
+{
+	alglm::vec3 a = points[0];
+	alglm::vec3 b = points[1];
+	alglm::vec3 c = points[2];
+	alglm::vec3 ab = b - a;
+	alglm::vec3 ac = c - a;
+
+	// 꼭짓점 a 영역
+	float d1 = alglm::dot(ab, -a);
+	float d2 = alglm::dot(ac, -a);
+	if (d1 <= 0.0f && d2 <= 0.0f)
+	{
+		count = 1;
+		return a;
+	}
+
+	// 꼭짓점 b 영역
+	float d3 = alglm::dot(ab, -b);
+	float d4 = alglm::dot(ac, -b);
+	if (d3 >= 0.0f && d4 <= d3)
+	{
+		points[0] = b;
+		count = 1;
+		return b;
+	}
+
+	// 변 ab 영역
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+	{
+		count = 2;
+		return a + ab * (d1 / (d1 - d3));
+	}
+
+	// 꼭짓점 c 영역
+	float d5 = alglm::dot(ab, -c);
+	float d6 = alglm::dot(ac, -c);
+	if (d6 >= 0.0f && d5 <= d6)
+	{
+		points[0] = c;
+		count = 1;
+		return c;
+	}
+
+	// 변 ac 영역
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+	{
+		points[1] = c;
+		count = 2;
+		return a + ac * (d2 / (d2 - d6));
+	}
+
+	// 변 bc 영역
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+	{
+		points[0] = b;
+		points[1] = c;
+		count = 2;
+		return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+	}
+
+	// 면 내부
+	float denom = 1.0f / (va + vb + vc);
+	return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// 사면체 위에서 원점과 가장 가까운 점. 원점을 포함하면 count를 4로 유지
+static alglm::vec3 _closestPointOnTetrahedron(alglm::vec3 *points, int32_t &count)
+{
+	const int32_t faces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+	alglm::vec3 closest(0.0f);
+	alglm::vec3 closestPoints[3];
+	int32_t closestCount = 4;
+	float minDistance2 = FLT_MAX;
+
+	for (int32_t i = 0; i < 4; ++i)
+	{
+		const alglm::vec3 &a = points[faces[i][0]];
+		const alglm::vec3 &b = points[faces[i][1]];
+		const alglm::vec3 &c = points[faces[i][2]];
+		const alglm::vec3 &d = points[faces[i][3]];
+
+		// 원점이 남은 꼭짓점과 같은 쪽에 있으면 이 면 바깥이 아님
+		alglm::vec3 normal = alglm::cross(b - a, c - a);
+		float signOrigin = alglm::dot(normal, -a);
+		float signD = alglm::dot(normal, d - a);
+		if (signOrigin * signD > 0.0f)
+		{
+			continue;
+		}
+
+		alglm::vec3 facePoints[3] = {a, b, c};
+		int32_t faceCount = 3;
+		alglm::vec3 point = _closestPointOnTriangle(facePoints, faceCount);
+		float distance2 = alglm::length2(point);
+		if (distance2 < minDistance2)
+		{
+			minDistance2 = distance2;
+			closest = point;
+			closestCount = faceCount;
+			for (int32_t j = 0; j < faceCount; ++j)
+			{
+				closestPoints[j] = facePoints[j];
+			}
+		}
+	}
+
+	// 모든 면 안쪽이면 원점 포함
+	if (closestCount == 4)
+	{
+		return alglm::vec3(0.0f);
+	}
+
+	count = closestCount;
+	for (int32_t i = 0; i < count; ++i)
+	{
+		points[i] = closestPoints[i];
+	}
+	return closest;
+}
+
+float Contact::getGjkDistance(const ConvexInfo &convexA, const ConvexInfo &convexB, alglm::vec3 &normal)
+{
+	const int32_t ITERATION = 32;
+	const float RELATIVE_TOLERANCE = 1e-4f;
+	const float OVERLAP_DISTANCE_SQUARED = 1e-10f;
+
+	alglm::vec3 points[4];
+	int32_t count = 0;
+
+	// 중심 차이에서 시작
+	alglm::vec3 v = convexA.center - convexB.center;
+	if (alglm::length2(v) < 1e-8f)
+	{
+		v = alglm::vec3(1.0f, 0.0f, 0.0f);
+	}
+	normal = alglm::normalize(-v);
+
+	for (int32_t iter = 0; iter < ITERATION; ++iter)
+	{
+		float vLength2 = alglm::length2(v);
+		if (vLength2 < OVERLAP_DISTANCE_SQUARED)
+		{
+			return 0.0f;
+		}
+
+		alglm::vec3 dir = -v / std::sqrt(vLength2);
+		alglm::vec3 w = getSupportPoint(convexA, convexB, dir).diff;
+
+		// 새 support point로 더 가까워지지 않으면 수렴
+		if (vLength2 - alglm::dot(v, w) <= RELATIVE_TOLERANCE * vLength2)
+		{
+			break;
+		}
+
+		bool isDuplicated = false;
+		for (int32_t i = 0; i < count; ++i)
+		{
+			if (alglm::length2(points[i] - w) < 1e-12f)
+			{
+				isDuplicated = true;
+				break;
+			}
+		}
+		if (isDuplicated)
+		{
+			break;
+		}
+
+		points[count] = w;
+		++count;
+
+		switch (count)
+		{
+		case 1:
+			v = points[0];
+			break;
+		case 2:
+			v = _closestPointOnSegment(points, count);
+			break;
+		case 3:
+			v = _closestPointOnTriangle(points, count);
+			break;
+		default:
+			v = _closestPointOnTetrahedron(points, count);
+			break;
+		}
+
+		// 사면체가 원점을 포함하면 겹친 상태
+		if (count == 4)
+		{
+			return 0.0f;
+		}
+	}
+
+	float distance = alglm::length(v);
+	if (distance * distance < OVERLAP_DISTANCE_SQUARED)
+	{
+		return 0.0f;
+	}
+
+	// v는 A - B 위의 최근접점이므로 A에서 B로 향하는 방향은 -v
+	normal = -v / distance;
+	return distance;
+}
+
 bool Contact::isSimilarDirection(alglm::vec3 v1, alglm::vec3 v2)
 {
 	return alglm::dot(v1, v2) > 0.0f;
@@ -723,6 +1108,7 @@ EpaInfo Contact::getEpaResult(const ConvexInfo &convexA, const ConvexInfo &conve
 	EpaInfo epaInfo;
 	epaInfo.normal = minNormal;
 	epaInfo.distance = minDistance;
+	epaInfo.faceCount = faceArray.count;
 
 	return epaInfo;
 }
@@ -762,11 +1148,14 @@ int32_t Contact::getFaceNormals(SimplexArray &simplexArray, FaceArray &faceArray
 			normal = -normal;
 		}
 
+		// 원점이 면 위에 있으면 (구 대 구처럼 첫 support 점들이 원점을 지나는 직선 위에 놓인 경우) 부동소수점 오차로
+		// 거리가 조금 음수가 될 수 있으므로 허용 오차 안의 값은 0으로 봄
 		float distance = alglm::dot(normal, a);
-		if (distance < 0)
+		if (distance < -EPA_FACE_TOLERANCE)
 		{
 			return -1;
 		}
+		distance = std::max(distance, 0.0f);
 
 		// 법선 벡터 저장
 		faceArray.normals[i / 3] = alglm::vec4(normal, distance);
@@ -1230,26 +1619,4 @@ void Contact::sizeUpFaceArray(FaceArray &faceArray, int32_t newMaxCount)
 	faceArray.faces = newFaces;
 	faceArray.normals = newNormals;
 }
-
-void Contact::freeConvexInfo(ConvexInfo &convexA, ConvexInfo &convexB)
-{
-	if (convexA.points != nullptr)
-	{
-		PhysicsAllocator::m_blockAllocator.freeBlock(convexA.points, sizeof(alglm::vec3) * convexA.pointsCount);
-	}
-	if (convexB.points != nullptr)
-	{
-		PhysicsAllocator::m_blockAllocator.freeBlock(convexB.points, sizeof(alglm::vec3) * convexB.pointsCount);
-	}
-
-	if (convexA.axes != nullptr)
-	{
-		PhysicsAllocator::m_blockAllocator.freeBlock(convexA.axes, sizeof(alglm::vec3) * convexA.axesCount);
-	}
-
-	if (convexB.axes != nullptr)
-	{
-		PhysicsAllocator::m_blockAllocator.freeBlock(convexB.axes, sizeof(alglm::vec3) * convexB.axesCount);
-	}
-}
 } // namespace ale
\ No newline at end of file
@@ -52,6 +52,12 @@ void ContactManager::addPair(void *proxyUserDataA, void *proxyUserDataB)
 		return;
 	}
 
+	// BodyA와 BodyB가 충돌 가능 관계인지 확인 (Fixture 필터는 BroadPhase에서 이미 검사)
+	if (bodyA->shouldCollide(bodyB) == false)
+	{
+		return;
+	}
+
 	// 동일 부위의 충돌이 있는 경우 return
 	ContactLink *link = bodyA->getContactLinks();
 	while (link)
@@ -63,21 +69,17 @@ void ContactManager::addPair(void *proxyUserDataA, void *proxyUserDataB)
 		link = link->next;
 	}
 
-	// BodyA와 BodyB가 충돌 가능 관계인지 확인
-	if (bodyA->shouldCollide(bodyB) == false)
-	{
-		return;
-	}
+	createContact(fixtureA, fixtureB, indexA, indexB);
+}
 
+Contact *ContactManager::createContact(Fixture *fixtureA, Fixture *fixtureB, int32_t indexA, int32_t indexB)
+{
 	// 충돌 생성
 	Contact *contact = Contact::create(fixtureA, fixtureB, indexA, indexB);
 
-	fixtureA = contact->getFixtureA();
-	fixtureB = contact->getFixtureB();
-	indexA = contact->getChildIndexA();
-	indexB = contact->getChildIndexB();
-	bodyA = fixtureA->getBody();
-	bodyB = fixtureB->getBody();
+	// Contact::create가 shape type 순서로 Fixture를 바꿀 수 있으므로 Contact에서 다시 가져옴
+	Rigidbody *bodyA = contact->getFixtureA()->getBody();
+	Rigidbody *bodyB = contact->getFixtureB()->getBody();
 
 	// contact를 world contactList 앞에 끼워넣기 (Contact*)
 	contact->setNext(m_contactList);
@@ -118,26 +120,163 @@ void ContactManager::addPair(void *proxyUserDataA, void *proxyUserDataB)
 	bodyB->setContactLinks(nodeB);
 
 	++m_contactCount;
+
+	return contact;
+}
+
+void ContactManager::destroy(Contact *contact)
+{
+	Rigidbody *bodyA = contact->getFixtureA()->getBody();
+	Rigidbody *bodyB = contact->getFixtureB()->getBody();
+
+	if (contact->hasFlag(EContactFlag::TOUCHING))
+	{
+		bodyA->setAwake();
+		bodyB->setAwake();
+	}
+
+	// world contactList에서 제거
+	Contact *prev = contact->getPrev();
+	Contact *next = contact->getNext();
+	if (prev != nullptr)
+	{
+		prev->setNext(next);
+	}
+	if (next != nullptr)
+	{
+		next->setPrev(prev);
+	}
+	if (contact == m_contactList)
+	{
+		m_contactList = next;
+	}
+
+	// bodyA의 contactLinks에서 제거
+	ContactLink *nodeA = contact->getNodeA();
+	if (nodeA->prev != nullptr)
+	{
+		nodeA->prev->next = nodeA->next;
+	}
+	if (nodeA->next != nullptr)
+	{
+		nodeA->next->prev = nodeA->prev;
+	}
+	if (nodeA == bodyA->getContactLinks())
+	{
+		bodyA->setContactLinks(nodeA->next);
+	}
+
+	// bodyB의 contactLinks에서 제거
+	ContactLink *nodeB = contact->getNodeB();
+	if (nodeB->prev != nullptr)
+	{
+		nodeB->prev->next = nodeB->next;
+	}
+	if (nodeB->next != nullptr)
+	{
+		nodeB->next->prev = nodeB->prev;
+	}
+	if (nodeB == bodyB->getContactLinks())
+	{
+		bodyB->setContactLinks(nodeB->next);
+	}
+
+	Contact::destroy(contact);
+	--m_contactCount;
+}
+
+void ContactManager::clear()
+{
+	Contact *contact = m_contactList;
+	while (contact != nullptr)
+	{
+		Contact *next = contact->getNext();
+		contact->getFixtureA()->getBody()->setContactLinks(nullptr);
+		contact->getFixtureB()->getBody()->setContactLinks(nullptr);
+		Contact::destroy(contact);
+		contact = next;
+	}
+
+	m_contactList = nullptr;
+	m_contactCount = 0;
 }
 
-void ContactManager::findNewContacts()
+bool ContactManager::testFatAABBOverlap(Contact *contact) const
 {
+	int32_t proxyIdA = contact->getFixtureA()->getFixtureProxy()[contact->getChildIndexA()].proxyId;
+	int32_t proxyIdB = contact->getFixtureB()->getFixtureProxy()[contact->getChildIndexB()].proxyId;
+
+	return m_broadPhase.testOverlap(proxyIdA, proxyIdB);
+}
+
+void ContactManager::findNewContacts(PhysicsStats &stats)
+{
+	// 이 단계에서는 Contact가 제거되지 않으므로 늘어난 개수가 새로 생성된 개수
+	int32_t oldContactCount = m_contactCount;
 	m_broadPhase.updatePairs(this);
+
+	stats.pairCount = m_broadPhase.getPairCount();
+	stats.newContactCount = m_contactCount - oldContactCount;
 }
 
-void ContactManager::collide()
+void ContactManager::collide(PhysicsStats &stats)
 {
 	Contact *contact = m_contactList;
 
 	// contactList 순회
 	while (contact)
 	{
+		Contact *next = contact->getNext();
+
+		Fixture *fixtureA = contact->getFixtureA();
+		Fixture *fixtureB = contact->getFixtureB();
+		Rigidbody *bodyA = fixtureA->getBody();
+		Rigidbody *bodyB = fixtureB->getBody();
+
+		// 필터가 바뀐 contact는 더 이상 충돌하지 않으면 제거
+		if (contact->hasFlag(EContactFlag::FILTER))
+		{
+			if (testFilter(fixtureA->getFilter(), fixtureB->getFilter()) == false ||
+				bodyA->shouldCollide(bodyB) == false)
+			{
+				destroy(contact);
+				contact = next;
+				continue;
+			}
+			contact->unsetFlag(EContactFlag::FILTER);
+		}
+
+		// 두 body 모두 잠들어 있거나 움직이지 않는 경우 이전 manifold 유지
+		bool activeA = bodyA->isAwake() && bodyA->getType() != EBodyType::STATIC_BODY;
+		bool activeB = bodyB->isAwake() && bodyB->getType() != EBodyType::STATIC_BODY;
+		if (activeA == false && activeB == false)
+		{
+			if (contact->hasFlag(EContactFlag::TOUCHING))
+			{
+				++stats.touchingContactCount;
+			}
+			contact = next;
+			continue;
+		}
+
+		// 두 Fat AABB가 떨어진 contact는 제거
+		// 다시 가까워지면 proxy가 Fat AABB 밖으로 이동하므로 move buffer를 통해 새로 생성됨
+		if (testFatAABBOverlap(contact) == false)
+		{
+			destroy(contact);
+			contact = next;
+			continue;
+		}
+
 		// 실제 충돌 여부를 검사하고 해당 충돌 정보인 manifold 생성
+		contact->update(stats);
 		if (contact->hasFlag(EContactFlag::TOUCHING))
 		{
-			contact->update();
+			++stats.touchingContactCount;
 		}
-		contact = contact->getNext();
+		contact = next;
 	}
+
+	stats.contactCount = m_contactCount;
 }
 } // namespace ale
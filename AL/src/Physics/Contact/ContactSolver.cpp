@@ -7,16 +7,62 @@ const float ContactSolver::NORMAL_STOP_VELOCITY = 0.0001f;
 const float ContactSolver::TANGENT_STOP_VELOCITY = 0.0001f;
 const float ContactSolver::NORMAL_SLEEP_VELOCITY = 1.0f;
 const float ContactSolver::TANGENT_SLEEP_VELOCITY = 1.0f;
+const float ContactSolver::RESTITUTION_THRESHOLD = 1.0f;
+const int32_t ContactSolver::SIMD_WIDTH = 4;
+const int32_t ContactSolver::MAX_COLOR_COUNT = 12;
+
+#ifdef AL_CONTACT_SOLVER_SSE
+static inline __m128 _select(__m128 mask, __m128 a, __m128 b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128 _dot(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz)
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+}
+
+static inline void _cross(__m128 &outX, __m128 &outY, __m128 &outZ, __m128 ax, __m128 ay, __m128 az, __m128 bx,
+						  __m128 by, __m128 bz)
+{
+	outX = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+	outY = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+	outZ = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+}
+
+// 열 우선 순서로 저장된 lane별 3x3 행렬과 벡터의 곱
+static inline void _mulMat3(__m128 &outX, __m128 &outY, __m128 &outZ, const float (&m)[9][4], __m128 x, __m128 y,
+							__m128 z)
+{
+	outX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(m[0]), x), _mm_mul_ps(_mm_load_ps(m[3]), y)),
+					  _mm_mul_ps(_mm_load_ps(m[6]), z));
+	outY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(m[1]), x), _mm_mul_ps(_mm_load_ps(m[4]), y)),
+					  _mm_mul_ps(_mm_load_ps(m[7]), z));
+	outZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(m[2]), x), _mm_mul_ps(_mm_load_ps(m[5]), y)),
+					  _mm_mul_ps(_mm_load_ps(m[8]), z));
+}
+#endif
 
 ContactSolver::ContactSolver(float duration, Contact **contacts, Position *positions, Velocity *velocities,
-							 int32_t bodyCount, int32_t contactCount)
+							 int32_t bodyCount, int32_t contactCount, StackAllocator &allocator)
 	: m_duration(duration), m_positions(positions), m_velocities(velocities), m_contacts(contacts),
-	  m_bodyCount(bodyCount), m_contactCount(contactCount)
+	  m_bodyCount(bodyCount), m_contactCount(contactCount), m_simdConstraints(nullptr), m_simdPoints(nullptr),
+	  m_overflowContacts(nullptr), m_simdConstraintCount(0), m_overflowCount(0), m_batchStackCount(0),
+	  m_allocator(allocator)
 {
 	m_positionConstraints = static_cast<ContactPositionConstraint *>(
-		PhysicsAllocator::m_stackAllocator.allocateStack(sizeof(ContactPositionConstraint) * contactCount));
+		m_allocator.allocateStack(sizeof(ContactPositionConstraint) * contactCount));
 	m_velocityConstraints = static_cast<ContactVelocityConstraint *>(
-		PhysicsAllocator::m_stackAllocator.allocateStack(sizeof(ContactVelocityConstraint) * contactCount));
+		m_allocator.allocateStack(sizeof(ContactVelocityConstraint) * contactCount));
+
+	int32_t pointCount = 0;
+	for (int32_t i = 0; i < contactCount; i++)
+	{
+		pointCount += m_contacts[i]->getManifold().pointsCount;
+	}
+	m_constraintPoints = static_cast<VelocityConstraintPoint *>(
+		m_allocator.allocateStack(sizeof(VelocityConstraintPoint) * pointCount));
+	int32_t pointOffset = 0;
 
 	for (int32_t i = 0; i < contactCount; i++)
 	{
@@ -39,24 +85,38 @@ ContactSolver::ContactSolver(float duration, Contact **contacts, Position *posit
 		m_velocityConstraints[i].restitution = contact->getRestitution();
 		m_velocityConstraints[i].worldCenterA = bodyA->getTransform().toMatrix() * alglm::vec4(shapeA->m_center, 1.0f);
 		m_velocityConstraints[i].worldCenterB = bodyB->getTransform().toMatrix() * alglm::vec4(shapeB->m_center, 1.0f);
-		m_velocityConstraints[i].indexA = bodyA->getIslandIndex();
-		m_velocityConstraints[i].indexB = bodyB->getIslandIndex();
+		m_velocityConstraints[i].indexA = contact->getIslandIndexA();
+		m_velocityConstraints[i].indexB = contact->getIslandIndexB();
 		m_velocityConstraints[i].invMassA = bodyA->getInverseMass();
 		m_velocityConstraints[i].invMassB = bodyB->getInverseMass();
 		m_velocityConstraints[i].invIA = bodyA->getInverseInertiaTensorWorld();
 		m_velocityConstraints[i].invIB = bodyB->getInverseInertiaTensorWorld();
+
+		// staticBody의 속도는 solver 안에서도 바뀌지 않아야 같은 색의 Contact가 staticBody를 공유할 수 있음
+		if (bodyA->getType() == EBodyType::STATIC_BODY)
+		{
+			m_velocityConstraints[i].invMassA = 0.0f;
+			m_velocityConstraints[i].invIA = alglm::mat3(0.0f);
+		}
+		if (bodyB->getType() == EBodyType::STATIC_BODY)
+		{
+			m_velocityConstraints[i].invMassB = 0.0f;
+			m_velocityConstraints[i].invIB = alglm::mat3(0.0f);
+		}
 		m_velocityConstraints[i].pointCount = manifold.pointsCount;
 		m_velocityConstraints[i].points = manifold.points;
+		m_velocityConstraints[i].constraintPoints = m_constraintPoints + pointOffset;
+		pointOffset += manifold.pointsCount;
 
 		// 위치 제약 설정
 		m_positionConstraints[i].worldCenterA = bodyA->getTransform().toMatrix() * alglm::vec4(shapeA->m_center, 1.0f);
 		m_positionConstraints[i].worldCenterB = bodyB->getTransform().toMatrix() * alglm::vec4(shapeB->m_center, 1.0f);
-		m_positionConstraints[i].indexA = bodyA->getIslandIndex();
-		m_positionConstraints[i].indexB = bodyB->getIslandIndex();
+		m_positionConstraints[i].indexA = contact->getIslandIndexA();
+		m_positionConstraints[i].indexB = contact->getIslandIndexB();
 		m_positionConstraints[i].invMassA = bodyA->getInverseMass();
 		m_positionConstraints[i].invMassB = bodyB->getInverseMass();
-		m_velocityConstraints[i].invIA = bodyA->getInverseInertiaTensorWorld();
-		m_velocityConstraints[i].invIB = bodyB->getInverseInertiaTensorWorld();
+		m_positionConstraints[i].invIA = bodyA->getInverseInertiaTensorWorld();
+		m_positionConstraints[i].invIB = bodyB->getInverseInertiaTensorWorld();
 		m_positionConstraints[i].pointCount = manifold.pointsCount;
 		m_positionConstraints[i].points = manifold.points;
 	}
@@ -64,151 +124,595 @@ ContactSolver::ContactSolver(float duration, Contact **contacts, Position *posit
 
 void ContactSolver::destroy()
 {
+	for (int32_t i = 0; i < m_batchStackCount; ++i)
+	{
+		m_allocator.freeStack();
+	}
+
 	for (int32_t i = 0; i < m_contactCount; i++)
 	{
 		m_positionConstraints[i].~ContactPositionConstraint();
 		m_velocityConstraints[i].~ContactVelocityConstraint();
 	}
 
-	PhysicsAllocator::m_stackAllocator.freeStack();
-	PhysicsAllocator::m_stackAllocator.freeStack();
+	m_allocator.freeStack();
+	m_allocator.freeStack();
+	m_allocator.freeStack();
 }
 
-void ContactSolver::solveVelocityConstraints()
+void ContactSolver::initializeVelocityConstraints()
 {
 	for (int32_t i = 0; i < m_contactCount; i++)
 	{
-		Contact *contact = m_contacts[i];
 		ContactVelocityConstraint &velocityConstraint = m_velocityConstraints[i];
-		int32_t pointCount = velocityConstraint.pointCount;
 		int32_t indexA = velocityConstraint.indexA;
 		int32_t indexB = velocityConstraint.indexB;
 
-		alglm::vec3 &linearVelocityA = m_velocities[indexA].linearVelocity;
-		alglm::vec3 &linearVelocityB = m_velocities[indexB].linearVelocity;
-		alglm::vec3 &angularVelocityA = m_velocities[indexA].angularVelocity;
-		alglm::vec3 &angularVelocityB = m_velocities[indexB].angularVelocity;
+		const alglm::vec3 &linearVelocityA = m_velocities[indexA].linearVelocity;
+		const alglm::vec3 &linearVelocityB = m_velocities[indexB].linearVelocity;
+		const alglm::vec3 &angularVelocityA = m_velocities[indexA].angularVelocity;
+		const alglm::vec3 &angularVelocityB = m_velocities[indexB].angularVelocity;
 
-		alglm::vec3 &linearVelocityBufferA = m_velocities[indexA].linearVelocityBuffer;
-		alglm::vec3 &linearVelocityBufferB = m_velocities[indexB].linearVelocityBuffer;
-		alglm::vec3 &angularVelocityBufferA = m_velocities[indexA].angularVelocityBuffer;
-		alglm::vec3 &angularVelocityBufferB = m_velocities[indexB].angularVelocityBuffer;
+		float inverseMasses = velocityConstraint.invMassA + velocityConstraint.invMassB;
 
-		bool isStop = true;
+		for (int32_t j = 0; j < velocityConstraint.pointCount; ++j)
+		{
+			ManifoldPoint &manifoldPoint = velocityConstraint.points[j];
+			VelocityConstraintPoint &constraintPoint = velocityConstraint.constraintPoints[j];
 
-		float seperationSum = 0.0f;
+			constraintPoint.rA = manifoldPoint.pointA - velocityConstraint.worldCenterA;
+			constraintPoint.rB = manifoldPoint.pointB - velocityConstraint.worldCenterB;
 
-		for (int32_t j = 0; j < pointCount; ++j)
-		{
-			seperationSum += velocityConstraint.points[j].seperation;
+			alglm::vec3 rnA = alglm::cross(constraintPoint.rA, manifoldPoint.normal);
+			alglm::vec3 rnB = alglm::cross(constraintPoint.rB, manifoldPoint.normal);
+			float normalEffectiveMass = inverseMasses + alglm::dot(rnA, velocityConstraint.invIA * rnA) +
+										alglm::dot(rnB, velocityConstraint.invIB * rnB);
+			constraintPoint.normalMass = normalEffectiveMass > 0.0f ? 1.0f / normalEffectiveMass : 0.0f;
+
+			// 충분히 빠르게 접근하는 경우에만 반발 적용
+			alglm::vec3 velocityA = linearVelocityA + alglm::cross(angularVelocityA, constraintPoint.rA);
+			alglm::vec3 velocityB = linearVelocityB + alglm::cross(angularVelocityB, constraintPoint.rB);
+			float normalSpeed = alglm::dot(velocityB - velocityA, manifoldPoint.normal);
+
+			constraintPoint.velocityBias = 0.0f;
+			if (normalSpeed < -RESTITUTION_THRESHOLD)
+			{
+				constraintPoint.velocityBias = -velocityConstraint.restitution * normalSpeed;
+			}
 		}
+	}
 
-		if (seperationSum <= 0.0f)
+	buildBatches();
+}
+
+void ContactSolver::buildBatches()
+{
+#ifdef AL_CONTACT_SOLVER_SSE
+	// 1. 탐욕적 색칠: 두 dynamic body가 모두 비어 있는 첫 번째 색을 배정
+	int32_t *colors = static_cast<int32_t *>(m_allocator.allocateStack(sizeof(int32_t) * m_contactCount));
+	++m_batchStackCount;
+
+	int32_t wordCount = (m_bodyCount + 63) / 64;
+	uint64_t *colorBodies =
+		static_cast<uint64_t *>(m_allocator.allocateStack(sizeof(uint64_t) * wordCount * MAX_COLOR_COUNT));
+	std::fill(colorBodies, colorBodies + wordCount * MAX_COLOR_COUNT, 0);
+
+	int32_t colorCounts[MAX_COLOR_COUNT] = {};
+	int32_t overflowCount = 0;
+
+	for (int32_t i = 0; i < m_contactCount; ++i)
+	{
+		Contact *contact = m_contacts[i];
+		bool isStaticA = contact->getFixtureA()->getBody()->getType() == EBodyType::STATIC_BODY;
+		bool isStaticB = contact->getFixtureB()->getBody()->getType() == EBodyType::STATIC_BODY;
+		int32_t indexA = m_velocityConstraints[i].indexA;
+		int32_t indexB = m_velocityConstraints[i].indexB;
+
+		colors[i] = -1;
+		for (int32_t c = 0; c < MAX_COLOR_COUNT; ++c)
 		{
-			continue;
+			uint64_t *bodies = colorBodies + c * wordCount;
+			uint64_t bitA = uint64_t(1) << (indexA & 63);
+			uint64_t bitB = uint64_t(1) << (indexB & 63);
+
+			if ((isStaticA == false && (bodies[indexA >> 6] & bitA)) ||
+				(isStaticB == false && (bodies[indexB >> 6] & bitB)))
+			{
+				continue;
+			}
+
+			if (isStaticA == false)
+			{
+				bodies[indexA >> 6] |= bitA;
+			}
+			if (isStaticB == false)
+			{
+				bodies[indexB >> 6] |= bitB;
+			}
+			colors[i] = c;
+			++colorCounts[c];
+			break;
 		}
 
-		for (int32_t j = 0; j < pointCount; ++j)
+		if (colors[i] < 0)
 		{
-			ManifoldPoint &manifoldPoint = velocityConstraint.points[j];
+			++overflowCount;
+		}
+	}
+
+	m_allocator.freeStack();
 
-			alglm::vec3 rA = manifoldPoint.pointA - velocityConstraint.worldCenterA; // bodyA의 충돌 지점까지의 벡터
-			alglm::vec3 rB = manifoldPoint.pointB - velocityConstraint.worldCenterB; // bodyB의 충돌 지점까지의 벡터
+	// 2. 색별로 SIMD_WIDTH개씩 묶을 배치와 충돌 지점 개수 계산
+	int32_t simdConstraintCount = 0;
+	for (int32_t c = 0; c < MAX_COLOR_COUNT; ++c)
+	{
+		simdConstraintCount += (colorCounts[c] + SIMD_WIDTH - 1) / SIMD_WIDTH;
+	}
 
-			// 상대 속도 계산
-			alglm::vec3 velocityA = linearVelocityA + alglm::cross(angularVelocityA, rA);
-			alglm::vec3 velocityB = linearVelocityB + alglm::cross(angularVelocityB, rB);
+	m_simdConstraints = static_cast<SimdVelocityConstraint *>(
+		m_allocator.allocateStack(sizeof(SimdVelocityConstraint) * simdConstraintCount));
+	++m_batchStackCount;
+	m_overflowContacts = static_cast<int32_t *>(m_allocator.allocateStack(sizeof(int32_t) * overflowCount));
+	++m_batchStackCount;
 
-			// rA, rB 중 1개라도 0.0f 면 continue (cross 연산 오류 발생 가능)
-			if (alglm::length2(rA) == 0.0f || alglm::length2(rB) == 0.0f)
+	m_simdConstraintCount = 0;
+	m_overflowCount = 0;
+	for (int32_t c = 0; c < MAX_COLOR_COUNT; ++c)
+	{
+		int32_t lane = SIMD_WIDTH;
+		for (int32_t i = 0; i < m_contactCount; ++i)
+		{
+			if (colors[i] != c)
 			{
 				continue;
 			}
 
-			// 상대 속도
-			alglm::vec3 relativeVelocity = velocityB - velocityA;
+			if (lane == SIMD_WIDTH)
+			{
+				SimdVelocityConstraint &constraint = m_simdConstraints[m_simdConstraintCount++];
+				std::fill(constraint.contactIndex, constraint.contactIndex + SIMD_WIDTH, -1);
+				constraint.pointCount = 0;
+				lane = 0;
+			}
 
-			// 법선 방향 속도
-			float normalSpeed = alglm::dot(relativeVelocity, manifoldPoint.normal);
-			float appliedNormalImpulse;
+			SimdVelocityConstraint &constraint = m_simdConstraints[m_simdConstraintCount - 1];
+			constraint.contactIndex[lane] = i;
+			constraint.pointCount = std::max(constraint.pointCount, m_velocityConstraints[i].pointCount);
+			++lane;
+		}
+	}
 
-			if (normalSpeed < -NORMAL_STOP_VELOCITY)
-			{
-				// std::cout << "normal in!!\n";
+	for (int32_t i = 0; i < m_contactCount; ++i)
+	{
+		if (colors[i] < 0)
+		{
+			m_overflowContacts[m_overflowCount++] = i;
+		}
+	}
+
+	// 3. AoS 제약 조건을 lane별 SoA 배치로 복사
+	int32_t pointCount = 0;
+	for (int32_t k = 0; k < m_simdConstraintCount; ++k)
+	{
+		pointCount += m_simdConstraints[k].pointCount;
+	}
 
-				float oldNormalImpulse = manifoldPoint.normalImpulse;
-				appliedNormalImpulse =
-					-(1.0f + velocityConstraint.restitution) * normalSpeed * (manifoldPoint.seperation / seperationSum);
-				float inverseMasses = (velocityConstraint.invMassA + velocityConstraint.invMassB);
-				float normalEffectiveMassA =
-					alglm::dot(alglm::cross(manifoldPoint.normal, rA),
-							   velocityConstraint.invIA * alglm::cross(manifoldPoint.normal, rA));
-				float normalEffectiveMassB =
-					alglm::dot(alglm::cross(manifoldPoint.normal, rB),
-							   velocityConstraint.invIB * alglm::cross(manifoldPoint.normal, rB));
+	m_simdPoints = static_cast<SimdVelocityConstraintPoint *>(
+		m_allocator.allocateStack(sizeof(SimdVelocityConstraintPoint) * pointCount));
+	++m_batchStackCount;
 
-				appliedNormalImpulse =
-					appliedNormalImpulse / (inverseMasses + normalEffectiveMassA + normalEffectiveMassB);
+	int32_t pointOffset = 0;
+	for (int32_t k = 0; k < m_simdConstraintCount; ++k)
+	{
+		SimdVelocityConstraint &constraint = m_simdConstraints[k];
+		constraint.pointOffset = pointOffset;
+		pointOffset += constraint.pointCount;
 
-				float newNormalImpulse = appliedNormalImpulse + oldNormalImpulse;
+		for (int32_t lane = 0; lane < SIMD_WIDTH; ++lane)
+		{
+			int32_t contactIndex = constraint.contactIndex[lane];
+			const ContactVelocityConstraint *velocityConstraint =
+				contactIndex >= 0 ? &m_velocityConstraints[contactIndex] : nullptr;
 
-				manifoldPoint.normalImpulse = newNormalImpulse;
+			constraint.indexA[lane] = velocityConstraint ? velocityConstraint->indexA : -1;
+			constraint.indexB[lane] = velocityConstraint ? velocityConstraint->indexB : -1;
+			constraint.invMassA[lane] = velocityConstraint ? velocityConstraint->invMassA : 0.0f;
+			constraint.invMassB[lane] = velocityConstraint ? velocityConstraint->invMassB : 0.0f;
+			constraint.friction[lane] = velocityConstraint ? velocityConstraint->friction : 0.0f;
 
-				if (manifoldPoint.normalImpulse <= 0.0f)
+			for (int32_t col = 0; col < 3; ++col)
+			{
+				for (int32_t row = 0; row < 3; ++row)
 				{
-					manifoldPoint.normalImpulse = 0.0f;
+					constraint.invIA[col * 3 + row][lane] = velocityConstraint ? velocityConstraint->invIA[col][row] : 0.0f;
+					constraint.invIB[col * 3 + row][lane] = velocityConstraint ? velocityConstraint->invIB[col][row] : 0.0f;
 				}
+			}
+
+			for (int32_t j = 0; j < constraint.pointCount; ++j)
+			{
+				SimdVelocityConstraintPoint &point = m_simdPoints[constraint.pointOffset + j];
 
-				linearVelocityBufferA -= velocityConstraint.invMassA * appliedNormalImpulse * manifoldPoint.normal;
-				linearVelocityBufferB += velocityConstraint.invMassB * appliedNormalImpulse * manifoldPoint.normal;
+				// 충돌 지점이 없는 lane은 모든 값이 0이므로 충격량이 생기지 않음
+				if (velocityConstraint == nullptr || j >= velocityConstraint->pointCount)
+				{
+					point.rAX[lane] = point.rAY[lane] = point.rAZ[lane] = 0.0f;
+					point.rBX[lane] = point.rBY[lane] = point.rBZ[lane] = 0.0f;
+					point.normalX[lane] = point.normalY[lane] = point.normalZ[lane] = 0.0f;
+					point.normalMass[lane] = 0.0f;
+					point.velocityBias[lane] = 0.0f;
+					point.normalImpulse[lane] = 0.0f;
+					point.tangentImpulseX[lane] = point.tangentImpulseY[lane] = point.tangentImpulseZ[lane] = 0.0f;
+					continue;
+				}
 
-				angularVelocityBufferA -=
-					velocityConstraint.invIA * alglm::cross(rA, appliedNormalImpulse * manifoldPoint.normal);
-				angularVelocityBufferB +=
-					velocityConstraint.invIB * alglm::cross(rB, appliedNormalImpulse * manifoldPoint.normal);
+				const ManifoldPoint &manifoldPoint = velocityConstraint->points[j];
+				const VelocityConstraintPoint &constraintPoint = velocityConstraint->constraintPoints[j];
+
+				point.rAX[lane] = constraintPoint.rA.x;
+				point.rAY[lane] = constraintPoint.rA.y;
+				point.rAZ[lane] = constraintPoint.rA.z;
+				point.rBX[lane] = constraintPoint.rB.x;
+				point.rBY[lane] = constraintPoint.rB.y;
+				point.rBZ[lane] = constraintPoint.rB.z;
+				point.normalX[lane] = manifoldPoint.normal.x;
+				point.normalY[lane] = manifoldPoint.normal.y;
+				point.normalZ[lane] = manifoldPoint.normal.z;
+				point.normalMass[lane] = constraintPoint.normalMass;
+				point.velocityBias[lane] = constraintPoint.velocityBias;
+				point.normalImpulse[lane] = manifoldPoint.normalImpulse;
+				point.tangentImpulseX[lane] = manifoldPoint.tangentImpulse.x;
+				point.tangentImpulseY[lane] = manifoldPoint.tangentImpulse.y;
+				point.tangentImpulseZ[lane] = manifoldPoint.tangentImpulse.z;
 			}
+		}
+	}
+#endif
+}
+
+void ContactSolver::warmStart()
+{
+	for (int32_t i = 0; i < m_contactCount; i++)
+	{
+		ContactVelocityConstraint &velocityConstraint = m_velocityConstraints[i];
+		int32_t indexA = velocityConstraint.indexA;
+		int32_t indexB = velocityConstraint.indexB;
+
+		alglm::vec3 &linearVelocityA = m_velocities[indexA].linearVelocity;
+		alglm::vec3 &linearVelocityB = m_velocities[indexB].linearVelocity;
+		alglm::vec3 &angularVelocityA = m_velocities[indexA].angularVelocity;
+		alglm::vec3 &angularVelocityB = m_velocities[indexB].angularVelocity;
+
+		for (int32_t j = 0; j < velocityConstraint.pointCount; ++j)
+		{
+			ManifoldPoint &manifoldPoint = velocityConstraint.points[j];
+			VelocityConstraintPoint &constraintPoint = velocityConstraint.constraintPoints[j];
+
+			alglm::vec3 impulse = manifoldPoint.normalImpulse * manifoldPoint.normal + manifoldPoint.tangentImpulse;
+
+			linearVelocityA -= velocityConstraint.invMassA * impulse;
+			angularVelocityA -= velocityConstraint.invIA * alglm::cross(constraintPoint.rA, impulse);
+			linearVelocityB += velocityConstraint.invMassB * impulse;
+			angularVelocityB += velocityConstraint.invIB * alglm::cross(constraintPoint.rB, impulse);
+		}
+	}
+}
+
+void ContactSolver::solveVelocityConstraints()
+{
+#ifdef AL_CONTACT_SOLVER_SSE
+	// 같은 색의 배치끼리는 body를 공유하지 않으므로 lane 간 속도 갱신이 충돌하지 않음
+	for (int32_t i = 0; i < m_simdConstraintCount; ++i)
+	{
+		solveSimdVelocityConstraint(m_simdConstraints[i]);
+	}
+
+	for (int32_t i = 0; i < m_overflowCount; ++i)
+	{
+		solveVelocityConstraint(m_overflowContacts[i]);
+	}
+#else
+	for (int32_t i = 0; i < m_contactCount; ++i)
+	{
+		solveVelocityConstraint(i);
+	}
+#endif
+}
+
+void ContactSolver::storeImpulses()
+{
+#ifdef AL_CONTACT_SOLVER_SSE
+	for (int32_t k = 0; k < m_simdConstraintCount; ++k)
+	{
+		const SimdVelocityConstraint &constraint = m_simdConstraints[k];
 
-			// 접선 방향 충격량 계산
-			alglm::vec3 tangentVelocity = relativeVelocity - (normalSpeed * manifoldPoint.normal);
-			alglm::vec3 tangent = alglm::normalize(tangentVelocity);
-			float tangentSpeed = alglm::dot(tangent, tangentVelocity);
+		for (int32_t lane = 0; lane < SIMD_WIDTH; ++lane)
+		{
+			int32_t contactIndex = constraint.contactIndex[lane];
+			if (contactIndex < 0)
+			{
+				continue;
+			}
 
-			if (tangentSpeed > TANGENT_STOP_VELOCITY && alglm::length2(tangent) != 0.0f)
+			ContactVelocityConstraint &velocityConstraint = m_velocityConstraints[contactIndex];
+			for (int32_t j = 0; j < velocityConstraint.pointCount; ++j)
 			{
-				float oldTangentImpulse = manifoldPoint.tangentImpulse;
-				float newTangentImpulse = tangentSpeed * (manifoldPoint.seperation / seperationSum);
+				const SimdVelocityConstraintPoint &point = m_simdPoints[constraint.pointOffset + j];
+				ManifoldPoint &manifoldPoint = velocityConstraint.points[j];
 
-				float inverseMasses = (velocityConstraint.invMassA + velocityConstraint.invMassB);
+				manifoldPoint.normalImpulse = point.normalImpulse[lane];
+				manifoldPoint.tangentImpulse =
+					alglm::vec3(point.tangentImpulseX[lane], point.tangentImpulseY[lane], point.tangentImpulseZ[lane]);
+			}
+		}
+	}
+#endif
+}
 
-				float tangentEffectiveMassA =
-					alglm::dot(alglm::cross(tangent, rA), velocityConstraint.invIA * alglm::cross(tangent, rA));
-				float tangentEffectiveMassB =
-					alglm::dot(alglm::cross(tangent, rB), velocityConstraint.invIB * alglm::cross(tangent, rB));
-				newTangentImpulse = newTangentImpulse / (inverseMasses + tangentEffectiveMassA + tangentEffectiveMassB);
-				newTangentImpulse += oldTangentImpulse;
+#ifdef AL_CONTACT_SOLVER_SSE
+void ContactSolver::solveSimdVelocityConstraint(const SimdVelocityConstraint &constraint)
+{
+	// lane별 body 속도 gather (빈 lane은 0)
+	alignas(16) float v[12][4];
+	for (int32_t lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		int32_t indexA = constraint.indexA[lane];
+		int32_t indexB = constraint.indexB[lane];
+		alglm::vec3 linearVelocityA = indexA >= 0 ? m_velocities[indexA].linearVelocity : alglm::vec3(0.0f);
+		alglm::vec3 angularVelocityA = indexA >= 0 ? m_velocities[indexA].angularVelocity : alglm::vec3(0.0f);
+		alglm::vec3 linearVelocityB = indexB >= 0 ? m_velocities[indexB].linearVelocity : alglm::vec3(0.0f);
+		alglm::vec3 angularVelocityB = indexB >= 0 ? m_velocities[indexB].angularVelocity : alglm::vec3(0.0f);
+
+		for (int32_t axis = 0; axis < 3; ++axis)
+		{
+			v[axis][lane] = linearVelocityA[axis];
+			v[3 + axis][lane] = angularVelocityA[axis];
+			v[6 + axis][lane] = linearVelocityB[axis];
+			v[9 + axis][lane] = angularVelocityB[axis];
+		}
+	}
 
-				float maxFriction = velocityConstraint.friction * manifoldPoint.normalImpulse;
-				newTangentImpulse = alglm::clamp(newTangentImpulse, -maxFriction, maxFriction);
+	__m128 vAX = _mm_load_ps(v[0]), vAY = _mm_load_ps(v[1]), vAZ = _mm_load_ps(v[2]);
+	__m128 wAX = _mm_load_ps(v[3]), wAY = _mm_load_ps(v[4]), wAZ = _mm_load_ps(v[5]);
+	__m128 vBX = _mm_load_ps(v[6]), vBY = _mm_load_ps(v[7]), vBZ = _mm_load_ps(v[8]);
+	__m128 wBX = _mm_load_ps(v[9]), wBY = _mm_load_ps(v[10]), wBZ = _mm_load_ps(v[11]);
+
+	const __m128 invMassA = _mm_load_ps(constraint.invMassA);
+	const __m128 invMassB = _mm_load_ps(constraint.invMassB);
+	const __m128 inverseMasses = _mm_add_ps(invMassA, invMassB);
+	const __m128 friction = _mm_load_ps(constraint.friction);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 stopVelocity = _mm_set1_ps(TANGENT_STOP_VELOCITY);
+	const __m128 minLength = _mm_set1_ps(FLT_MIN);
+
+	for (int32_t j = 0; j < constraint.pointCount; ++j)
+	{
+		SimdVelocityConstraintPoint &point = m_simdPoints[constraint.pointOffset + j];
+
+		const __m128 rAX = _mm_load_ps(point.rAX), rAY = _mm_load_ps(point.rAY), rAZ = _mm_load_ps(point.rAZ);
+		const __m128 rBX = _mm_load_ps(point.rBX), rBY = _mm_load_ps(point.rBY), rBZ = _mm_load_ps(point.rBZ);
+		const __m128 nX = _mm_load_ps(point.normalX), nY = _mm_load_ps(point.normalY), nZ = _mm_load_ps(point.normalZ);
+
+		// 접선 방향 충격량 계산 (누적 충격량을 마찰 원뿔 안으로 clamp)
+		__m128 cAX, cAY, cAZ, cBX, cBY, cBZ;
+		_cross(cAX, cAY, cAZ, wAX, wAY, wAZ, rAX, rAY, rAZ);
+		_cross(cBX, cBY, cBZ, wBX, wBY, wBZ, rBX, rBY, rBZ);
+		__m128 dvX = _mm_sub_ps(_mm_add_ps(vBX, cBX), _mm_add_ps(vAX, cAX));
+		__m128 dvY = _mm_sub_ps(_mm_add_ps(vBY, cBY), _mm_add_ps(vAY, cAY));
+		__m128 dvZ = _mm_sub_ps(_mm_add_ps(vBZ, cBZ), _mm_add_ps(vAZ, cAZ));
+
+		__m128 normalSpeed = _dot(dvX, dvY, dvZ, nX, nY, nZ);
+		__m128 tvX = _mm_sub_ps(dvX, _mm_mul_ps(normalSpeed, nX));
+		__m128 tvY = _mm_sub_ps(dvY, _mm_mul_ps(normalSpeed, nY));
+		__m128 tvZ = _mm_sub_ps(dvZ, _mm_mul_ps(normalSpeed, nZ));
+		__m128 tangentSpeed = _mm_sqrt_ps(_dot(tvX, tvY, tvZ, tvX, tvY, tvZ));
+
+		__m128 hasTangent = _mm_cmpgt_ps(tangentSpeed, stopVelocity);
+		__m128 invTangentSpeed = _mm_div_ps(one, _mm_max_ps(tangentSpeed, minLength));
+		__m128 tX = _mm_mul_ps(tvX, invTangentSpeed);
+		__m128 tY = _mm_mul_ps(tvY, invTangentSpeed);
+		__m128 tZ = _mm_mul_ps(tvZ, invTangentSpeed);
+
+		__m128 rtAX, rtAY, rtAZ, rtBX, rtBY, rtBZ, iX, iY, iZ;
+		_cross(rtAX, rtAY, rtAZ, rAX, rAY, rAZ, tX, tY, tZ);
+		_cross(rtBX, rtBY, rtBZ, rBX, rBY, rBZ, tX, tY, tZ);
+		__m128 tangentEffectiveMass = inverseMasses;
+		_mulMat3(iX, iY, iZ, constraint.invIA, rtAX, rtAY, rtAZ);
+		tangentEffectiveMass = _mm_add_ps(tangentEffectiveMass, _dot(rtAX, rtAY, rtAZ, iX, iY, iZ));
+		_mulMat3(iX, iY, iZ, constraint.invIB, rtBX, rtBY, rtBZ);
+		tangentEffectiveMass = _mm_add_ps(tangentEffectiveMass, _dot(rtBX, rtBY, rtBZ, iX, iY, iZ));
+		hasTangent = _mm_and_ps(hasTangent, _mm_cmpgt_ps(tangentEffectiveMass, zero));
+
+		__m128 lambda = _mm_div_ps(tangentSpeed, _mm_max_ps(tangentEffectiveMass, minLength));
+		__m128 oldTangentX = _mm_load_ps(point.tangentImpulseX);
+		__m128 oldTangentY = _mm_load_ps(point.tangentImpulseY);
+		__m128 oldTangentZ = _mm_load_ps(point.tangentImpulseZ);
+		__m128 newTangentX = _mm_sub_ps(oldTangentX, _mm_mul_ps(lambda, tX));
+		__m128 newTangentY = _mm_sub_ps(oldTangentY, _mm_mul_ps(lambda, tY));
+		__m128 newTangentZ = _mm_sub_ps(oldTangentZ, _mm_mul_ps(lambda, tZ));
+
+		__m128 maxFriction = _mm_mul_ps(friction, _mm_load_ps(point.normalImpulse));
+		__m128 tangentImpulseLength =
+			_mm_sqrt_ps(_dot(newTangentX, newTangentY, newTangentZ, newTangentX, newTangentY, newTangentZ));
+		__m128 scale = _select(_mm_cmpgt_ps(tangentImpulseLength, maxFriction),
+							   _mm_div_ps(maxFriction, _mm_max_ps(tangentImpulseLength, minLength)), one);
+		newTangentX = _select(hasTangent, _mm_mul_ps(newTangentX, scale), oldTangentX);
+		newTangentY = _select(hasTangent, _mm_mul_ps(newTangentY, scale), oldTangentY);
+		newTangentZ = _select(hasTangent, _mm_mul_ps(newTangentZ, scale), oldTangentZ);
+		_mm_store_ps(point.tangentImpulseX, newTangentX);
+		_mm_store_ps(point.tangentImpulseY, newTangentY);
+		_mm_store_ps(point.tangentImpulseZ, newTangentZ);
+
+		__m128 pX = _mm_sub_ps(newTangentX, oldTangentX);
+		__m128 pY = _mm_sub_ps(newTangentY, oldTangentY);
+		__m128 pZ = _mm_sub_ps(newTangentZ, oldTangentZ);
+
+		vAX = _mm_sub_ps(vAX, _mm_mul_ps(invMassA, pX));
+		vAY = _mm_sub_ps(vAY, _mm_mul_ps(invMassA, pY));
+		vAZ = _mm_sub_ps(vAZ, _mm_mul_ps(invMassA, pZ));
+		vBX = _mm_add_ps(vBX, _mm_mul_ps(invMassB, pX));
+		vBY = _mm_add_ps(vBY, _mm_mul_ps(invMassB, pY));
+		vBZ = _mm_add_ps(vBZ, _mm_mul_ps(invMassB, pZ));
+		_cross(cAX, cAY, cAZ, rAX, rAY, rAZ, pX, pY, pZ);
+		_mulMat3(iX, iY, iZ, constraint.invIA, cAX, cAY, cAZ);
+		wAX = _mm_sub_ps(wAX, iX);
+		wAY = _mm_sub_ps(wAY, iY);
+		wAZ = _mm_sub_ps(wAZ, iZ);
+		_cross(cBX, cBY, cBZ, rBX, rBY, rBZ, pX, pY, pZ);
+		_mulMat3(iX, iY, iZ, constraint.invIB, cBX, cBY, cBZ);
+		wBX = _mm_add_ps(wBX, iX);
+		wBY = _mm_add_ps(wBY, iY);
+		wBZ = _mm_add_ps(wBZ, iZ);
+
+		// 법선 방향 충격량 계산 (누적 충격량이 음수가 되지 않도록 clamp)
+		_cross(cAX, cAY, cAZ, wAX, wAY, wAZ, rAX, rAY, rAZ);
+		_cross(cBX, cBY, cBZ, wBX, wBY, wBZ, rBX, rBY, rBZ);
+		dvX = _mm_sub_ps(_mm_add_ps(vBX, cBX), _mm_add_ps(vAX, cAX));
+		dvY = _mm_sub_ps(_mm_add_ps(vBY, cBY), _mm_add_ps(vAY, cAY));
+		dvZ = _mm_sub_ps(_mm_add_ps(vBZ, cBZ), _mm_add_ps(vAZ, cAZ));
+		normalSpeed = _dot(dvX, dvY, dvZ, nX, nY, nZ);
+
+		__m128 oldNormalImpulse = _mm_load_ps(point.normalImpulse);
+		__m128 newNormalImpulse = _mm_max_ps(
+			_mm_sub_ps(oldNormalImpulse, _mm_mul_ps(_mm_load_ps(point.normalMass),
+													_mm_sub_ps(normalSpeed, _mm_load_ps(point.velocityBias)))),
+			zero);
+		_mm_store_ps(point.normalImpulse, newNormalImpulse);
+
+		__m128 appliedNormalImpulse = _mm_sub_ps(newNormalImpulse, oldNormalImpulse);
+		pX = _mm_mul_ps(appliedNormalImpulse, nX);
+		pY = _mm_mul_ps(appliedNormalImpulse, nY);
+		pZ = _mm_mul_ps(appliedNormalImpulse, nZ);
+
+		vAX = _mm_sub_ps(vAX, _mm_mul_ps(invMassA, pX));
+		vAY = _mm_sub_ps(vAY, _mm_mul_ps(invMassA, pY));
+		vAZ = _mm_sub_ps(vAZ, _mm_mul_ps(invMassA, pZ));
+		vBX = _mm_add_ps(vBX, _mm_mul_ps(invMassB, pX));
+		vBY = _mm_add_ps(vBY, _mm_mul_ps(invMassB, pY));
+		vBZ = _mm_add_ps(vBZ, _mm_mul_ps(invMassB, pZ));
+		_cross(cAX, cAY, cAZ, rAX, rAY, rAZ, pX, pY, pZ);
+		_mulMat3(iX, iY, iZ, constraint.invIA, cAX, cAY, cAZ);
+		wAX = _mm_sub_ps(wAX, iX);
+		wAY = _mm_sub_ps(wAY, iY);
+		wAZ = _mm_sub_ps(wAZ, iZ);
+		_cross(cBX, cBY, cBZ, rBX, rBY, rBZ, pX, pY, pZ);
+		_mulMat3(iX, iY, iZ, constraint.invIB, cBX, cBY, cBZ);
+		wBX = _mm_add_ps(wBX, iX);
+		wBY = _mm_add_ps(wBY, iY);
+		wBZ = _mm_add_ps(wBZ, iZ);
+	}
 
-				manifoldPoint.tangentImpulse = newTangentImpulse;
+	// lane별 body 속도 scatter (staticBody는 질량이 0이라 값이 바뀌지 않음)
+	_mm_store_ps(v[0], vAX);
+	_mm_store_ps(v[1], vAY);
+	_mm_store_ps(v[2], vAZ);
+	_mm_store_ps(v[3], wAX);
+	_mm_store_ps(v[4], wAY);
+	_mm_store_ps(v[5], wAZ);
+	_mm_store_ps(v[6], vBX);
+	_mm_store_ps(v[7], vBY);
+	_mm_store_ps(v[8], vBZ);
+	_mm_store_ps(v[9], wBX);
+	_mm_store_ps(v[10], wBY);
+	_mm_store_ps(v[11], wBZ);
+
+	for (int32_t lane = 0; lane < SIMD_WIDTH; ++lane)
+	{
+		int32_t indexA = constraint.indexA[lane];
+		int32_t indexB = constraint.indexB[lane];
+
+		if (indexA >= 0)
+		{
+			m_velocities[indexA].linearVelocity = alglm::vec3(v[0][lane], v[1][lane], v[2][lane]);
+			m_velocities[indexA].angularVelocity = alglm::vec3(v[3][lane], v[4][lane], v[5][lane]);
+		}
+		if (indexB >= 0)
+		{
+			m_velocities[indexB].linearVelocity = alglm::vec3(v[6][lane], v[7][lane], v[8][lane]);
+			m_velocities[indexB].angularVelocity = alglm::vec3(v[9][lane], v[10][lane], v[11][lane]);
+		}
+	}
+}
+#endif
+
+void ContactSolver::solveVelocityConstraint(int32_t i)
+{
+	ContactVelocityConstraint &velocityConstraint = m_velocityConstraints[i];
+	int32_t pointCount = velocityConstraint.pointCount;
+	int32_t indexA = velocityConstraint.indexA;
+	int32_t indexB = velocityConstraint.indexB;
 
-				float appliedTangentImpulse = newTangentImpulse - oldTangentImpulse;
+	alglm::vec3 &linearVelocityA = m_velocities[indexA].linearVelocity;
+	alglm::vec3 &linearVelocityB = m_velocities[indexB].linearVelocity;
+	alglm::vec3 &angularVelocityA = m_velocities[indexA].angularVelocity;
+	alglm::vec3 &angularVelocityB = m_velocities[indexB].angularVelocity;
 
-				linearVelocityBufferA += velocityConstraint.invMassA * appliedTangentImpulse * tangent;
-				linearVelocityBufferB -= velocityConstraint.invMassB * appliedTangentImpulse * tangent;
+	float inverseMasses = velocityConstraint.invMassA + velocityConstraint.invMassB;
+
+	for (int32_t j = 0; j < pointCount; ++j)
+	{
+		ManifoldPoint &manifoldPoint = velocityConstraint.points[j];
+		VelocityConstraintPoint &constraintPoint = velocityConstraint.constraintPoints[j];
+		const alglm::vec3 &rA = constraintPoint.rA;
+		const alglm::vec3 &rB = constraintPoint.rB;
+		const alglm::vec3 &normal = manifoldPoint.normal;
+
+		// 접선 방향 충격량 계산 (누적 충격량을 마찰 원뿔 안으로 clamp)
+		alglm::vec3 relativeVelocity = linearVelocityB + alglm::cross(angularVelocityB, rB) - linearVelocityA -
+									   alglm::cross(angularVelocityA, rA);
+		alglm::vec3 tangentVelocity = relativeVelocity - alglm::dot(relativeVelocity, normal) * normal;
+		float tangentSpeed = alglm::length(tangentVelocity);
+
+		if (tangentSpeed > TANGENT_STOP_VELOCITY)
+		{
+			alglm::vec3 tangent = tangentVelocity / tangentSpeed;
+			alglm::vec3 rtA = alglm::cross(rA, tangent);
+			alglm::vec3 rtB = alglm::cross(rB, tangent);
+			float tangentEffectiveMass = inverseMasses + alglm::dot(rtA, velocityConstraint.invIA * rtA) +
+										 alglm::dot(rtB, velocityConstraint.invIB * rtB);
+
+			if (tangentEffectiveMass > 0.0f)
+			{
+				alglm::vec3 oldTangentImpulse = manifoldPoint.tangentImpulse;
+				alglm::vec3 newTangentImpulse = oldTangentImpulse - (tangentSpeed / tangentEffectiveMass) * tangent;
 
-				angularVelocityBufferA += velocityConstraint.invIA * alglm::cross(rA, appliedTangentImpulse * tangent);
-				angularVelocityBufferB -= velocityConstraint.invIB * alglm::cross(rB, appliedTangentImpulse * tangent);
+				float maxFriction = velocityConstraint.friction * manifoldPoint.normalImpulse;
+				float tangentImpulseLength = alglm::length(newTangentImpulse);
+				if (tangentImpulseLength > maxFriction)
+				{
+					newTangentImpulse = tangentImpulseLength > 0.0f
+											? newTangentImpulse * (maxFriction / tangentImpulseLength)
+											: alglm::vec3(0.0f);
+				}
+
+				manifoldPoint.tangentImpulse = newTangentImpulse;
+				alglm::vec3 appliedTangentImpulse = newTangentImpulse - oldTangentImpulse;
+
+				linearVelocityA -= velocityConstraint.invMassA * appliedTangentImpulse;
+				angularVelocityA -= velocityConstraint.invIA * alglm::cross(rA, appliedTangentImpulse);
+				linearVelocityB += velocityConstraint.invMassB * appliedTangentImpulse;
+				angularVelocityB += velocityConstraint.invIB * alglm::cross(rB, appliedTangentImpulse);
 			}
 		}
-		linearVelocityA += linearVelocityBufferA;
-		linearVelocityB += linearVelocityBufferB;
-		angularVelocityA += angularVelocityBufferA;
-		angularVelocityB += angularVelocityBufferB;
-		linearVelocityBufferA = alglm::vec3(0.0f);
-		linearVelocityBufferB = alglm::vec3(0.0f);
-		angularVelocityBufferA = alglm::vec3(0.0f);
-		angularVelocityBufferB = alglm::vec3(0.0f);
+
+		// 법선 방향 충격량 계산 (누적 충격량이 음수가 되지 않도록 clamp)
+		relativeVelocity = linearVelocityB + alglm::cross(angularVelocityB, rB) - linearVelocityA -
+						   alglm::cross(angularVelocityA, rA);
+		float normalSpeed = alglm::dot(relativeVelocity, normal);
+
+		float oldNormalImpulse = manifoldPoint.normalImpulse;
+		float newNormalImpulse =
+			std::max(oldNormalImpulse - constraintPoint.normalMass * (normalSpeed - constraintPoint.velocityBias),
+					 0.0f);
+		manifoldPoint.normalImpulse = newNormalImpulse;
+
+		alglm::vec3 appliedNormalImpulse = (newNormalImpulse - oldNormalImpulse) * normal;
+
+		linearVelocityA -= velocityConstraint.invMassA * appliedNormalImpulse;
+		angularVelocityA -= velocityConstraint.invIA * alglm::cross(rA, appliedNormalImpulse);
+		linearVelocityB += velocityConstraint.invMassB * appliedNormalImpulse;
+		angularVelocityB += velocityConstraint.invIB * alglm::cross(rB, appliedNormalImpulse);
 	}
 }
 
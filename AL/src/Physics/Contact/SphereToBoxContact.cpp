@@ -40,4 +40,69 @@ void SphereToBoxContact::findCollisionPoints(const ConvexInfo &sphere, const Con
 	collisionInfo.pointB[0] = collisionInfo.pointA[0] - collisionInfo.normal[0] * collisionInfo.seperation[0];
 	++collisionInfo.size;
 }
+
+bool SphereToBoxContact::findAnalyticCollisionPoints(const ConvexInfo &sphere, const ConvexInfo &box,
+													 CollisionInfo &collisionInfo)
+{
+	// 구 중심을 박스 로컬 좌표로 옮긴 뒤 박스 범위로 clamp 하여 가장 가까운 점 계산
+	alglm::vec3 d = sphere.center - box.center;
+	float local[3];
+	float clamped[3];
+	bool isInside = true;
+	for (int32_t i = 0; i < 3; ++i)
+	{
+		local[i] = alglm::dot(d, box.axes[i]);
+		clamped[i] = std::max(-box.halfSize[i], std::min(local[i], box.halfSize[i]));
+		if (clamped[i] != local[i])
+		{
+			isInside = false;
+		}
+	}
+
+	if (isInside == false)
+	{
+		alglm::vec3 closest = box.center;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			closest += box.axes[i] * clamped[i];
+		}
+
+		alglm::vec3 delta = closest - sphere.center;
+		float distance = alglm::length(delta);
+		if (distance > sphere.radius)
+		{
+			return true;
+		}
+
+		alglm::vec3 normal = delta / distance;
+		collisionInfo.normal[0] = normal;
+		collisionInfo.seperation[0] = sphere.radius - distance;
+		collisionInfo.pointA[0] = sphere.center + normal * sphere.radius;
+		collisionInfo.pointB[0] = closest;
+		++collisionInfo.size;
+		return true;
+	}
+
+	// 구 중심이 박스 내부에 있는 경우 가장 가까운 면 방향으로 밀어냄
+	int32_t axis = 0;
+	float minFaceDistance = box.halfSize[0] - std::abs(local[0]);
+	for (int32_t i = 1; i < 3; ++i)
+	{
+		float faceDistance = box.halfSize[i] - std::abs(local[i]);
+		if (faceDistance < minFaceDistance)
+		{
+			minFaceDistance = faceDistance;
+			axis = i;
+		}
+	}
+
+	// 법선은 구(A)에서 박스(B)를 향하므로 면의 바깥 방향과 반대
+	alglm::vec3 normal = local[axis] < 0.0f ? box.axes[axis] : -box.axes[axis];
+	collisionInfo.normal[0] = normal;
+	collisionInfo.seperation[0] = sphere.radius + minFaceDistance;
+	collisionInfo.pointA[0] = sphere.center + normal * sphere.radius;
+	collisionInfo.pointB[0] = sphere.center - normal * minFaceDistance;
+	++collisionInfo.size;
+	return true;
+}
 } // namespace ale
\ No newline at end of file
@@ -45,4 +45,17 @@ void SphereToCapsuleContact::findCollisionPoints(const ConvexInfo &sphere, const
 	collisionInfo.pointB[0] = collisionInfo.pointA[0] - collisionInfo.normal[0] * collisionInfo.seperation[0];
 	++collisionInfo.size;
 }
+
+bool SphereToCapsuleContact::findAnalyticCollisionPoints(const ConvexInfo &sphere, const ConvexInfo &capsule,
+														 CollisionInfo &collisionInfo)
+{
+	// 캡슐 중심 선분 위에서 구 중심과 가장 가까운 점을 구해 구 대 구 충돌로 처리
+	float halfHeight = capsule.height * 0.5f;
+	float t = alglm::dot(sphere.center - capsule.center, capsule.axes[0]);
+	t = std::max(-halfHeight, std::min(t, halfHeight));
+	alglm::vec3 closest = capsule.center + capsule.axes[0] * t;
+
+	addSphereCollisionPoint(sphere.center, sphere.radius, closest, capsule.radius, collisionInfo);
+	return true;
+}
 } // namespace ale
\ No newline at end of file
@@ -31,4 +31,11 @@ void SphereToSphereContact::findCollisionPoints(const ConvexInfo &sphereA, const
 	collisionInfo.pointB[0] = collisionInfo.pointA[0] - collisionInfo.normal[0] * collisionInfo.seperation[0];
 	++collisionInfo.size;
 }
+
+bool SphereToSphereContact::findAnalyticCollisionPoints(const ConvexInfo &sphereA, const ConvexInfo &sphereB,
+														CollisionInfo &collisionInfo)
+{
+	addSphereCollisionPoint(sphereA.center, sphereA.radius, sphereB.center, sphereB.radius, collisionInfo);
+	return true;
+}
 } // namespace ale
\ No newline at end of file
@@ -2,6 +2,14 @@
 
 namespace ale
 {
+const int32_t DynamicTree::SAH_BIN_COUNT;
+const int32_t DynamicTree::WIDE_QUERY_STACK_SIZE;
+const int32_t DynamicTree::BINARY_QUERY_STACK_SIZE;
+// 4갈래 노드는 이진 트리의 한 단계 이상을 접으므로 깊이가 이진 트리 높이를 넘지 않고, 순회 스택은 깊이마다 최대 3개씩
+// 늘어남
+const int32_t DynamicTree::WIDE_TREE_MAX_HEIGHT = (DynamicTree::WIDE_QUERY_STACK_SIZE - 1) / 3;
+const int32_t DynamicTree::WIDE_TREE_QUERY_RATIO = 8;
+
 DynamicTree::DynamicTree()
 {
 	m_root = nullNode;
@@ -17,6 +25,11 @@ DynamicTree::DynamicTree()
 	m_nodes[m_nodeCapacity - 1].next = nullNode;
 	m_nodes[m_nodeCapacity - 1].height = -1;
 	m_freeNode = 0;
+
+	m_wideRoot = nullNode;
+	m_isWideTreeDirty = true;
+	m_staleQueryCount = 0;
+	m_optimizeCursor = 0;
 }
 
 DynamicTree::~DynamicTree()
@@ -60,14 +73,15 @@ void DynamicTree::freeNode(int32_t nodeId)
 	--m_nodeCount;
 }
 
-int32_t DynamicTree::createProxy(const AABB &aabb, void *userData)
+int32_t DynamicTree::createProxy(const AABB &aabb, void *userData, const CollisionFilter &filter, float margin)
 {
 	int32_t proxyId = allocateNode();
 
-	alglm::vec3 r(0.1, 0.1, 0.1);
+	alglm::vec3 r(margin);
 	m_nodes[proxyId].aabb.lowerBound = aabb.lowerBound - r;
 	m_nodes[proxyId].aabb.upperBound = aabb.upperBound + r;
 	m_nodes[proxyId].userData = userData;
+	m_nodes[proxyId].filter = filter;
 	m_nodes[proxyId].height = 0;
 
 	// insert leaf
@@ -78,11 +92,12 @@ int32_t DynamicTree::createProxy(const AABB &aabb, void *userData)
 
 void DynamicTree::destroyProxy(int32_t proxyId)
 {
-	// remove leaf
+	removeLeaf(proxyId);
 	freeNode(proxyId);
 }
 
-bool DynamicTree::moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement)
+bool DynamicTree::moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3 &displacement, float margin,
+							float predictionFactor)
 {
 	if (m_nodes[proxyId].aabb.contains(aabb))
 	{
@@ -92,11 +107,11 @@ bool DynamicTree::moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3
 	removeLeaf(proxyId);
 
 	AABB b = aabb;
-	alglm::vec3 r(0.1f);
+	alglm::vec3 r(margin);
 	b.lowerBound = b.lowerBound - r;
 	b.upperBound = b.upperBound + r;
 
-	alglm::vec3 d = 2.0f * displacement;
+	alglm::vec3 d = predictionFactor * displacement;
 
 	if (d.x < 0.0f)
 	{
@@ -131,12 +146,38 @@ bool DynamicTree::moveProxy(int32_t proxyId, const AABB &aabb, const alglm::vec3
 	return true;
 }
 
+void DynamicTree::setFatAABB(int32_t proxyId, const AABB &fatAABB)
+{
+	// 되돌린 step 동안 Fat AABB가 바뀌지 않은 Proxy는 트리를 건드리지 않음
+	const alglm::vec3 &lower = m_nodes[proxyId].aabb.lowerBound;
+	const alglm::vec3 &upper = m_nodes[proxyId].aabb.upperBound;
+	if (lower.x == fatAABB.lowerBound.x && lower.y == fatAABB.lowerBound.y && lower.z == fatAABB.lowerBound.z &&
+		upper.x == fatAABB.upperBound.x && upper.y == fatAABB.upperBound.y && upper.z == fatAABB.upperBound.z)
+	{
+		return;
+	}
+
+	removeLeaf(proxyId);
+	m_nodes[proxyId].aabb = fatAABB;
+	insertLeaf(proxyId);
+}
+
 void *DynamicTree::getUserData(int32_t proxyId) const
 {
 	// check proxyId range
 	return m_nodes[proxyId].userData;
 }
 
+const CollisionFilter &DynamicTree::getFilter(int32_t proxyId) const
+{
+	return m_nodes[proxyId].filter;
+}
+
+void DynamicTree::setFilter(int32_t proxyId, const CollisionFilter &filter)
+{
+	m_nodes[proxyId].filter = filter;
+}
+
 const AABB &DynamicTree::getFatAABB(int32_t proxyId) const
 {
 	return m_nodes[proxyId].aabb;
@@ -144,6 +185,8 @@ const AABB &DynamicTree::getFatAABB(int32_t proxyId) const
 
 void DynamicTree::insertLeaf(int32_t leaf)
 {
+	m_isWideTreeDirty = true;
+
 	if (m_root == nullNode)
 	{
 		m_root = leaf;
@@ -257,6 +300,8 @@ void DynamicTree::insertLeaf(int32_t leaf)
 
 void DynamicTree::removeLeaf(int32_t leaf)
 {
+	m_isWideTreeDirty = true;
+
 	if (leaf == m_root)
 	{
 		m_root = nullNode;
@@ -311,6 +356,500 @@ void DynamicTree::removeLeaf(int32_t leaf)
 	}
 }
 
+void DynamicTree::updateWideTree(int32_t queryCount)
+{
+	if (m_isWideTreeDirty == false)
+	{
+		return;
+	}
+
+	// 쿼리가 적을 때는 이진 트리를 순회하는 편이 전체를 다시 접는 것보다 싸므로, 이진 트리로 실행한 쿼리가 노드 수에
+	// 비례해 쌓였을 때만 다시 만듦
+	m_staleQueryCount += queryCount;
+	if (m_staleQueryCount * WIDE_TREE_QUERY_RATIO < m_nodeCount)
+	{
+		return;
+	}
+
+	rebuildWideTree();
+}
+
+void DynamicTree::rebuildWideTree()
+{
+	m_staleQueryCount = 0;
+
+	// 이진 트리가 너무 깊으면 순회 스택이 넘칠 수 있으므로 query가 이진 트리를 순회하도록 둠
+	if (m_root != nullNode && m_nodes[m_root].height > WIDE_TREE_MAX_HEIGHT)
+	{
+		return;
+	}
+
+	// 이전 프레임의 용량은 그대로 재사용
+	m_wideNodes.clear();
+	m_wideRoot = nullNode;
+	m_isWideTreeDirty = false;
+
+	if (m_root == nullNode)
+	{
+		return;
+	}
+
+	if (m_nodes[m_root].isLeaf() == false)
+	{
+		m_wideRoot = collapseNode(m_root);
+		return;
+	}
+
+	// 리프 하나뿐인 트리는 슬롯 하나만 사용하는 노드로 감싼다
+	WideTreeNode node;
+	for (int32_t i = 0; i < 4; ++i)
+	{
+		node.minX[i] = node.minY[i] = node.minZ[i] = FLT_MAX;
+		node.maxX[i] = node.maxY[i] = node.maxZ[i] = -FLT_MAX;
+		node.children[i] = nullNode;
+	}
+	const AABB &aabb = m_nodes[m_root].aabb;
+	node.minX[0] = aabb.lowerBound.x;
+	node.minY[0] = aabb.lowerBound.y;
+	node.minZ[0] = aabb.lowerBound.z;
+	node.maxX[0] = aabb.upperBound.x;
+	node.maxY[0] = aabb.upperBound.y;
+	node.maxZ[0] = aabb.upperBound.z;
+	node.children[0] = encodeWideLeaf(m_root);
+
+	m_wideRoot = 0;
+	m_wideNodes.push_back(node);
+}
+
+int32_t DynamicTree::collapseNode(int32_t nodeId)
+{
+	// 자식 두 개에서 시작해 표면적이 가장 큰 내부 노드를 자식 두 개로 펼치기를 4개가 될 때까지 반복
+	int32_t slots[4] = {m_nodes[nodeId].child1, m_nodes[nodeId].child2, nullNode, nullNode};
+	int32_t slotCount = 2;
+
+	while (slotCount < 4)
+	{
+		int32_t expandIndex = nullNode;
+		float maxSurface = -1.0f;
+		for (int32_t i = 0; i < slotCount; ++i)
+		{
+			const TreeNode &candidate = m_nodes[slots[i]];
+			if (candidate.isLeaf())
+			{
+				continue;
+			}
+
+			float surface = candidate.aabb.getSurface();
+			if (surface > maxSurface)
+			{
+				maxSurface = surface;
+				expandIndex = i;
+			}
+		}
+
+		if (expandIndex == nullNode)
+		{
+			break;
+		}
+
+		int32_t expandNode = slots[expandIndex];
+		slots[expandIndex] = m_nodes[expandNode].child1;
+		slots[slotCount++] = m_nodes[expandNode].child2;
+	}
+
+	int32_t wideIndex = static_cast<int32_t>(m_wideNodes.size());
+	m_wideNodes.emplace_back();
+
+	for (int32_t i = 0; i < 4; ++i)
+	{
+		float minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
+		float maxX = -FLT_MAX, maxY = -FLT_MAX, maxZ = -FLT_MAX;
+		int32_t child = nullNode;
+
+		if (i < slotCount)
+		{
+			const TreeNode &slotNode = m_nodes[slots[i]];
+			minX = slotNode.aabb.lowerBound.x;
+			minY = slotNode.aabb.lowerBound.y;
+			minZ = slotNode.aabb.lowerBound.z;
+			maxX = slotNode.aabb.upperBound.x;
+			maxY = slotNode.aabb.upperBound.y;
+			maxZ = slotNode.aabb.upperBound.z;
+
+			// 재귀 중 m_wideNodes가 재할당될 수 있으므로 참조를 들고 있지 않는다
+			child = slotNode.isLeaf() ? encodeWideLeaf(slots[i]) : collapseNode(slots[i]);
+		}
+
+		WideTreeNode &wideNode = m_wideNodes[wideIndex];
+		wideNode.minX[i] = minX;
+		wideNode.minY[i] = minY;
+		wideNode.minZ[i] = minZ;
+		wideNode.maxX[i] = maxX;
+		wideNode.maxY[i] = maxY;
+		wideNode.maxZ[i] = maxZ;
+		wideNode.children[i] = child;
+	}
+
+	return wideIndex;
+}
+
+TreeQuality DynamicTree::computeQuality() const
+{
+	TreeQuality quality;
+	quality.areaRatio = 0.0f;
+	quality.height = 0;
+	quality.proxyCount = 0;
+	quality.nodeCount = m_nodeCount;
+
+	if (m_root == nullNode)
+	{
+		return quality;
+	}
+
+	float internalArea = 0.0f;
+	for (int32_t i = 0; i < m_nodeCapacity; ++i)
+	{
+		const TreeNode &node = m_nodes[i];
+		if (node.height < 0)
+		{
+			continue;
+		}
+
+		if (node.isLeaf())
+		{
+			++quality.proxyCount;
+		}
+		else
+		{
+			internalArea += node.aabb.getSurface();
+		}
+	}
+
+	float rootArea = m_nodes[m_root].aabb.getSurface();
+	quality.areaRatio = rootArea > 0.0f ? internalArea / rootArea : 0.0f;
+	quality.height = m_nodes[m_root].height;
+	return quality;
+}
+
+void DynamicTree::optimize(int32_t nodeBudget)
+{
+	if (m_root == nullNode || nodeBudget <= 0)
+	{
+		return;
+	}
+
+	// 노드 배열을 순환하며 회전 가능한 내부 노드(높이 2 이상)를 찾음
+	int32_t visited = 0;
+	int32_t checked = 0;
+	while (checked < nodeBudget && visited < m_nodeCapacity)
+	{
+		if (m_optimizeCursor >= m_nodeCapacity)
+		{
+			m_optimizeCursor = 0;
+		}
+
+		int32_t index = m_optimizeCursor++;
+		++visited;
+		if (m_nodes[index].height < 2)
+		{
+			continue;
+		}
+
+		rotate(index);
+		++checked;
+	}
+}
+
+void DynamicTree::rotate(int32_t iA)
+{
+	int32_t iB = m_nodes[iA].child1;
+	int32_t iC = m_nodes[iA].child2;
+
+	// A의 AABB는 회전해도 바뀌지 않으므로 형제 노드의 표면적 변화만 비교
+	float bestDelta = 0.0f;
+	int32_t bestX = nullNode, bestS = nullNode, bestY = nullNode;
+
+	AABB aabb;
+	if (m_nodes[iC].isLeaf() == false)
+	{
+		int32_t iF = m_nodes[iC].child1;
+		int32_t iG = m_nodes[iC].child2;
+		float areaC = m_nodes[iC].aabb.getSurface();
+
+		// B <-> F
+		aabb.combine(m_nodes[iB].aabb, m_nodes[iG].aabb);
+		float delta = aabb.getSurface() - areaC;
+		if (delta < bestDelta && isBalancedSwap(iB, iC, iF))
+		{
+			bestDelta = delta;
+			bestX = iB, bestS = iC, bestY = iF;
+		}
+
+		// B <-> G
+		aabb.combine(m_nodes[iB].aabb, m_nodes[iF].aabb);
+		delta = aabb.getSurface() - areaC;
+		if (delta < bestDelta && isBalancedSwap(iB, iC, iG))
+		{
+			bestDelta = delta;
+			bestX = iB, bestS = iC, bestY = iG;
+		}
+	}
+
+	if (m_nodes[iB].isLeaf() == false)
+	{
+		int32_t iD = m_nodes[iB].child1;
+		int32_t iE = m_nodes[iB].child2;
+		float areaB = m_nodes[iB].aabb.getSurface();
+
+		// C <-> D
+		aabb.combine(m_nodes[iC].aabb, m_nodes[iE].aabb);
+		float delta = aabb.getSurface() - areaB;
+		if (delta < bestDelta && isBalancedSwap(iC, iB, iD))
+		{
+			bestDelta = delta;
+			bestX = iC, bestS = iB, bestY = iD;
+		}
+
+		// C <-> E
+		aabb.combine(m_nodes[iC].aabb, m_nodes[iD].aabb);
+		delta = aabb.getSurface() - areaB;
+		if (delta < bestDelta && isBalancedSwap(iC, iB, iE))
+		{
+			bestDelta = delta;
+			bestX = iC, bestS = iB, bestY = iE;
+		}
+	}
+
+	if (bestX != nullNode)
+	{
+		swapWithGrandchild(iA, bestX, bestS, bestY);
+	}
+}
+
+bool DynamicTree::isBalancedSwap(int32_t iX, int32_t iS, int32_t iY) const
+{
+	// 회전 뒤 S의 자식은 X와 Y의 형제, A의 자식은 Y와 S
+	const TreeNode &S = m_nodes[iS];
+	int32_t iZ = S.child1 == iY ? S.child2 : S.child1;
+	int32_t heightX = m_nodes[iX].height;
+	int32_t heightZ = m_nodes[iZ].height;
+	int32_t heightS = std::max(heightX, heightZ) + 1;
+	return std::abs(heightX - heightZ) <= 1 && std::abs(m_nodes[iY].height - heightS) <= 1;
+}
+
+void DynamicTree::swapWithGrandchild(int32_t iA, int32_t iX, int32_t iS, int32_t iY)
+{
+	// 회전은 리프 집합과 리프 AABB를 바꾸지 않으므로 4갈래 트리는 그대로 정확하고 다시 접지 않음
+	TreeNode &A = m_nodes[iA];
+	if (A.child1 == iX)
+	{
+		A.child1 = iY;
+	}
+	else
+	{
+		A.child2 = iY;
+	}
+	m_nodes[iY].parent = iA;
+
+	TreeNode &S = m_nodes[iS];
+	if (S.child1 == iY)
+	{
+		S.child1 = iX;
+	}
+	else
+	{
+		S.child2 = iX;
+	}
+	m_nodes[iX].parent = iS;
+
+	S.aabb.combine(m_nodes[S.child1].aabb, m_nodes[S.child2].aabb);
+	S.height = std::max(m_nodes[S.child1].height, m_nodes[S.child2].height) + 1;
+
+	// 리프 집합은 같으므로 A부터 루트까지 AABB는 그대로이고 높이만 갱신
+	int32_t index = iA;
+	while (index != nullNode)
+	{
+		TreeNode &node = m_nodes[index];
+		node.height = std::max(m_nodes[node.child1].height, m_nodes[node.child2].height) + 1;
+		index = node.parent;
+	}
+}
+
+void DynamicTree::rebuild()
+{
+	if (m_root == nullNode)
+	{
+		return;
+	}
+
+	// 리프는 남기고 내부 노드는 모두 해제
+	m_rebuildLeaves.clear();
+	for (int32_t i = 0; i < m_nodeCapacity; ++i)
+	{
+		if (m_nodes[i].height < 0)
+		{
+			continue;
+		}
+
+		if (m_nodes[i].isLeaf())
+		{
+			m_rebuildLeaves.push_back(i);
+		}
+		else
+		{
+			freeNode(i);
+		}
+	}
+
+	// Proxy ID와 Fat AABB가 그대로이므로 4갈래 트리는 다음에 이진 트리가 바뀔 때까지 그대로 사용
+	m_root = buildNode(m_rebuildLeaves.data(), static_cast<int32_t>(m_rebuildLeaves.size()));
+	m_nodes[m_root].parent = nullNode;
+	m_optimizeCursor = 0;
+}
+
+int32_t DynamicTree::buildNode(int32_t *leaves, int32_t count)
+{
+	if (count == 1)
+	{
+		return leaves[0];
+	}
+
+	// 리프 중심점의 범위에서 가장 긴 축을 분할 축으로 사용
+	alglm::vec3 centroidMin(FLT_MAX);
+	alglm::vec3 centroidMax(-FLT_MAX);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		const AABB &aabb = m_nodes[leaves[i]].aabb;
+		alglm::vec3 centroid = (aabb.lowerBound + aabb.upperBound) * 0.5f;
+		centroidMin = alglm::min(centroidMin, centroid);
+		centroidMax = alglm::max(centroidMax, centroid);
+	}
+
+	alglm::vec3 extent = centroidMax - centroidMin;
+	int32_t axis = 0;
+	if (extent.y > extent[axis])
+	{
+		axis = 1;
+	}
+	if (extent.z > extent[axis])
+	{
+		axis = 2;
+	}
+
+	int32_t leftCount = count / 2;
+	if (extent[axis] > 0.0f)
+	{
+		// 중심점을 구간에 나누어 담고 구간 경계마다 SAH 비용 계산
+		AABB binAABBs[SAH_BIN_COUNT];
+		int32_t binCounts[SAH_BIN_COUNT] = {};
+		float scale = SAH_BIN_COUNT / extent[axis];
+		auto getBin = [&](int32_t leaf) {
+			const AABB &aabb = m_nodes[leaf].aabb;
+			float centroid = (aabb.lowerBound[axis] + aabb.upperBound[axis]) * 0.5f;
+			int32_t bin = static_cast<int32_t>((centroid - centroidMin[axis]) * scale);
+			return std::min(bin, SAH_BIN_COUNT - 1);
+		};
+
+		for (int32_t i = 0; i < count; ++i)
+		{
+			int32_t bin = getBin(leaves[i]);
+			const AABB &aabb = m_nodes[leaves[i]].aabb;
+			if (binCounts[bin] == 0)
+			{
+				binAABBs[bin] = aabb;
+			}
+			else
+			{
+				binAABBs[bin].combine(aabb);
+			}
+			++binCounts[bin];
+		}
+
+		// 오른쪽부터 누적한 표면적과 개수
+		float rightAreas[SAH_BIN_COUNT];
+		int32_t rightCounts[SAH_BIN_COUNT];
+		AABB accumulated;
+		int32_t accumulatedCount = 0;
+		for (int32_t bin = SAH_BIN_COUNT - 1; bin > 0; --bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				if (accumulatedCount == 0)
+				{
+					accumulated = binAABBs[bin];
+				}
+				else
+				{
+					accumulated.combine(binAABBs[bin]);
+				}
+				accumulatedCount += binCounts[bin];
+			}
+			rightAreas[bin] = accumulatedCount > 0 ? accumulated.getSurface() : 0.0f;
+			rightCounts[bin] = accumulatedCount;
+		}
+
+		// 왼쪽에서 누적하며 bin 경계마다 비용 비교
+		float bestCost = FLT_MAX;
+		int32_t bestSplit = nullNode;
+		accumulatedCount = 0;
+		for (int32_t bin = 0; bin < SAH_BIN_COUNT - 1; ++bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				if (accumulatedCount == 0)
+				{
+					accumulated = binAABBs[bin];
+				}
+				else
+				{
+					accumulated.combine(binAABBs[bin]);
+				}
+				accumulatedCount += binCounts[bin];
+			}
+
+			if (accumulatedCount == 0 || rightCounts[bin + 1] == 0)
+			{
+				continue;
+			}
+
+			float cost = accumulated.getSurface() * accumulatedCount + rightAreas[bin + 1] * rightCounts[bin + 1];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestSplit = bin;
+			}
+		}
+
+		if (bestSplit != nullNode)
+		{
+			int32_t *middle = std::partition(leaves, leaves + count,
+											 [&](int32_t leaf) { return getBin(leaf) <= bestSplit; });
+			leftCount = static_cast<int32_t>(middle - leaves);
+		}
+	}
+
+	// 모든 중심점이 한 점에 모인 경우는 개수로 반씩 분할
+	if (leftCount == 0 || leftCount == count)
+	{
+		leftCount = count / 2;
+	}
+
+	int32_t child1 = buildNode(leaves, leftCount);
+	int32_t child2 = buildNode(leaves + leftCount, count - leftCount);
+
+	// allocateNode가 m_nodes를 재할당할 수 있으므로 할당 후에 참조
+	int32_t nodeId = allocateNode();
+	TreeNode &node = m_nodes[nodeId];
+	node.child1 = child1;
+	node.child2 = child2;
+	node.userData = nullptr;
+	node.aabb.combine(m_nodes[child1].aabb, m_nodes[child2].aabb);
+	node.height = std::max(m_nodes[child1].height, m_nodes[child2].height) + 1;
+	m_nodes[child1].parent = nodeId;
+	m_nodes[child2].parent = nodeId;
+	return nodeId;
+}
+
 float DynamicTree::getInsertionCostForLeaf(const AABB &leafAABB, int32_t child, float inheritedCost)
 {
 	AABB aabb;
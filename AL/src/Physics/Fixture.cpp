@@ -1,6 +1,7 @@
 #include "Physics/Fixture.h"
 #include "Physics/BroadPhase.h"
 #include "Physics/Rigidbody.h"
+#include "Physics/World.h"
 
 namespace ale
 {
@@ -15,6 +16,7 @@ Fixture::Fixture()
 	m_proxyCount = 0;
 	m_isSensor = false;
 	m_touchNum = 0;
+	m_hasConvexInfo = false;
 }
 
 void Fixture::create(Rigidbody *body, const FixtureDef *fd)
@@ -24,6 +26,7 @@ void Fixture::create(Rigidbody *body, const FixtureDef *fd)
 	m_restitution = fd->restitution;
 	m_isSensor = fd->isSensor;
 	m_touchNum = fd->touchNum;
+	m_filter = fd->filter;
 	this->m_body = body;
 
 	m_proxyCount = m_shape->getChildCount();
@@ -45,10 +48,14 @@ void Fixture::destroy()
 		m_proxies[i].fixture = nullptr;
 		// delete userData
 	}
+	freeConvexInfo();
+
+	// clone()이 실제 Shape 크기로 할당했으므로 소멸 전에 크기를 구해 같은 크기로 해제
+	int32_t shapeSize = m_shape->getSize();
 	m_shape->~Shape();
 
 	PhysicsAllocator::m_blockAllocator.freeBlock(m_proxies, sizeof(FixtureProxy) * m_proxyCount);
-	PhysicsAllocator::m_blockAllocator.freeBlock(m_shape, sizeof(Shape));
+	PhysicsAllocator::m_blockAllocator.freeBlock(m_shape, shapeSize);
 }
 
 void Fixture::createProxies(BroadPhase *broadPhase)
@@ -56,7 +63,8 @@ void Fixture::createProxies(BroadPhase *broadPhase)
 	for (int32_t i = 0; i < m_proxyCount; ++i)
 	{
 		m_shape->computeAABB(&m_proxies[i].aabb, m_body->getTransform());
-		m_proxies[i].proxyId = broadPhase->createProxy(m_proxies[i].aabb, &(m_proxies[i]));
+		m_proxies[i].proxyId =
+			broadPhase->createProxy(m_proxies[i].aabb, &(m_proxies[i]), m_filter, m_body->getAABBMargin());
 		m_proxies[i].fixture = this;
 		m_proxies[i].childIndex = i;
 	}
@@ -64,6 +72,15 @@ void Fixture::createProxies(BroadPhase *broadPhase)
 
 void Fixture::destroyProxies(BroadPhase *broadPhase)
 {
+	for (int32_t i = 0; i < m_proxyCount; ++i)
+	{
+		if (m_proxies[i].proxyId == BroadPhase::NULL_PROXY)
+		{
+			continue;
+		}
+		broadPhase->destroyProxy(m_proxies[i].proxyId);
+		m_proxies[i].proxyId = BroadPhase::NULL_PROXY;
+	}
 }
 
 void Fixture::synchronize(BroadPhase *broadPhase, const Transform &xf1, const Transform &xf2)
@@ -73,6 +90,8 @@ void Fixture::synchronize(BroadPhase *broadPhase, const Transform &xf1, const Tr
 		return;
 	}
 
+	float margin = m_body->getAABBMargin();
+	float predictionFactor = m_body->getAABBPredictionFactor();
 	for (int32_t i = 0; i < m_proxyCount; ++i)
 	{
 		FixtureProxy &proxy = m_proxies[i];
@@ -84,10 +103,17 @@ void Fixture::synchronize(BroadPhase *broadPhase, const Transform &xf1, const Tr
 		proxy.aabb.combine(aabb1, aabb2);
 
 		alglm::vec3 displacement = xf2.position - xf1.position;
-		broadPhase->moveProxy(proxy.proxyId, proxy.aabb, displacement);
+		broadPhase->moveProxy(proxy.proxyId, proxy.aabb, displacement, margin, predictionFactor);
 	}
 }
 
+void Fixture::restoreProxy(BroadPhase *broadPhase, int32_t childIndex, const AABB &aabb, const AABB &fatAABB)
+{
+	FixtureProxy &proxy = m_proxies[childIndex];
+	proxy.aabb = aabb;
+	broadPhase->setFatAABB(proxy.proxyId, fatAABB);
+}
+
 Rigidbody *Fixture::getBody() const
 {
 	return m_body;
@@ -118,11 +144,92 @@ const FixtureProxy *Fixture::getFixtureProxy() const
 	return m_proxies;
 }
 
+int32_t Fixture::getProxyCount() const
+{
+	return m_proxyCount;
+}
+
+const ConvexInfo &Fixture::getConvexInfo(const Transform &transform)
+{
+	const alglm::vec3 &p = transform.position;
+	const alglm::quat &q = transform.orientation;
+	const alglm::vec3 &cachedP = m_convexTransform.position;
+	const alglm::quat &cachedQ = m_convexTransform.orientation;
+
+	if (m_hasConvexInfo && p.x == cachedP.x && p.y == cachedP.y && p.z == cachedP.z && q.x == cachedQ.x &&
+		q.y == cachedQ.y && q.z == cachedQ.z && q.w == cachedQ.w)
+	{
+		return m_convexInfo;
+	}
+
+	freeConvexInfo();
+	m_convexInfo = m_shape->getShapeInfo(transform);
+	m_convexTransform = transform;
+	m_hasConvexInfo = true;
+	return m_convexInfo;
+}
+
+bool Fixture::rayCast(RayCastOutput *output, const RayCastInput &input) const
+{
+	return m_shape->rayCast(output, input, m_body->getTransform());
+}
+
+void Fixture::freeConvexInfo()
+{
+	if (m_hasConvexInfo == false)
+	{
+		return;
+	}
+
+	if (m_convexInfo.points != nullptr)
+	{
+		PhysicsAllocator::m_blockAllocator.freeBlock(m_convexInfo.points,
+													 sizeof(alglm::vec3) * m_convexInfo.pointsCount);
+	}
+	if (m_convexInfo.axes != nullptr)
+	{
+		PhysicsAllocator::m_blockAllocator.freeBlock(m_convexInfo.axes, sizeof(alglm::vec3) * m_convexInfo.axesCount);
+	}
+	m_hasConvexInfo = false;
+}
+
 bool Fixture::isSeonsor() const
 {
 	return m_isSensor;
 }
 
+const CollisionFilter &Fixture::getFilter() const
+{
+	return m_filter;
+}
+
+void Fixture::setFilter(const CollisionFilter &filter)
+{
+	m_filter = filter;
+
+	// 기존 contact는 다음 collide에서 다시 필터링
+	ContactLink *link = m_body->getContactLinks();
+	while (link)
+	{
+		Contact *contact = link->contact;
+		if (contact->getFixtureA() == this || contact->getFixtureB() == this)
+		{
+			contact->setFlag(EContactFlag::FILTER);
+		}
+		link = link->next;
+	}
+
+	BroadPhase *broadPhase = &m_body->getWorld()->m_contactManager.m_broadPhase;
+	for (int32_t i = 0; i < m_proxyCount; ++i)
+	{
+		if (m_proxies[i].proxyId == BroadPhase::NULL_PROXY)
+		{
+			continue;
+		}
+		broadPhase->setFilter(m_proxies[i].proxyId, filter);
+	}
+}
+
 int32_t Fixture::getTouchNum() const
 {
 	return m_touchNum;
@@ -138,4 +245,9 @@ void Fixture::decreaseTouchNum()
 	--m_touchNum;
 }
 
+void Fixture::setTouchNum(int32_t touchNum)
+{
+	m_touchNum = touchNum;
+}
+
 } // namespace ale
\ No newline at end of file
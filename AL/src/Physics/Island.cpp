@@ -3,37 +3,26 @@
 
 namespace ale
 {
-const int32_t Island::VELOCITY_ITERATION = 10;
+const int32_t Island::VELOCITY_ITERATION = 6;
 const int32_t Island::POSITION_ITERATION = 10;
 const float Island::STOP_LINEAR_VELOCITY = 1.0f;
 const float Island::STOP_ANGULAR_VELOCITY = 0.1f;
 
-Island::Island(int32_t bodyCount, int32_t contactCount)
+Island::Island(Rigidbody **bodies, Contact **contacts)
+	: m_bodies(bodies), m_contacts(contacts), m_positions(nullptr), m_velocities(nullptr), m_bodyCount(0),
+	  m_contactCount(0)
 {
-	m_bodyCount = 0;
-	m_contactCount = 0;
-	m_bodies =
-		static_cast<Rigidbody **>(PhysicsAllocator::m_stackAllocator.allocateStack(sizeof(Rigidbody *) * bodyCount));
-	m_contacts =
-		static_cast<Contact **>(PhysicsAllocator::m_stackAllocator.allocateStack(sizeof(Contact *) * contactCount));
 }
 
-void Island::destroy()
-{
-	PhysicsAllocator::m_stackAllocator.freeStack();
-	PhysicsAllocator::m_stackAllocator.freeStack();
-}
-
-void Island::solve(float duration)
+void Island::solve(float duration, StackAllocator &allocator)
 {
 	if (m_bodyCount == 1)
 	{
 		return;
 	}
-	m_positions =
-		static_cast<Position *>(PhysicsAllocator::m_stackAllocator.allocateStack(sizeof(Position) * m_bodyCount));
-	m_velocities =
-		static_cast<Velocity *>(PhysicsAllocator::m_stackAllocator.allocateStack(sizeof(Velocity) * m_bodyCount));
+
+	m_positions = static_cast<Position *>(allocator.allocateStack(sizeof(Position) * m_bodyCount));
+	m_velocities = static_cast<Velocity *>(allocator.allocateStack(sizeof(Velocity) * m_bodyCount));
 
 	// 힘을 적용하여 속도, 위치, 회전 업데이트
 	for (int32_t i = 0; i < m_bodyCount; i++)
@@ -49,11 +38,14 @@ void Island::solve(float duration)
 		m_velocities[i].angularVelocity = body->getAngularVelocity();
 
 		m_positions[i].positionBuffer = alglm::vec3(0.0f);
-		m_velocities[i].linearVelocityBuffer = alglm::vec3(0.0f);
-		m_velocities[i].angularVelocityBuffer = alglm::vec3(0.0f);
 	}
 
-	ContactSolver contactSolver(duration, m_contacts, m_positions, m_velocities, m_bodyCount, m_contactCount);
+	ContactSolver contactSolver(duration, m_contacts, m_positions, m_velocities, m_bodyCount, m_contactCount,
+								allocator);
+
+	// 이전 프레임의 누적 충격량을 먼저 적용 (warm starting)
+	contactSolver.initializeVelocityConstraints();
+	contactSolver.warmStart();
 
 	// 속도 제약 반복 횟수만큼 반복
 	for (int32_t i = 0; i < VELOCITY_ITERATION; ++i)
@@ -61,6 +53,7 @@ void Island::solve(float duration)
 		// 충돌 속도 제약 해결
 		contactSolver.solveVelocityConstraints();
 	}
+	contactSolver.storeImpulses();
 
 	// 위치 제약 처리 반복
 	for (int32_t i = 0; i < POSITION_ITERATION; ++i)
@@ -71,6 +64,7 @@ void Island::solve(float duration)
 	contactSolver.checkSleepContact();
 
 	// 위치, 회전, 속도 업데이트
+	float minSleepTime = FLT_MAX;
 	for (int32_t i = 0; i < m_bodyCount; ++i)
 	{
 
@@ -92,12 +86,25 @@ void Island::solve(float duration)
 		{
 			body->setAwake();
 		}
+		minSleepTime = std::min(minSleepTime, body->getSleepTime());
 
 		body->updateSweep();
 		body->setPosition(m_positions[i].position + m_positions[i].positionBuffer);
 		body->setLinearVelocity(m_velocities[i].linearVelocity);
 		body->setAngularVelocity(m_velocities[i].angularVelocity);
-		body->synchronizeFixtures();
+	}
+
+	// island의 모든 body가 충분히 오래 정지해 있으면 island 단위로 재움
+	// 하나라도 움직이면 contact로 연결된 body들이 서로를 받치고 있으므로 함께 깨어 있어야 함
+	if (minSleepTime > Rigidbody::START_SLEEP_TIME)
+	{
+		for (int32_t i = 0; i < m_bodyCount; ++i)
+		{
+			if (m_bodies[i]->getType() != EBodyType::STATIC_BODY)
+			{
+				m_bodies[i]->sleep();
+			}
+		}
 	}
 
 	contactSolver.destroy();
@@ -108,8 +115,21 @@ void Island::solve(float duration)
 		m_velocities[i].~Velocity();
 	}
 
-	PhysicsAllocator::m_stackAllocator.freeStack();
-	PhysicsAllocator::m_stackAllocator.freeStack();
+	allocator.freeStack();
+	allocator.freeStack();
+}
+
+void Island::synchronizeFixtures()
+{
+	if (m_bodyCount == 1)
+	{
+		return;
+	}
+
+	for (int32_t i = 0; i < m_bodyCount; ++i)
+	{
+		m_bodies[i]->synchronizeFixtures();
+	}
 }
 
 void Island::add(Rigidbody *body)
@@ -125,11 +145,14 @@ void Island::add(Contact *contact)
 	++m_contactCount;
 }
 
-void Island::clear()
+void Island::bindContactIndices()
 {
-	memset(m_bodies, 0, sizeof(Rigidbody *) * m_bodyCount);
-	memset(m_contacts, 0, sizeof(Contact *) * m_contactCount);
-	m_bodyCount = 0;
-	m_contactCount = 0;
+	for (int32_t i = 0; i < m_contactCount; ++i)
+	{
+		Contact *contact = m_contacts[i];
+		int32_t indexA = contact->getFixtureA()->getBody()->getIslandIndex();
+		int32_t indexB = contact->getFixtureB()->getBody()->getIslandIndex();
+		contact->setIslandIndices(indexA, indexB);
+	}
 }
 } // namespace ale
\ No newline at end of file
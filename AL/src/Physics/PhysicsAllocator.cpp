@@ -3,6 +3,6 @@
 namespace ale
 {
 // static 멤버 변수 정의
-BlockAllocator PhysicsAllocator::m_blockAllocator;
-StackAllocator PhysicsAllocator::m_stackAllocator;
+BlockAllocator PhysicsAllocator::m_blockAllocator(MemoryTag::Physics);
+StackAllocator PhysicsAllocator::m_stackAllocator(MemoryTag::Physics);
 } // namespace ale
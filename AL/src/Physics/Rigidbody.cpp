@@ -5,53 +5,47 @@
 
 namespace ale
 {
-static inline void _calculateTransformMatrix(alglm::mat4 &transformMatrix, const alglm::vec3 &position,
-											 const alglm::quat &orientation)
-{
-	alglm::mat4 rotationMatrix = alglm::toMat4(orientation);
-
-	alglm::mat4 translationMatrix = alglm::translate(alglm::mat4(1.0f), position);
-
-	transformMatrix = translationMatrix * rotationMatrix;
-}
-
-static inline void _transformInertiaTensor(alglm::mat3 &iitWorld, const alglm::mat3 &iitBody, const alglm::mat4 &rotmat)
-{
-	alglm::mat3 rotationMatrix = alglm::mat3(rotmat);
-
-	iitWorld = rotationMatrix * iitBody * alglm::transpose(rotationMatrix);
-}
-
 int32_t Rigidbody::BODY_COUNT = 0;
 const float Rigidbody::START_SLEEP_TIME = 0.3f;
 
-Rigidbody::Rigidbody(const BodyDef *bd, World *world)
+Rigidbody::Rigidbody(const BodyDef *bd, World *world, BodyData *data, int32_t dataIndex)
 {
 	this->m_world = world;
+	m_data = data;
+	m_dataIndex = dataIndex;
 	m_type = bd->m_type;
 	m_xfId = bd->m_xfId;
 
-	m_xf.position = bd->m_position;
-	m_xf.orientation = bd->m_orientation;
+	Transform &xf = m_data->transforms[m_dataIndex];
+	xf.position = bd->m_position;
+	xf.orientation = bd->m_orientation;
+	m_previousXf = xf;
 
-	m_linearVelocity = bd->m_linearVelocity;
-	m_angularVelocity = bd->m_angularVelocity;
+	m_data->linearVelocities[m_dataIndex] = bd->m_linearVelocity;
+	m_data->angularVelocities[m_dataIndex] = bd->m_angularVelocity;
 
-	m_linearDamping = bd->m_linearDamping;
-	m_angularDamping = bd->m_angularDamping;
+	m_data->linearDampings[m_dataIndex] = bd->m_linearDamping;
+	m_data->angularDampings[m_dataIndex] = bd->m_angularDamping;
 	m_gravityScale = bd->m_gravityScale;
+	m_aabbMargin = bd->m_aabbMargin;
+	m_aabbPredictionFactor = bd->m_aabbPredictionFactor;
 
-	m_posFreeze = bd->m_posFreeze;
-	m_rotFreeze = bd->m_rotFreeze;
+	m_data->posFreezes[m_dataIndex] = bd->m_posFreeze;
+	m_data->rotFreezes[m_dataIndex] = bd->m_rotFreeze;
 
 	m_useGravity = bd->m_useGravity;
+	m_isBullet = bd->m_isBullet;
 	m_canSleep = bd->m_canSleep;
-	m_isAwake = bd->m_isAwake;
+	m_data->awakeFlags[m_dataIndex] = bd->m_isAwake ? 1 : 0;
 	m_sleepTime = 0.0f;
-	m_acceleration = alglm::vec3(0.0f);
+	m_data->accelerations[m_dataIndex] = alglm::vec3(0.0f);
 	m_flags = 0;
 	m_contactLinks = nullptr;
+	m_fixtureCount = 0;
 	m_bodyID = BODY_COUNT++;
+	m_userData = bd->m_userData;
+
+	updateGravity();
 }
 
 Rigidbody::~Rigidbody()
@@ -70,14 +64,25 @@ void Rigidbody::synchronizeFixtures()
 		return;
 	}
 
+	const Sweep &sweep = m_data->sweeps[m_dataIndex];
 	Transform xf1;
-	xf1.position = m_sweep.p;
-	xf1.orientation = m_sweep.q;
+	xf1.position = sweep.p;
+	xf1.orientation = sweep.q;
 	BroadPhase *broadPhase = &m_world->m_contactManager.m_broadPhase;
 
 	for (int32_t i = 0; i < m_fixtureCount; ++i)
 	{
-		m_fixtures[i].synchronize(broadPhase, xf1, m_xf);
+		m_fixtures[i].synchronize(broadPhase, xf1, m_data->transforms[m_dataIndex]);
+	}
+}
+
+void Rigidbody::destroyFixtureProxies()
+{
+	BroadPhase *broadPhase = &m_world->m_contactManager.m_broadPhase;
+
+	for (int32_t i = 0; i < m_fixtureCount; ++i)
+	{
+		m_fixtures[i].destroyProxies(broadPhase);
 	}
 }
 
@@ -89,64 +94,27 @@ void Rigidbody::integrate(float duration)
 		return;
 	}
 
-	m_lastFrameAcceleration = m_acceleration;
-
-	// Set acceleration by F = ma
-	m_lastFrameAcceleration += (m_forceAccum * m_inverseMass);
-
-	// gravity
-	if (m_useGravity)
-		addGravity();
-
-	// set angular acceleration
-	alglm::vec3 angularAcceleration = m_inverseInertiaTensorWorld * m_torqueAccum;
-
-	// set velocity by accerleration
-	m_linearVelocity += (m_lastFrameAcceleration * duration) * m_posFreeze;
-	m_angularVelocity += (angularAcceleration * duration) * m_rotFreeze;
-
-	// impose drag
-	m_linearVelocity *= (1.0f - m_linearDamping);
-	m_angularVelocity *= (1.0f - m_angularDamping);
-
-	// set sweep (previous Transform)
-	m_sweep.p = m_xf.position;
-	m_sweep.q = m_xf.orientation;
-
-	// set position
-	m_xf.position += (m_linearVelocity * duration);
-
-	// set orientation
-	alglm::quat angularVelocityQuat = alglm::quat(0.0f, m_angularVelocity * duration); // 각속도를 쿼터니언으로 변환
-	m_xf.orientation += 0.5f * angularVelocityQuat * m_xf.orientation;				   // 쿼터니언 미분 공식
-	m_xf.orientation = alglm::normalize(m_xf.orientation);							   // 정규화하여 안정성 유지
-
-	calculateDerivedData();
-	clearAccumulators();
-
-	// if can sleep ~
+	// World는 BodyData::integrate로 모든 body를 한 번에 적분
+	m_data->integrate(m_dataIndex, duration);
 }
 
 void Rigidbody::calculateDerivedData()
 {
-	alglm::quat q = alglm::normalize(m_xf.orientation);
-
-	_calculateTransformMatrix(m_transformMatrix, m_xf.position, q);
-	_transformInertiaTensor(m_inverseInertiaTensorWorld, m_inverseInertiaTensor, m_transformMatrix);
+	m_data->calculateDerivedData(m_dataIndex);
 }
 
 void Rigidbody::addForce(const alglm::vec3 &force)
 {
-	m_forceAccum += force;
+	m_data->forceAccums[m_dataIndex] += force;
 }
 
 void Rigidbody::addForceAtPoint(const alglm::vec3 &force, const alglm::vec3 &point)
 {
 	alglm::vec3 pt = point;
-	pt -= m_xf.position;
+	pt -= m_data->transforms[m_dataIndex].position;
 
-	m_forceAccum += force;
-	m_torqueAccum += alglm::cross(pt, force);
+	m_data->forceAccums[m_dataIndex] += force;
+	m_data->torqueAccums[m_dataIndex] += alglm::cross(pt, force);
 }
 
 void Rigidbody::addForceAtBodyPoint(const alglm::vec3 &force, const alglm::vec3 &point)
@@ -157,89 +125,102 @@ void Rigidbody::addForceAtBodyPoint(const alglm::vec3 &force, const alglm::vec3
 
 void Rigidbody::addTorque(const alglm::vec3 &torque)
 {
-	m_torqueAccum += torque;
+	m_data->torqueAccums[m_dataIndex] += torque;
 }
 
-void Rigidbody::addGravity()
+void Rigidbody::updateGravity()
 {
-	if (m_type == EBodyType::DYNAMIC_BODY)
-	{
-		m_lastFrameAcceleration += alglm::vec3(0.0f, -m_gravityScale, 0.0f);
-	}
+	// 중력은 dynamic body에만 적용
+	bool hasGravity = m_useGravity && m_type == EBodyType::DYNAMIC_BODY;
+	m_data->gravities[m_dataIndex] = hasGravity ? m_gravityScale : 0.0f;
 }
 
 void Rigidbody::calculateForceAccum()
 {
-	while (!m_forceRegistry.empty())
+	for (const alglm::vec3 &force : m_forceRegistry)
 	{
-		addForce(m_forceRegistry.front());
-		m_forceRegistry.pop();
+		addForce(force);
 	}
+	m_forceRegistry.clear();
 }
 
 void Rigidbody::registerForce(const alglm::vec3 &force)
 {
 	setAwake();
 
-	m_forceRegistry.push(force);
+	m_forceRegistry.push_back(force);
 }
 
 void Rigidbody::clearAccumulators()
 {
 	// clear accumulate vector to zero
-	m_forceAccum.x = 0;
-	m_forceAccum.y = 0;
-	m_forceAccum.z = 0;
-
-	m_torqueAccum.x = 0;
-	m_torqueAccum.y = 0;
-	m_torqueAccum.z = 0;
+	m_data->forceAccums[m_dataIndex] = alglm::vec3(0.0f);
+	m_data->torqueAccums[m_dataIndex] = alglm::vec3(0.0f);
 }
 
 alglm::vec3 Rigidbody::getPointInWorldSpace(const alglm::vec3 &point) const
 {
-	alglm::vec4 ret = m_transformMatrix * alglm::vec4(point, 1.0f);
+	alglm::vec4 ret = m_data->transformMatrices[m_dataIndex] * alglm::vec4(point, 1.0f);
 	return alglm::vec3(ret);
 }
 
 const Transform &Rigidbody::getTransform() const
 {
-	return m_xf;
+	return m_data->transforms[m_dataIndex];
+}
+
+void Rigidbody::storePreviousTransform()
+{
+	m_previousXf = m_data->transforms[m_dataIndex];
+}
+
+const Transform &Rigidbody::getPreviousTransform() const
+{
+	return m_previousXf;
+}
+
+Transform Rigidbody::getInterpolatedTransform(float alpha) const
+{
+	const Transform &current = m_data->transforms[m_dataIndex];
+	Transform xf;
+	xf.position = alglm::mix(m_previousXf.position, current.position, alpha);
+	xf.orientation = alglm::normalize(alglm::slerp(m_previousXf.orientation, current.orientation, alpha));
+	return xf;
 }
 
 const alglm::vec3 &Rigidbody::getPosition() const
 {
-	return m_xf.position;
+	return m_data->transforms[m_dataIndex].position;
 }
 
 const alglm::quat &Rigidbody::getOrientation() const
 {
-	return m_xf.orientation;
+	return m_data->transforms[m_dataIndex].orientation;
 }
 
 const alglm::vec3 &Rigidbody::getLinearVelocity() const
 {
-	return m_linearVelocity;
+	return m_data->linearVelocities[m_dataIndex];
 }
 
 const alglm::vec3 &Rigidbody::getAngularVelocity() const
 {
-	return m_angularVelocity;
+	return m_data->angularVelocities[m_dataIndex];
 }
 
 const alglm::mat4 &Rigidbody::getTransformMatrix() const
 {
-	return m_transformMatrix;
+	return m_data->transformMatrices[m_dataIndex];
 }
 
 const alglm::mat3 &Rigidbody::getInverseInertiaTensorWorld() const
 {
-	return m_inverseInertiaTensorWorld;
+	return m_data->inverseInertiaTensorWorlds[m_dataIndex];
 }
 
 float Rigidbody::getInverseMass() const
 {
-	return m_inverseMass;
+	return m_data->inverseMasses[m_dataIndex];
 }
 
 int32_t Rigidbody::getTransformId() const
@@ -257,6 +238,37 @@ ContactLink *Rigidbody::getContactLinks()
 	return m_contactLinks;
 }
 
+World *Rigidbody::getWorld() const
+{
+	return m_world;
+}
+
+void Rigidbody::setAABBSettings(float margin, float predictionFactor)
+{
+	m_aabbMargin = margin;
+	m_aabbPredictionFactor = predictionFactor;
+}
+
+float Rigidbody::getAABBMargin() const
+{
+	return m_aabbMargin >= 0.0f ? m_aabbMargin : m_world->getAABBMargin();
+}
+
+float Rigidbody::getAABBPredictionFactor() const
+{
+	return m_aabbPredictionFactor >= 0.0f ? m_aabbPredictionFactor : m_world->getAABBPredictionFactor();
+}
+
+BodyHandle Rigidbody::getHandle() const
+{
+	return m_handle;
+}
+
+void Rigidbody::setHandle(BodyHandle handle)
+{
+	m_handle = handle;
+}
+
 EBodyType Rigidbody::getType() const
 {
 	return m_type;
@@ -267,30 +279,35 @@ int32_t Rigidbody::getBodyId() const
 	return m_bodyID;
 }
 
+uint64_t Rigidbody::getUserData() const
+{
+	return m_userData;
+}
+
 void Rigidbody::setPositionNoFreeze(alglm::vec3 &position)
 {
-	m_xf.position = position;
+	m_data->transforms[m_dataIndex].position = position;
 }
 
 void Rigidbody::setPosition(alglm::vec3 &position)
 {
-	position -= m_xf.position;
-	m_xf.position += position * m_posFreeze;
+	position -= m_data->transforms[m_dataIndex].position;
+	m_data->transforms[m_dataIndex].position += position * m_data->posFreezes[m_dataIndex];
 }
 
 void Rigidbody::setOrientation(alglm::quat &orientation)
 {
-	m_xf.orientation = orientation;
+	m_data->transforms[m_dataIndex].orientation = orientation;
 }
 
 void Rigidbody::setLinearVelocity(alglm::vec3 &linearVelocity)
 {
-	m_linearVelocity = linearVelocity * m_posFreeze;
+	m_data->linearVelocities[m_dataIndex] = linearVelocity * m_data->posFreezes[m_dataIndex];
 }
 
 void Rigidbody::setAngularVelocity(alglm::vec3 &angularVelocity)
 {
-	m_angularVelocity = angularVelocity * m_rotFreeze;
+	m_data->angularVelocities[m_dataIndex] = angularVelocity * m_data->rotFreezes[m_dataIndex];
 }
 
 void Rigidbody::setMassData(float mass, const alglm::mat3 &inertiaTensor)
@@ -298,16 +315,15 @@ void Rigidbody::setMassData(float mass, const alglm::mat3 &inertiaTensor)
 	// 추후 예외처리
 	if (mass == 0)
 	{
-		m_inverseMass = 0.0f;
-		m_inverseInertiaTensor = inertiaTensor;
+		m_data->inverseMasses[m_dataIndex] = 0.0f;
+		m_data->inverseInertiaTensors[m_dataIndex] = inertiaTensor;
 	}
 	else
 	{
-		m_inverseMass = 1 / mass;
+		m_data->inverseMasses[m_dataIndex] = 1 / mass;
 
 		// 역행렬 존재 가능한지 예외처리
-		m_inverseInertiaTensor = inertiaTensor;
-		m_inverseInertiaTensor = alglm::inverse(m_inverseInertiaTensor);
+		m_data->inverseInertiaTensors[m_dataIndex] = alglm::inverse(inertiaTensor);
 	}
 }
 
@@ -315,11 +331,11 @@ void Rigidbody::setMass(float mass)
 {
 	if (mass == 0)
 	{
-		m_inverseMass = 0.0f;
+		m_data->inverseMasses[m_dataIndex] = 0.0f;
 	}
 	else
 	{
-		m_inverseMass = 1 / mass;
+		m_data->inverseMasses[m_dataIndex] = 1 / mass;
 	}
 }
 
@@ -363,6 +379,14 @@ void Rigidbody::createFixture(const FixtureDef *fd)
 		m_fixtures[i].create(this, fd);
 		m_fixtures[i].createProxies(&m_world->m_contactManager.m_broadPhase);
 	}
+
+	// Fixture가 생긴 static이 아닌 body만 적분
+	m_data->movableFlags[m_dataIndex] = m_type != EBodyType::STATIC_BODY ? 1 : 0;
+}
+
+void Rigidbody::setDataIndex(int32_t dataIndex)
+{
+	m_dataIndex = dataIndex;
 }
 
 bool Rigidbody::hasFlag(EBodyFlag flag)
@@ -372,8 +396,9 @@ bool Rigidbody::hasFlag(EBodyFlag flag)
 
 void Rigidbody::updateSweep()
 {
-	m_sweep.p = m_xf.position;
-	m_sweep.q = m_xf.orientation;
+	const Transform &xf = m_data->transforms[m_dataIndex];
+	m_data->sweeps[m_dataIndex].p = xf.position;
+	m_data->sweeps[m_dataIndex].q = xf.orientation;
 }
 
 bool Rigidbody::shouldCollide(const Rigidbody *other) const
@@ -396,30 +421,40 @@ void Rigidbody::setSleep(float duration)
 	if (m_canSleep)
 	{
 		m_sleepTime += duration;
-
-		if (m_sleepTime > START_SLEEP_TIME)
-		{
-			m_isAwake = false;
-		}
 	}
 }
 
+float Rigidbody::getSleepTime() const
+{
+	return m_sleepTime;
+}
+
+void Rigidbody::sleep()
+{
+	m_data->awakeFlags[m_dataIndex] = 0;
+	m_sleepTime = 0.0f;
+	m_data->linearVelocities[m_dataIndex] = alglm::vec3(0.0f);
+	m_data->angularVelocities[m_dataIndex] = alglm::vec3(0.0f);
+}
+
 void Rigidbody::setAwake()
 {
 	m_sleepTime = 0.0f;
-	m_isAwake = true;
+	m_data->awakeFlags[m_dataIndex] = 1;
 }
 
 void Rigidbody::setRBComponentValue(BodyDef &bdDef)
 {
-	m_linearDamping = bdDef.m_linearDamping;
-	m_angularDamping = bdDef.m_angularDamping;
+	m_data->linearDampings[m_dataIndex] = bdDef.m_linearDamping;
+	m_data->angularDampings[m_dataIndex] = bdDef.m_angularDamping;
 	m_useGravity = bdDef.m_useGravity;
+	m_isBullet = bdDef.m_isBullet;
+	updateGravity();
 }
 
 bool Rigidbody::isAwake() const
 {
-	return m_isAwake;
+	return m_data->awakeFlags[m_dataIndex] != 0;
 }
 
 bool Rigidbody::isSensor() const
@@ -431,8 +466,65 @@ bool Rigidbody::isSensor() const
 	return false;
 }
 
+bool Rigidbody::isBullet() const
+{
+	return m_isBullet;
+}
+
+void Rigidbody::setBullet(bool flag)
+{
+	m_isBullet = flag;
+}
+
 int32_t Rigidbody::getTouchNum() const
 {
 	return m_fixtures[0].getTouchNum();
 }
+
+Fixture *Rigidbody::getFixtures()
+{
+	return m_fixtures;
+}
+
+int32_t Rigidbody::getFixtureCount() const
+{
+	return m_fixtureCount;
+}
+
+void Rigidbody::getState(BodyState &state) const
+{
+	// 스냅샷에 구조체를 그대로 복사하므로 같은 상태가 같은 바이트가 되도록 패딩까지 0으로 채움
+	std::memset(&state, 0, sizeof(BodyState));
+	state.bodyId = m_bodyID;
+	state.xf = m_data->transforms[m_dataIndex];
+	state.previousXf = m_previousXf;
+	state.sweep = m_data->sweeps[m_dataIndex];
+	state.linearVelocity = m_data->linearVelocities[m_dataIndex];
+	state.angularVelocity = m_data->angularVelocities[m_dataIndex];
+	state.acceleration = m_data->accelerations[m_dataIndex];
+	state.sleepTime = m_sleepTime;
+	state.isAwake = m_data->awakeFlags[m_dataIndex] != 0;
+	state.forceCount = static_cast<int32_t>(m_forceRegistry.size());
+}
+
+void Rigidbody::setState(const BodyState &state, const alglm::vec3 *forces)
+{
+	m_data->transforms[m_dataIndex] = state.xf;
+	m_previousXf = state.previousXf;
+	m_data->sweeps[m_dataIndex] = state.sweep;
+	m_data->linearVelocities[m_dataIndex] = state.linearVelocity;
+	m_data->angularVelocities[m_dataIndex] = state.angularVelocity;
+	m_data->accelerations[m_dataIndex] = state.acceleration;
+	m_sleepTime = state.sleepTime;
+	m_data->awakeFlags[m_dataIndex] = state.isAwake ? 1 : 0;
+	m_forceRegistry.assign(forces, forces + state.forceCount);
+
+	calculateDerivedData();
+	clearAccumulators();
+}
+
+const std::vector<alglm::vec3> &Rigidbody::getRegisteredForces() const
+{
+	return m_forceRegistry;
+}
 } // namespace ale
\ No newline at end of file
@@ -17,6 +17,11 @@ BoxShape *BoxShape::clone() const
 	return clone;
 }
 
+int32_t BoxShape::getSize() const
+{
+	return sizeof(BoxShape);
+}
+
 int32_t BoxShape::getChildCount() const
 {
 	return 1;
@@ -24,39 +29,123 @@ int32_t BoxShape::getChildCount() const
 
 void BoxShape::computeAABB(AABB *aabb, const Transform &xf) const
 {
-	// update vertices
-	std::vector<alglm::vec3> vertexVector(m_vertices.begin(), m_vertices.end());
-	alglm::mat4 rotationMatrix = alglm::toMat4(alglm::normalize(xf.orientation));
-	alglm::mat4 translationMatrix = alglm::translate(alglm::mat4(1.0f), xf.position);
-	alglm::mat4 transformMatrix = translationMatrix * rotationMatrix;
-
-	alglm::vec3 upper(std::numeric_limits<float>::lowest());
-	alglm::vec3 lower(std::numeric_limits<float>::max());
+	// 회전된 박스의 축별 반지름은 |R| * halfSize
+	alglm::mat3 rotation = xf.toRotationMatrix();
+	alglm::vec3 center = rotation * m_center + xf.position;
+	alglm::vec3 extents(std::fabs(rotation[0].x) * m_halfSize.x + std::fabs(rotation[1].x) * m_halfSize.y +
+							std::fabs(rotation[2].x) * m_halfSize.z,
+						std::fabs(rotation[0].y) * m_halfSize.x + std::fabs(rotation[1].y) * m_halfSize.y +
+							std::fabs(rotation[2].y) * m_halfSize.z,
+						std::fabs(rotation[0].z) * m_halfSize.x + std::fabs(rotation[1].z) * m_halfSize.y +
+							std::fabs(rotation[2].z) * m_halfSize.z);
+
+	aabb->upperBound = center + extents;
+	aabb->lowerBound = center - extents;
+}
 
-	for (alglm::vec3 &vertex : vertexVector)
+bool BoxShape::rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const
+{
+	// 박스 로컬 좌표계 (중심 원점)로 변환
+	alglm::mat3 rotation = alglm::mat3(alglm::toMat4(alglm::normalize(xf.orientation)));
+	alglm::mat3 invRotation = alglm::transpose(rotation);
+	alglm::vec3 p = invRotation * (input.p1 - xf.position) - m_center;
+	alglm::vec3 d = invRotation * (input.p2 - input.p1);
+	float radius = input.radius;
+
+	// 구 반지름만큼 늘린 박스와 slab 검사
+	float tMin = -FLT_MAX;
+	float tMax = input.maxFraction;
+	alglm::vec3 normal(0.0f);
+	for (int32_t i = 0; i < 3; ++i)
 	{
-		alglm::vec4 v = transformMatrix * alglm::vec4(vertex, 1.0f);
-		vertex = alglm::vec3(v.x, v.y, v.z);
-
-		upper.x = std::max(upper.x, vertex.x);
-		upper.y = std::max(upper.y, vertex.y);
-		upper.z = std::max(upper.z, vertex.z);
-		lower.x = std::min(lower.x, vertex.x);
-		lower.y = std::min(lower.y, vertex.y);
-		lower.z = std::min(lower.z, vertex.z);
+		float extent = m_halfSize[i] + radius;
+		if (std::fabs(d[i]) < FLT_EPSILON)
+		{
+			if (p[i] < -extent || p[i] > extent)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		float invD = 1.0f / d[i];
+		float t1 = (-extent - p[i]) * invD;
+		float t2 = (extent - p[i]) * invD;
+		float side = -1.0f;
+		if (t1 > t2)
+		{
+			std::swap(t1, t2);
+			side = 1.0f;
+		}
+
+		if (t1 > tMin)
+		{
+			tMin = t1;
+			normal = alglm::vec3(0.0f);
+			normal[i] = side;
+		}
+		tMax = std::min(tMax, t2);
+		if (tMin > tMax)
+		{
+			return false;
+		}
 	}
 
-	// 최적화 여지 있음.
-	// std::sort(vertexVector.begin(), vertexVector.end(), Vec3Comparator());
-
-	// alglm::vec3 upper = *std::prev(vertexVector.end());
-	// alglm::vec3 lower = *vertexVector.begin();
+	// 시작점이 박스 내부인 경우
+	if (tMin < 0.0f)
+	{
+		return false;
+	}
 
-	// std::cout << "upper: " << upper.x << ", " << upper.y << ", " << upper.z << '\n';
-	// std::cout << "lower: " << lower.x << ", " << lower.y << ", " << lower.z << '\n';
+	// 구를 이동시키는 경우 늘린 박스의 모서리, 꼭짓점 영역은 실제로 둥근 형태이므로 모서리 캡슐과 다시 검사
+	if (radius > 0.0f)
+	{
+		alglm::vec3 q = p + d * tMin;
+		int32_t outsideCount = 0;
+		alglm::vec3 corner;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			corner[i] = q[i] > 0.0f ? m_halfSize[i] : -m_halfSize[i];
+			if (std::fabs(q[i]) > m_halfSize[i])
+			{
+				++outsideCount;
+			}
+		}
+
+		if (outsideCount >= 2)
+		{
+			bool isHit = false;
+			float minFraction = input.maxFraction;
+			RayCastOutput edgeOutput;
+			for (int32_t i = 0; i < 3; ++i)
+			{
+				// 모서리 영역이면 박스 안쪽 축 방향의 모서리 하나만, 꼭짓점 영역이면 꼭짓점에 붙은 세 모서리 검사
+				if (outsideCount == 2 && std::fabs(q[i]) > m_halfSize[i])
+				{
+					continue;
+				}
+
+				alglm::vec3 edgeEnd = corner;
+				edgeEnd[i] = -corner[i];
+				if (rayCastCapsule(&edgeOutput, p, d, minFraction, corner, edgeEnd, radius))
+				{
+					isHit = true;
+					minFraction = edgeOutput.fraction;
+					normal = edgeOutput.normal;
+				}
+			}
+
+			if (isHit == false)
+			{
+				return false;
+			}
+			tMin = minFraction;
+		}
+	}
 
-	aabb->upperBound = upper + alglm::vec3(0.1f);
-	aabb->lowerBound = lower - alglm::vec3(0.1f);
+	output->fraction = tMin;
+	output->normal = rotation * normal;
+	return true;
 }
 
 // void BoxShape::setVertices(const std::vector<Vertex> &vertices)
@@ -16,6 +16,11 @@ CapsuleShape *CapsuleShape::clone() const
 	return clone;
 }
 
+int32_t CapsuleShape::getSize() const
+{
+	return sizeof(CapsuleShape);
+}
+
 int32_t CapsuleShape::getChildCount() const
 {
 	return 1;
@@ -23,32 +28,26 @@ int32_t CapsuleShape::getChildCount() const
 
 void CapsuleShape::computeAABB(AABB *aabb, const Transform &xf) const
 {
-	// update vertices
-	std::vector<alglm::vec3> vertexVector(m_vertices.begin(), m_vertices.end());
-	alglm::mat4 rotationMatrix = alglm::toMat4(alglm::normalize(xf.orientation));
-	alglm::mat4 translationMatrix = alglm::translate(alglm::mat4(1.0f), xf.position);
-	alglm::mat4 transformMatrix = translationMatrix * rotationMatrix;
-
-	alglm::vec3 upper(std::numeric_limits<float>::lowest());
-	alglm::vec3 lower(std::numeric_limits<float>::max());
+	// 선분 양 끝점의 AABB를 반지름만큼 확장
+	alglm::mat3 rotation = xf.toRotationMatrix();
+	alglm::vec3 center = rotation * m_center + xf.position;
+	alglm::vec3 halfAxis = rotation[1] * (m_height * 0.5f);
+	alglm::vec3 extents(std::fabs(halfAxis.x) + m_radius, std::fabs(halfAxis.y) + m_radius,
+						std::fabs(halfAxis.z) + m_radius);
+
+	aabb->upperBound = center + extents;
+	aabb->lowerBound = center - extents;
+}
 
-	for (alglm::vec3 &vertex : vertexVector)
-	{
-		alglm::vec4 v = transformMatrix * alglm::vec4(vertex, 1.0f);
-		vertex = alglm::vec3(v.x, v.y, v.z);
-
-		upper.x = std::max(upper.x, vertex.x);
-		upper.y = std::max(upper.y, vertex.y);
-		upper.z = std::max(upper.z, vertex.z);
-		lower.x = std::min(lower.x, vertex.x);
-		lower.y = std::min(lower.y, vertex.y);
-		lower.z = std::min(lower.z, vertex.z);
-	}
+bool CapsuleShape::rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const
+{
+	alglm::mat4 matrix = xf.toMatrix();
+	alglm::vec3 halfAxis = alglm::vec3(0.0f, m_height * 0.5f, 0.0f);
+	alglm::vec3 a = matrix * alglm::vec4(m_center - halfAxis, 1.0f);
+	alglm::vec3 b = matrix * alglm::vec4(m_center + halfAxis, 1.0f);
 
-	// 최적화 여지 있음.
-	// std::sort(vertexVector.begin(), vertexVector.end(), Vec3Comparator());
-	aabb->upperBound = upper + alglm::vec3(0.1f);
-	aabb->lowerBound = lower - alglm::vec3(0.1f);
+	// 구를 이동시키는 경우 반지름을 더한 캡슐과 ray의 교차와 같음
+	return rayCastCapsule(output, input.p1, input.p2 - input.p1, input.maxFraction, a, b, m_radius + input.radius);
 }
 
 void CapsuleShape::createCapsulePoints()
@@ -58,8 +57,10 @@ void CapsuleShape::createCapsulePoints()
 	alglm::vec3 xAxis(1.0f, 0.0f, 0.0f);
 	m_axes[0] = alglm::vec3(0.0f, 1.0f, 0.0f);
 
-	alglm::vec4 topPoint = alglm::vec4(m_center + m_height * 0.5f * m_axes[0] + xAxis * m_radius, 1.0f);
-	alglm::vec4 bottomPoint = alglm::vec4(m_center - m_height * 0.5f * m_axes[0] + xAxis * m_radius, 1.0f);
+	// 회전 축이 원점을 지나므로 반지름 방향 오프셋만 회전시킨 뒤 양 끝 원판의 중심을 더함
+	alglm::vec3 topCenter = m_center + m_height * 0.5f * m_axes[0];
+	alglm::vec3 bottomCenter = m_center - m_height * 0.5f * m_axes[0];
+	alglm::vec4 rimOffset = alglm::vec4(xAxis * m_radius, 0.0f);
 
 	alglm::quat quat = alglm::angleAxis(angleStep / 2.0f, m_axes[0]);
 	alglm::mat4 mat = alglm::toMat4(alglm::normalize(quat));
@@ -71,7 +72,7 @@ void CapsuleShape::createCapsulePoints()
 		float theta = i * angleStep;
 		alglm::quat orientation = alglm::angleAxis(theta, m_axes[0]);
 		alglm::mat4 rotationMatrix = alglm::toMat4(alglm::normalize(orientation));
-		m_points[i] = rotationMatrix * topPoint;
+		m_points[i] = topCenter + alglm::vec3(rotationMatrix * rimOffset);
 		m_axes[i + 1] = rotationMatrix * alglm::vec4(dir, 1.0f);
 	}
 
@@ -81,7 +82,7 @@ void CapsuleShape::createCapsulePoints()
 		float theta = (i - base) * angleStep;
 		alglm::quat orientation = alglm::angleAxis(theta, m_axes[0]);
 		alglm::mat4 rotationMatrix = alglm::toMat4(alglm::normalize(orientation));
-		m_points[i] = rotationMatrix * bottomPoint;
+		m_points[i] = bottomCenter + alglm::vec3(rotationMatrix * rimOffset);
 	}
 }
 
@@ -16,6 +16,11 @@ CylinderShape *CylinderShape::clone() const
 	return clone;
 }
 
+int32_t CylinderShape::getSize() const
+{
+	return sizeof(CylinderShape);
+}
+
 int32_t CylinderShape::getChildCount() const
 {
 	return 1;
@@ -23,31 +28,20 @@ int32_t CylinderShape::getChildCount() const
 
 void CylinderShape::computeAABB(AABB *aabb, const Transform &xf) const
 {
-	// update vertices
-	std::vector<alglm::vec3> vertexVector(m_vertices.begin(), m_vertices.end());
-	alglm::mat4 transformMatrix = xf.toMatrix();
-
-	alglm::vec3 upper(std::numeric_limits<float>::lowest());
-	alglm::vec3 lower(std::numeric_limits<float>::max());
-
-	// 최적화 여지 있음.
-	for (alglm::vec3 &vertex : vertexVector)
-	{
-		alglm::vec4 v = transformMatrix * alglm::vec4(vertex, 1.0f);
-		vertex = alglm::vec3(v.x, v.y, v.z);
-
-		upper.x = std::max(upper.x, vertex.x);
-		upper.y = std::max(upper.y, vertex.y);
-		upper.z = std::max(upper.z, vertex.z);
-		lower.x = std::min(lower.x, vertex.x);
-		lower.y = std::min(lower.y, vertex.y);
-		lower.z = std::min(lower.z, vertex.z);
-	}
-
-	// std::cout << "upper: " << upper.x << ", " << upper.y << ", " << upper.z << '\n';
-	// std::cout << "lower: " << lower.x << ", " << lower.y << ", " << lower.z << '\n';
-	aabb->upperBound = upper + alglm::vec3(0.1f);
-	aabb->lowerBound = lower - alglm::vec3(0.1f);
+	// 축 방향 u에 대해 각 좌표축 반지름은 |u_i| * h / 2 + r * sqrt(1 - u_i^2) (양 끝 원판의 반지름)
+	// u_i가 1에 가까우면 1 - u_i^2에서 자릿수가 사라지므로 |u| = 1을 이용해 나머지 두 성분으로 계산
+	alglm::mat3 rotation = xf.toRotationMatrix();
+	alglm::vec3 center = rotation * m_center + xf.position;
+	alglm::vec3 axis = rotation[1];
+	float halfHeight = m_height * 0.5f;
+	alglm::vec3 diskExtents(m_radius * std::sqrt(axis.y * axis.y + axis.z * axis.z),
+							m_radius * std::sqrt(axis.z * axis.z + axis.x * axis.x),
+							m_radius * std::sqrt(axis.x * axis.x + axis.y * axis.y));
+	alglm::vec3 extents(std::fabs(axis.x) * halfHeight + diskExtents.x, std::fabs(axis.y) * halfHeight + diskExtents.y,
+						std::fabs(axis.z) * halfHeight + diskExtents.z);
+
+	aabb->upperBound = center + extents;
+	aabb->lowerBound = center - extents;
 }
 
 // void CylinderShape::computeCylinderFeatures(const std::vector<Vertex> &vertices)
@@ -81,6 +75,67 @@ void CylinderShape::computeAABB(AABB *aabb, const Transform &xf) const
 // 	m_radius = std::sqrt(m_radius);
 // }
 
+bool CylinderShape::rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const
+{
+	// 실린더 로컬 좌표계 (중심 원점, y축이 중심축)로 변환
+	alglm::mat3 rotation = alglm::mat3(alglm::toMat4(alglm::normalize(xf.orientation)));
+	alglm::mat3 invRotation = alglm::transpose(rotation);
+	alglm::vec3 p = invRotation * (input.p1 - xf.position) - m_center;
+	alglm::vec3 d = invRotation * (input.p2 - input.p1);
+
+	// 구를 이동시키는 경우 반지름과 높이를 구 반지름만큼 늘린 실린더로 근사
+	float radius = m_radius + input.radius;
+	float halfHeight = m_height * 0.5f + input.radius;
+
+	// 시작점이 실린더 내부인 경우
+	if (p.x * p.x + p.z * p.z <= radius * radius && std::fabs(p.y) <= halfHeight)
+	{
+		return false;
+	}
+
+	bool isHit = false;
+	float minFraction = input.maxFraction;
+	alglm::vec3 normal(0.0f);
+
+	// 옆면
+	float a = d.x * d.x + d.z * d.z;
+	float b = p.x * d.x + p.z * d.z;
+	float c = p.x * p.x + p.z * p.z - radius * radius;
+	float discriminant = b * b - a * c;
+	if (a > FLT_EPSILON && discriminant >= 0.0f)
+	{
+		float t = (-b - std::sqrt(discriminant)) / a;
+		float y = p.y + d.y * t;
+		if (t >= 0.0f && t <= minFraction && std::fabs(y) <= halfHeight)
+		{
+			isHit = true;
+			minFraction = t;
+			normal = alglm::normalize(alglm::vec3(p.x + d.x * t, 0.0f, p.z + d.z * t));
+		}
+	}
+
+	// 윗면, 아랫면
+	if (std::fabs(d.y) > FLT_EPSILON)
+	{
+		float side = p.y > 0.0f ? 1.0f : -1.0f;
+		float t = (side * halfHeight - p.y) / d.y;
+		alglm::vec3 q = p + d * t;
+		if (t >= 0.0f && t <= minFraction && q.x * q.x + q.z * q.z <= radius * radius)
+		{
+			isHit = true;
+			minFraction = t;
+			normal = alglm::vec3(0.0f, side, 0.0f);
+		}
+	}
+
+	if (isHit)
+	{
+		output->fraction = minFraction;
+		output->normal = rotation * normal;
+	}
+	return isHit;
+}
+
 void CylinderShape::createCylinderPoints()
 {
 	int32_t segments = 20;
@@ -88,8 +143,10 @@ void CylinderShape::createCylinderPoints()
 	alglm::vec3 xAxis(1.0f, 0.0f, 0.0f);
 	m_axes[0] = alglm::vec3(0.0f, 1.0f, 0.0f);
 
-	alglm::vec4 topPoint = alglm::vec4(m_center + m_height * 0.5f * m_axes[0] + xAxis * m_radius, 1.0f);
-	alglm::vec4 bottomPoint = alglm::vec4(m_center - m_height * 0.5f * m_axes[0] + xAxis * m_radius, 1.0f);
+	// 회전 축이 원점을 지나므로 반지름 방향 오프셋만 회전시킨 뒤 양 끝 원판의 중심을 더함
+	alglm::vec3 topCenter = m_center + m_height * 0.5f * m_axes[0];
+	alglm::vec3 bottomCenter = m_center - m_height * 0.5f * m_axes[0];
+	alglm::vec4 rimOffset = alglm::vec4(xAxis * m_radius, 0.0f);
 
 	alglm::quat quat = alglm::angleAxis(angleStep / 2.0f, m_axes[0]);
 	alglm::mat4 mat = alglm::toMat4(alglm::normalize(quat));
@@ -101,7 +158,7 @@ void CylinderShape::createCylinderPoints()
 		float theta = i * angleStep;
 		alglm::quat orientation = alglm::angleAxis(theta, m_axes[0]);
 		alglm::mat4 rotationMatrix = alglm::toMat4(alglm::normalize(orientation));
-		m_points[i] = rotationMatrix * topPoint;
+		m_points[i] = topCenter + alglm::vec3(rotationMatrix * rimOffset);
 		m_axes[i + 1] = rotationMatrix * alglm::vec4(dir, 1.0f);
 	}
 
@@ -111,7 +168,7 @@ void CylinderShape::createCylinderPoints()
 		float theta = (i - base) * angleStep;
 		alglm::quat orientation = alglm::angleAxis(theta, m_axes[0]);
 		alglm::mat4 rotationMatrix = alglm::toMat4(alglm::normalize(orientation));
-		m_points[i] = rotationMatrix * bottomPoint;
+		m_points[i] = bottomCenter + alglm::vec3(rotationMatrix * rimOffset);
 	}
 }
 
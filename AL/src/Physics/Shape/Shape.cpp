@@ -6,4 +6,94 @@ int32_t operator|(EType type1, EType type2)
 {
 	return static_cast<int32_t>(type1) | static_cast<int32_t>(type2);
 }
+
+bool rayCastSphere(RayCastOutput *output, const alglm::vec3 &p1, const alglm::vec3 &d, float maxFraction,
+				   const alglm::vec3 &center, float radius)
+{
+	// |p1 + t * d - center|^2 = radius^2
+	alglm::vec3 m = p1 - center;
+	float c = alglm::dot(m, m) - radius * radius;
+	if (c <= 0.0f)
+	{
+		return false;
+	}
+
+	float a = alglm::dot(d, d);
+	float b = alglm::dot(m, d);
+	float discriminant = b * b - a * c;
+	if (b >= 0.0f || discriminant < 0.0f || a < FLT_EPSILON)
+	{
+		return false;
+	}
+
+	float t = (-b - std::sqrt(discriminant)) / a;
+	if (t < 0.0f || t > maxFraction)
+	{
+		return false;
+	}
+
+	output->fraction = t;
+	output->normal = alglm::normalize(m + d * t);
+	return true;
+}
+
+bool rayCastCapsule(RayCastOutput *output, const alglm::vec3 &p1, const alglm::vec3 &d, float maxFraction,
+					const alglm::vec3 &a, const alglm::vec3 &b, float radius)
+{
+	alglm::vec3 ab = b - a;
+	alglm::vec3 m = p1 - a;
+	float dd = alglm::dot(ab, ab);
+	float md = alglm::dot(m, ab);
+	float nd = alglm::dot(d, ab);
+
+	// 시작점이 캡슐 내부인 경우
+	float s0 = dd > 0.0f ? alglm::clamp(md / dd, 0.0f, 1.0f) : 0.0f;
+	if (alglm::length2(m - ab * s0) <= radius * radius)
+	{
+		return false;
+	}
+
+	bool isHit = false;
+	float minFraction = maxFraction;
+	alglm::vec3 normal(0.0f);
+
+	// 옆면 (중심선을 축으로 하는 무한 원기둥 중 선분 구간)
+	float A = dd * alglm::dot(d, d) - nd * nd;
+	float B = dd * alglm::dot(m, d) - nd * md;
+	float C = dd * (alglm::dot(m, m) - radius * radius) - md * md;
+	float discriminant = B * B - A * C;
+	if (std::fabs(A) > FLT_EPSILON && discriminant >= 0.0f)
+	{
+		float t = (-B - std::sqrt(discriminant)) / A;
+		float s = (md + t * nd) / dd;
+		if (t >= 0.0f && t <= minFraction && s >= 0.0f && s <= 1.0f)
+		{
+			isHit = true;
+			minFraction = t;
+			normal = alglm::normalize(m + d * t - ab * s);
+		}
+	}
+
+	// 양 끝의 반구
+	RayCastOutput capOutput;
+	if (rayCastSphere(&capOutput, p1, d, minFraction, a, radius))
+	{
+		isHit = true;
+		minFraction = capOutput.fraction;
+		normal = capOutput.normal;
+	}
+	if (rayCastSphere(&capOutput, p1, d, minFraction, b, radius))
+	{
+		isHit = true;
+		minFraction = capOutput.fraction;
+		normal = capOutput.normal;
+	}
+
+	if (isHit)
+	{
+		output->fraction = minFraction;
+		output->normal = normal;
+	}
+	return isHit;
+}
 } // namespace ale
\ No newline at end of file
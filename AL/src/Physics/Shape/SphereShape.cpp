@@ -16,6 +16,11 @@ SphereShape *SphereShape::clone() const
 	return clone;
 }
 
+int32_t SphereShape::getSize() const
+{
+	return sizeof(SphereShape);
+}
+
 int32_t SphereShape::getChildCount() const
 {
 	return 1;
@@ -23,12 +28,10 @@ int32_t SphereShape::getChildCount() const
 
 void SphereShape::computeAABB(AABB *aabb, const Transform &xf) const
 {
-	// get min, max vertex
-	alglm::vec3 upper = xf.position + alglm::vec3(m_radius);
-	alglm::vec3 lower = xf.position - alglm::vec3(m_radius);
+	alglm::vec3 center = xf.toRotationMatrix() * m_center + xf.position;
 
-	aabb->upperBound = upper + alglm::vec3(0.1f);
-	aabb->lowerBound = lower - alglm::vec3(0.1f);
+	aabb->upperBound = center + alglm::vec3(m_radius);
+	aabb->lowerBound = center - alglm::vec3(m_radius);
 }
 
 // void SphereShape::setShapeFeatures(std::vector<Vertex> &vertices)
@@ -47,6 +50,14 @@ void SphereShape::computeAABB(AABB *aabb, const Transform &xf) const
 // 	m_radius = std::sqrt(distance);
 // }
 
+bool SphereShape::rayCast(RayCastOutput *output, const RayCastInput &input, const Transform &xf) const
+{
+	alglm::vec3 center = xf.toMatrix() * alglm::vec4(m_center, 1.0f);
+
+	// 구를 이동시키는 경우 반지름을 더한 구와 ray의 교차와 같음
+	return rayCastSphere(output, input.p1, input.p2 - input.p1, input.maxFraction, center, m_radius + input.radius);
+}
+
 void SphereShape::setShapeFeatures(const alglm::vec3 &center, float radius)
 {
 	m_center = center;
@@ -5,10 +5,197 @@
 
 namespace ale
 {
-World::World() : m_rigidbodies(nullptr), m_rigidbodyCount(0) {};
+// Fixture 캐시를 거치지 않고 만든 ConvexInfo의 메모리를 해제
+static inline void _freeConvexInfo(ConvexInfo &convex)
+{
+	if (convex.points != nullptr)
+	{
+		PhysicsAllocator::m_blockAllocator.freeBlock(convex.points, sizeof(alglm::vec3) * convex.pointsCount);
+	}
+	if (convex.axes != nullptr)
+	{
+		PhysicsAllocator::m_blockAllocator.freeBlock(convex.axes, sizeof(alglm::vec3) * convex.axesCount);
+	}
+}
+
+static inline Transform _interpolateTransform(const Transform &xf0, const Transform &xf1, float t)
+{
+	Transform xf;
+	xf.position = alglm::mix(xf0.position, xf1.position, t);
+	xf.orientation = alglm::normalize(alglm::slerp(xf0.orientation, xf1.orientation, t));
+	return xf;
+}
+
+namespace
+{
+// 범위를 벗어날 때 경과 시간(ms)을 target에 더하는 타이머
+class PhaseTimer
+{
+  public:
+	explicit PhaseTimer(float &target) : m_target(target), m_start(std::chrono::steady_clock::now())
+	{
+	}
+
+	~PhaseTimer()
+	{
+		m_target += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+	}
+
+  private:
+	float &m_target;
+	std::chrono::steady_clock::time_point m_start;
+};
+} // namespace
+
+const float World::DEFAULT_FIXED_TIMESTEP_HZ = 60.0f;
+const int32_t World::DEFAULT_MAX_SUB_STEPS = 4;
+const float World::DEFAULT_AABB_MARGIN = 0.2f;
+const float World::DEFAULT_AABB_PREDICTION_FACTOR = 2.0f;
+const int32_t World::TOI_ITERATION = 20;
+const float World::TOI_TARGET_DISTANCE = 0.01f;
+const float World::TOI_TOLERANCE = 0.0025f;
+const int32_t World::RAY_CAST_BATCH_SIZE = 64;
+const uint32_t World::STATE_MAGIC = 0x53574C41; // "ALWS"
+const uint32_t World::STATE_VERSION = 1;
+
+namespace
+{
+// 가장 가까운 충돌 Fixture를 찾는 ray cast 콜백
+struct ClosestRayCastCallback
+{
+	float rayCastCallback(const RayCastInput &input, int32_t proxyId)
+	{
+		FixtureProxy *proxy = static_cast<FixtureProxy *>(broadPhase->getUserData(proxyId));
+		Fixture *candidate = proxy->fixture;
+		if (candidate->isSeonsor())
+		{
+			return -1.0f;
+		}
+
+		RayCastOutput candidateOutput;
+		if (candidate->rayCast(&candidateOutput, input) == false)
+		{
+			return -1.0f;
+		}
+
+		// 이후 탐색은 이번 충돌 지점보다 가까운 범위로 제한
+		fixture = candidate;
+		output = candidateOutput;
+		return candidateOutput.fraction;
+	}
+
+	const BroadPhase *broadPhase;
+	Fixture *fixture;
+	RayCastOutput output;
+};
+
+// 스냅샷 맨 앞에 기록하는 World 정보
+struct WorldStateHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	int32_t bodyCount;
+	int32_t contactCount;
+	int32_t moveCount;
+	float accumulator;
+	float interpolationAlpha;
+};
+
+// 스냅샷에 기록하는 Contact 정보 (뒤에 pointsCount개의 ManifoldPoint가 이어짐)
+struct ContactState
+{
+	int32_t proxyIdA;
+	int32_t proxyIdB;
+	int32_t flags;
+	int32_t pointsCount;
+	bool wasTouched;
+};
+
+// 스냅샷 버퍼 끝에 값 배열을 이어 붙임
+template <typename T> void writeState(std::vector<uint8_t> &buffer, const T *values, int32_t count)
+{
+	size_t offset = buffer.size();
+	size_t size = sizeof(T) * count;
+	buffer.resize(offset + size);
+	if (size > 0)
+	{
+		std::memcpy(buffer.data() + offset, values, size);
+	}
+}
+
+// 스냅샷 버퍼를 앞에서부터 읽는 reader
+struct StateReader
+{
+	template <typename T> void read(T *values, int32_t count)
+	{
+		size_t size = sizeof(T) * count;
+		if (count < 0 || offset + size > dataSize)
+		{
+			AL_CORE_ERROR("World state size: {0}", dataSize);
+			throw std::runtime_error("invalid world state");
+		}
+		if (size > 0)
+		{
+			std::memcpy(values, data + offset, size);
+		}
+		offset += size;
+	}
+
+	const uint8_t *data;
+	size_t dataSize;
+	size_t offset;
+};
+
+// AABB와 겹치는 Fixture의 Body를 모으는 query 콜백
+struct OverlapQueryCallback
+{
+	bool queryCallback(int32_t proxyId)
+	{
+		FixtureProxy *proxy = static_cast<FixtureProxy *>(broadPhase->getUserData(proxyId));
+		if (proxy->fixture->isSeonsor() == false && testOverlap(proxy->aabb, aabb))
+		{
+			bodies->push_back(proxy->fixture->getBody());
+		}
+		return true;
+	}
+
+	const BroadPhase *broadPhase;
+	AABB aabb;
+	std::vector<Rigidbody *> *bodies;
+};
+} // namespace
+
+World::World() : World(0) {};
+
+World::World(int32_t workerCount)
+	: m_rigidbodies(nullptr), m_rigidbodyCount(0), m_freeBodySlot(-1), m_stackAllocator(MemoryTag::Physics),
+	  m_isFixedTimestep(true), m_fixedTimestep(1.0f / DEFAULT_FIXED_TIMESTEP_HZ), m_maxSubSteps(DEFAULT_MAX_SUB_STEPS),
+	  m_accumulator(0.0f), m_aabbMargin(DEFAULT_AABB_MARGIN), m_aabbPredictionFactor(DEFAULT_AABB_PREDICTION_FACTOR),
+	  m_interpolationAlpha(1.0f), m_isDeterministic(false), m_stats()
+{
+	m_jobSystem = std::make_unique<JobSystem>(workerCount);
+
+	// 워커마다 독립된 스택 할당자 사용
+	int32_t count = m_jobSystem->getWorkerCount();
+	m_workerStackAllocators.reserve(count);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		m_workerStackAllocators.push_back(std::make_unique<StackAllocator>(MemoryTag::Physics));
+	}
+}
 
 World::~World()
 {
+	Contact *contact = m_contactManager.m_contactList;
+
+	while (contact != nullptr)
+	{
+		Contact *nextContact = contact->getNext();
+		Contact::destroy(contact);
+
+		contact = nextContact;
+	}
+
 	Rigidbody *body = m_rigidbodies;
 
 	while (body != nullptr)
@@ -23,37 +210,114 @@ World::~World()
 
 void World::startFrame()
 {
-	Rigidbody *body = m_rigidbodies;
-	while (body != nullptr)
+	m_bodyData.clearAccumulators();
+	m_bodyData.calculateDerivedData();
+}
+
+int32_t World::step(float frameTime)
+{
+	if (m_isFixedTimestep == false)
 	{
-		body->clearAccumulators();
-		body->calculateDerivedData();
-		body = body->next;
+		for (Rigidbody *body = m_rigidbodies; body; body = body->next)
+		{
+			body->storePreviousTransform();
+		}
+		startFrame();
+		runPhysics(frameTime);
+		m_interpolationAlpha = 1.0f;
+		return 1;
+	}
+
+	m_accumulator += frameTime;
+
+	int32_t stepCount = 0;
+	while (m_accumulator >= m_fixedTimestep && stepCount < m_maxSubSteps)
+	{
+		// 보간은 마지막 두 step 사이에서만 하므로 매 step 직전 Transform 저장
+		for (Rigidbody *body = m_rigidbodies; body; body = body->next)
+		{
+			body->storePreviousTransform();
+		}
+		startFrame();
+		runPhysics(m_fixedTimestep);
+
+		m_accumulator -= m_fixedTimestep;
+		++stepCount;
+	}
+
+	// 최대 step 횟수를 넘어 밀린 시간은 버려서 다음 프레임에 step이 몰리지 않도록 함
+	if (m_accumulator >= m_fixedTimestep)
+	{
+		m_accumulator = std::fmod(m_accumulator, m_fixedTimestep);
 	}
+
+	m_interpolationAlpha = m_accumulator / m_fixedTimestep;
+	return stepCount;
 }
 
 void World::runPhysics(float duration)
 {
-	Rigidbody *body = m_rigidbodies;
-	while (body != nullptr)
+	AL_PROFILE_FUNCTION();
+
+	m_stats = PhysicsStats();
+	PhaseTimer stepTimer(m_stats.stepTime);
+	m_stats.bodyCount = m_rigidbodyCount;
+	m_contactManager.m_broadPhase.resetReinsertCount();
+
 	{
-		if (body->isAwake())
+		AL_PROFILE_SCOPE("World::integrate");
+		PhaseTimer timer(m_stats.integrateTime);
+
+		// 등록된 외력을 누적한 뒤 상태 배열을 한 번에 적분
+		int32_t bodyCount = static_cast<int32_t>(m_bodyArray.size());
+		for (int32_t i = 0; i < bodyCount; ++i)
+		{
+			if (m_bodyData.awakeFlags[i] != 0)
+			{
+				m_bodyArray[i]->calculateForceAccum();
+				++m_stats.awakeBodyCount;
+			}
+		}
+
+		m_bodyData.integrate(duration);
+
+		for (int32_t i = 0; i < bodyCount; ++i)
 		{
-			body->calculateForceAccum();
-			body->integrate(duration);
-			body->synchronizeFixtures();
+			if (m_bodyData.awakeFlags[i] != 0)
+			{
+				m_bodyArray[i]->synchronizeFixtures();
+			}
 		}
-		body = body->next;
 	}
-	m_contactManager.findNewContacts();
-	m_contactManager.collide();
+
+	{
+		AL_PROFILE_SCOPE("World::broadPhase");
+		PhaseTimer timer(m_stats.broadPhaseTime);
+		m_contactManager.findNewContacts(m_stats);
+	}
+
+	{
+		AL_PROFILE_SCOPE("World::narrowPhase");
+		PhaseTimer timer(m_stats.narrowPhaseTime);
+		m_contactManager.collide(m_stats);
+	}
+
 	solve(duration);
+
+	{
+		AL_PROFILE_SCOPE("World::solveTOI");
+		PhaseTimer timer(m_stats.toiTime);
+		solveTOI();
+	}
+
+	m_stats.reinsertCount = m_contactManager.m_broadPhase.getReinsertCount();
 }
 
 void World::solve(float duration)
 {
-	// island 초기화
-	Island island(m_rigidbodyCount, m_contactManager.m_contactCount);
+	AL_PROFILE_FUNCTION();
+
+	std::chrono::steady_clock::time_point islandStart = std::chrono::steady_clock::now();
 
 	// 모든 body들의 플래그에 islandFlag 제거
 	for (Rigidbody *body = m_rigidbodies; body; body = body->next)
@@ -67,9 +331,23 @@ void World::solve(float duration)
 		contact->unsetFlag(EContactFlag::ISLAND);
 	}
 
-	// Body를 순회하며 island를 생성후 solve 처리
-	Rigidbody **stack = static_cast<Rigidbody **>(PhysicsAllocator::m_stackAllocator.allocateStack(m_rigidbodyCount));
+	int32_t contactCount = m_contactManager.m_contactCount;
+
+	// DFS용 스택과 island들이 나눠 쓰는 body, contact 배열 할당
+	// staticBody는 여러 island에 중복으로 속할 수 있으므로 body 배열은 contact 개수만큼 여유를 둔다
+	Rigidbody **stack =
+		static_cast<Rigidbody **>(m_stackAllocator.allocateStack(sizeof(Rigidbody *) * m_rigidbodyCount));
+	Rigidbody **islandBodies = static_cast<Rigidbody **>(
+		m_stackAllocator.allocateStack(sizeof(Rigidbody *) * (m_rigidbodyCount + contactCount)));
+	Contact **islandContacts =
+		static_cast<Contact **>(m_stackAllocator.allocateStack(sizeof(Contact *) * contactCount));
 	int32_t stackPtr = 0;
+	int32_t bodyOffset = 0;
+	int32_t contactOffset = 0;
+
+	// 워커가 island 포인터를 들고 있으므로 solve 도중 재할당되지 않도록 최대 개수만큼 예약
+	m_islands.clear();
+	m_islands.reserve(m_rigidbodyCount);
 
 	// body 순회
 	for (Rigidbody *body = m_rigidbodies; body; body = body->next)
@@ -86,9 +364,16 @@ void World::solve(float duration)
 			continue;
 		}
 
+		// 잠든 island는 깨어 있는 body와 접촉해 깨어나기 전까지 solve하지 않음
+		if (body->isAwake() == false)
+		{
+			continue;
+		}
+
 		// 현재 Body가 island 생성 가능하다 판단이 끝났으니
-		// island clear를 통해 새로운 island 생성
-		island.clear();
+		// 남은 배열 구간을 사용하는 새로운 island 생성
+		m_islands.emplace_back(islandBodies + bodyOffset, islandContacts + contactOffset);
+		Island &island = m_islands.back();
 		stack[stackPtr] = body;
 		++stackPtr;
 		body->setFlag(EBodyFlag::ISLAND); // body island 처리
@@ -123,6 +408,12 @@ void World::solve(float duration)
 					continue;
 				}
 
+				// sensor는 충돌 응답이 없으므로 solver에서 제외
+				if (contact->getFixtureA()->isSeonsor() || contact->getFixtureB()->isSeonsor())
+				{
+					continue;
+				}
+
 				// 위 조건을 다 충족하는 경우 island에 추가 후 island 플래그 on
 				island.add(contact);
 				contact->setFlag(EContactFlag::ISLAND);
@@ -136,36 +427,341 @@ void World::solve(float duration)
 				}
 
 				// 충돌 상대 body가 island에 속한게 아니었으면 stack에 추가 후 island 플래그 on
+				// 깨어 있는 body와 접촉한 잠든 body는 contact를 따라 island 전체가 깨어남
 				stack[stackPtr] = other;
 				stackPtr++;
 				other->setFlag(EBodyFlag::ISLAND);
+				if (other->isAwake() == false)
+				{
+					other->setAwake();
+				}
 			}
 		}
 
-		// 생성한 island 충돌 처리
-		island.solve(duration);
+		// staticBody의 islandIndex는 다음 island 생성 시 덮어써지므로 contact에 미리 기록
+		island.bindContactIndices();
+		bodyOffset += island.m_bodyCount;
+		contactOffset += island.m_contactCount;
 
 		// island의 staticBody들의 island 플래그 off
-		Rigidbody **islandBodies = island.m_bodies;
+		Rigidbody **bodies = island.m_bodies;
 		for (int32_t i = 0; i < island.m_bodyCount; ++i)
 		{
 
-			if (islandBodies[i]->getType() == EBodyType::STATIC_BODY)
+			if (bodies[i]->getType() == EBodyType::STATIC_BODY)
 			{
-				islandBodies[i]->unsetFlag(EBodyFlag::ISLAND);
+				bodies[i]->unsetFlag(EBodyFlag::ISLAND);
 			}
 		}
+
+		// 결정론적 모드에서는 island를 생성 순서대로 메인 스레드에서 solve
+		if (m_isDeterministic)
+		{
+			PhaseTimer timer(m_stats.solveTime);
+			island.solve(duration, *m_workerStackAllocators.back());
+			continue;
+		}
+
+		// 생성한 island 충돌 처리를 워커에 맡기고 다음 island 생성 진행
+		Island *target = &island;
+		m_jobSystem->submit([this, target, duration](int32_t workerIndex) {
+			target->solve(duration, *m_workerStackAllocators[workerIndex]);
+		});
+	}
+
+	// 메인 스레드에서 solve한 시간은 island 생성 시간에서 제외
+	m_stats.islandTime =
+		std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - islandStart).count() -
+		m_stats.solveTime;
+
+	{
+		AL_PROFILE_SCOPE("World::solveIslands");
+		PhaseTimer timer(m_stats.solveTime);
+
+		// 모든 island solve가 끝날 때까지 대기 (메인 스레드도 남은 island 처리에 참여)
+		m_jobSystem->wait();
+
+		// BroadPhase 갱신은 스레드 안전하지 않으므로 메인 스레드에서 순서대로 처리
+		for (Island &island : m_islands)
+		{
+			island.synchronizeFixtures();
+		}
+	}
+
+	// island 크기 통계
+	m_stats.islandCount = static_cast<int32_t>(m_islands.size());
+	for (const Island &island : m_islands)
+	{
+		int32_t bucket = 0;
+		while (bucket < ISLAND_HISTOGRAM_SIZE - 1 && (island.m_bodyCount >> (bucket + 1)) > 0)
+		{
+			++bucket;
+		}
+		++m_stats.islandSizeHistogram[bucket];
+		m_stats.largestIslandSize = std::max(m_stats.largestIslandSize, island.m_bodyCount);
 	}
 
-	island.destroy();
+	m_stackAllocator.freeStack();
+	m_stackAllocator.freeStack();
+	m_stackAllocator.freeStack();
+}
+
+void World::solveTOI()
+{
+	for (Rigidbody *body = m_rigidbodies; body; body = body->next)
+	{
+		if (body->isBullet() == false || body->getType() != EBodyType::DYNAMIC_BODY || body->isAwake() == false)
+		{
+			continue;
+		}
+
+		// 모든 contact 중 가장 먼저 닿는 시간 찾기
+		float minToi = 1.0f;
+		alglm::vec3 hitNormal(0.0f);
+		Contact *hitContact = nullptr;
+		Rigidbody *hitBody = nullptr;
+		for (ContactLink *link = body->getContactLinks(); link; link = link->next)
+		{
+			Contact *contact = link->contact;
+
+			// sensor는 충돌 응답이 없으므로 제외
+			if (contact->getFixtureA()->isSeonsor() || contact->getFixtureB()->isSeonsor())
+			{
+				continue;
+			}
+
+			float toi;
+			alglm::vec3 normal;
+			if (computeTOI(body, contact, toi, normal) && toi < minToi)
+			{
+				minToi = toi;
+				hitNormal = normal;
+				hitContact = contact;
+				hitBody = link->other;
+			}
+		}
 
-	PhysicsAllocator::m_stackAllocator.freeStack();
+		if (hitContact == nullptr)
+		{
+			continue;
+		}
+
+		// TOI 위치로 되돌리기 (남은 이동은 다음 step에서 반발 속도로 진행)
+		Transform toiXf = _interpolateTransform(body->getPreviousTransform(), body->getTransform(), minToi);
+		body->setPosition(toiXf.position);
+		body->setOrientation(toiXf.orientation);
+
+		// 법선 방향으로 접근 중이면 반발 충격량 적용
+		bool isOtherDynamic = hitBody->getType() == EBodyType::DYNAMIC_BODY;
+		float invMassA = body->getInverseMass();
+		float invMassB = isOtherDynamic ? hitBody->getInverseMass() : 0.0f;
+		float invMassSum = invMassA + invMassB;
+		alglm::vec3 relativeVelocity = body->getLinearVelocity();
+		if (isOtherDynamic)
+		{
+			relativeVelocity -= hitBody->getLinearVelocity();
+		}
+
+		float approachSpeed = alglm::dot(relativeVelocity, hitNormal);
+		if (approachSpeed > 0.0f && invMassSum > 0.0f)
+		{
+			float impulse = (1.0f + hitContact->getRestitution()) * approachSpeed / invMassSum;
+
+			alglm::vec3 velocityA = body->getLinearVelocity() - hitNormal * (impulse * invMassA);
+			body->setLinearVelocity(velocityA);
+
+			if (isOtherDynamic)
+			{
+				alglm::vec3 velocityB = hitBody->getLinearVelocity() + hitNormal * (impulse * invMassB);
+				hitBody->setLinearVelocity(velocityB);
+				hitBody->setAwake();
+			}
+		}
+
+		body->calculateDerivedData();
+		body->updateSweep();
+		body->synchronizeFixtures();
+	}
+}
+
+bool World::computeTOI(Rigidbody *bullet, Contact *contact, float &toi, alglm::vec3 &normal)
+{
+	Fixture *fixtureA = contact->getFixtureA();
+	Fixture *fixtureB = contact->getFixtureB();
+	bool isBulletA = fixtureA->getBody() == bullet;
+	Fixture *bulletFixture = isBulletA ? fixtureA : fixtureB;
+	Rigidbody *other = isBulletA ? fixtureB->getBody() : fixtureA->getBody();
+
+	const Transform &xf0 = bullet->getPreviousTransform();
+	const Transform &xf1 = bullet->getTransform();
+	const Transform &otherXf = other->getTransform();
+
+	// step 동안의 이동량과 회전각
+	alglm::vec3 translation = xf1.position - xf0.position;
+	const alglm::quat &q0 = xf0.orientation;
+	const alglm::quat &q1 = xf1.orientation;
+	float cosHalfAngle = std::fabs(q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w);
+	float angle = 2.0f * std::acos(std::min(cosHalfAngle, 1.0f));
+
+	// 회전 중심에서 shape의 가장 먼 점까지의 거리 상한
+	AABB aabb;
+	bulletFixture->getShape()->computeAABB(&aabb, xf1);
+	alglm::vec3 upper = aabb.upperBound - xf1.position;
+	alglm::vec3 lower = xf1.position - aabb.lowerBound;
+	alglm::vec3 farthest(std::max(upper.x, lower.x), std::max(upper.y, lower.y), std::max(upper.z, lower.z));
+	float maxRadius = alglm::length(farthest);
+
+	float t = 0.0f;
+	for (int32_t iter = 0; iter < TOI_ITERATION; ++iter)
+	{
+		// 보간한 자세는 다음 step에 다시 쓰이지 않으므로 bullet의 ConvexInfo는 Fixture 캐시를 거치지 않고 만듦
+		Transform xf = _interpolateTransform(xf0, xf1, t);
+		ConvexInfo bulletConvex = bulletFixture->getShape()->getShapeInfo(xf);
+		const ConvexInfo &otherConvex = (isBulletA ? fixtureB : fixtureA)->getConvexInfo(otherXf);
+
+		alglm::vec3 separatingNormal;
+		float distance = isBulletA ? contact->getGjkDistance(bulletConvex, otherConvex, separatingNormal)
+								   : contact->getGjkDistance(otherConvex, bulletConvex, separatingNormal);
+		_freeConvexInfo(bulletConvex);
+		alglm::vec3 bulletNormal = isBulletA ? separatingNormal : -separatingNormal;
+
+		if (distance < TOI_TARGET_DISTANCE + TOI_TOLERANCE)
+		{
+			// 시작부터 닿아 있던 contact는 island solver가 처리
+			if (iter == 0)
+			{
+				return false;
+			}
+
+			toi = t;
+			normal = bulletNormal;
+			return true;
+		}
+
+		// 남은 거리를 이동 속도 상한으로 나누어 안전하게 전진
+		float approachBound = alglm::dot(translation, bulletNormal) + angle * maxRadius;
+		if (approachBound <= 0.0f)
+		{
+			return false;
+		}
+
+		t += (distance - TOI_TARGET_DISTANCE) / approachBound;
+		if (t >= 1.0f)
+		{
+			return false;
+		}
+	}
+
+	return false;
+}
+
+bool World::castClosest(const alglm::vec3 &origin, const alglm::vec3 &direction, float maxDistance, float radius,
+						RayCastHit &hit) const
+{
+	hit.body = nullptr;
+	hit.fixture = nullptr;
+
+	float length = alglm::length(direction);
+	if (length < FLT_EPSILON || maxDistance <= 0.0f)
+	{
+		return false;
+	}
+
+	RayCastInput input;
+	input.p1 = origin;
+	input.p2 = origin + direction * (maxDistance / length);
+	input.maxFraction = 1.0f;
+	input.radius = radius;
+
+	ClosestRayCastCallback callback;
+	callback.broadPhase = &m_contactManager.m_broadPhase;
+	callback.fixture = nullptr;
+	m_contactManager.m_broadPhase.rayCast(&callback, input);
+
+	if (callback.fixture == nullptr)
+	{
+		return false;
+	}
+
+	hit.fixture = callback.fixture;
+	hit.body = callback.fixture->getBody();
+	hit.normal = callback.output.normal;
+	hit.distance = callback.output.fraction * maxDistance;
+	hit.point = input.p1 + (input.p2 - input.p1) * callback.output.fraction - hit.normal * radius;
+	return true;
+}
+
+bool World::rayCast(const alglm::vec3 &origin, const alglm::vec3 &direction, float maxDistance, RayCastHit &hit)
+{
+	m_contactManager.m_broadPhase.updateQueryTree(1);
+	return castClosest(origin, direction, maxDistance, 0.0f, hit);
+}
+
+bool World::sphereCast(const alglm::vec3 &origin, float radius, const alglm::vec3 &direction, float maxDistance,
+					   RayCastHit &hit)
+{
+	m_contactManager.m_broadPhase.updateQueryTree(1);
+	return castClosest(origin, direction, maxDistance, std::max(radius, 0.0f), hit);
+}
+
+int32_t World::overlapAABB(const AABB &aabb, std::vector<Rigidbody *> &bodies)
+{
+	m_contactManager.m_broadPhase.updateQueryTree(1);
+
+	bodies.clear();
+	OverlapQueryCallback callback;
+	callback.broadPhase = &m_contactManager.m_broadPhase;
+	callback.aabb = aabb;
+	callback.bodies = &bodies;
+	m_contactManager.m_broadPhase.query(&callback, aabb);
+
+	// Fixture가 여러 개인 Body 중복 제거
+	// 주소 대신 Body ID로 정렬하여 실행마다 같은 순서로 반환
+	std::sort(bodies.begin(), bodies.end(),
+			  [](const Rigidbody *a, const Rigidbody *b) { return a->getBodyId() < b->getBodyId(); });
+	bodies.erase(std::unique(bodies.begin(), bodies.end()), bodies.end());
+	return static_cast<int32_t>(bodies.size());
+}
+
+int32_t World::rayCastBatch(const Ray *rays, int32_t count, RayCastHit *hits)
+{
+	// 워커들이 읽기만 하도록 쿼리 트리를 미리 갱신
+	m_contactManager.m_broadPhase.updateQueryTree(count);
+
+	std::atomic<int32_t> hitCount(0);
+	auto castRange = [this, rays, hits, &hitCount](int32_t begin, int32_t end) {
+		int32_t localCount = 0;
+		for (int32_t i = begin; i < end; ++i)
+		{
+			if (castClosest(rays[i].origin, rays[i].direction, rays[i].maxDistance, 0.0f, hits[i]))
+			{
+				++localCount;
+			}
+		}
+		hitCount += localCount;
+	};
+
+	if (count <= RAY_CAST_BATCH_SIZE)
+	{
+		castRange(0, count);
+		return hitCount;
+	}
+
+	for (int32_t begin = 0; begin < count; begin += RAY_CAST_BATCH_SIZE)
+	{
+		int32_t end = std::min(begin + RAY_CAST_BATCH_SIZE, count);
+		m_jobSystem->submit([&castRange, begin, end](int32_t workerIndex) { castRange(begin, end); });
+	}
+	m_jobSystem->wait();
+
+	return hitCount;
 }
 
 Rigidbody *World::createBody(BodyDef &bdDef)
 {
+	int32_t dataIndex = m_bodyData.push();
 	void *bodyMemory = PhysicsAllocator::m_blockAllocator.allocateBlock(sizeof(Rigidbody));
-	Rigidbody *body = new (static_cast<Rigidbody *>(bodyMemory)) Rigidbody(&bdDef, this);
+	Rigidbody *body = new (static_cast<Rigidbody *>(bodyMemory)) Rigidbody(&bdDef, this, &m_bodyData, dataIndex);
 
 	if (m_rigidbodyCount != 0)
 	{
@@ -177,18 +773,374 @@ Rigidbody *World::createBody(BodyDef &bdDef)
 	m_rigidbodies = body;
 	++m_rigidbodyCount;
 
+	// 빈 슬롯을 재사용하여 핸들 발급
+	int32_t slotIndex = m_freeBodySlot;
+	if (slotIndex != -1)
+	{
+		m_freeBodySlot = m_bodySlots[slotIndex].nextFree;
+	}
+	else
+	{
+		slotIndex = static_cast<int32_t>(m_bodySlots.size());
+		m_bodySlots.push_back({-1, 0, -1});
+	}
+
+	BodySlot &slot = m_bodySlots[slotIndex];
+	slot.denseIndex = static_cast<int32_t>(m_bodyArray.size());
+	slot.nextFree = -1;
+	m_bodyArray.push_back(body);
+
+	BodyHandle handle;
+	handle.index = slotIndex;
+	handle.generation = slot.generation;
+	body->setHandle(handle);
+
 	return body;
 }
 
-void World::registerBodyForce(int32_t idx, const alglm::vec3 &force)
+void World::destroyBody(Rigidbody *body)
 {
-	// check idx
-	Rigidbody *body = m_rigidbodies;
-	for (int32_t i = m_rigidbodyCount - 1; i > idx; --i)
+	// body의 contact 제거
+	ContactLink *link = body->getContactLinks();
+	while (link != nullptr)
+	{
+		ContactLink *nextLink = link->next;
+		m_contactManager.destroy(link->contact);
+		link = nextLink;
+	}
+	body->setContactLinks(nullptr);
+
+	// BroadPhase에서 proxy 제거
+	body->destroyFixtureProxies();
+
+	// world bodyList에서 제거
+	if (body->prev != nullptr)
+	{
+		body->prev->next = body->next;
+	}
+	if (body->next != nullptr)
 	{
-		body = body->next;
+		body->next->prev = body->prev;
+	}
+	if (body == m_rigidbodies)
+	{
+		m_rigidbodies = body->next;
+	}
+	--m_rigidbodyCount;
+
+	// dense 배열의 빈 자리를 마지막 body로 채우고 슬롯 반환
+	BodyHandle handle = body->getHandle();
+	BodySlot &slot = m_bodySlots[handle.index];
+	Rigidbody *last = m_bodyArray.back();
+	m_bodyArray[slot.denseIndex] = last;
+	m_bodySlots[last->getHandle().index].denseIndex = slot.denseIndex;
+	m_bodyArray.pop_back();
+	m_bodyData.remove(slot.denseIndex);
+	last->setDataIndex(slot.denseIndex);
+
+	slot.denseIndex = -1;
+	++slot.generation;
+	slot.nextFree = m_freeBodySlot;
+	m_freeBodySlot = handle.index;
+
+	body->~Rigidbody();
+	PhysicsAllocator::m_blockAllocator.freeBlock(body, sizeof(Rigidbody));
+}
+
+int32_t World::getWorkerCount() const
+{
+	return m_jobSystem->getWorkerCount();
+}
+
+const PhysicsStats &World::getStats() const
+{
+	return m_stats;
+}
+
+StackAllocatorStats World::getStackAllocatorStats() const
+{
+	StackAllocatorStats stats = m_stackAllocator.getStats();
+	for (const std::unique_ptr<StackAllocator> &allocator : m_workerStackAllocators)
+	{
+		const StackAllocatorStats &workerStats = allocator->getStats();
+		stats.capacity += workerStats.capacity;
+		stats.highWater = std::max(stats.highWater, workerStats.highWater);
+		stats.overflowCount += workerStats.overflowCount;
+	}
+	return stats;
+}
+
+void World::setDeterministic(bool enabled)
+{
+	m_isDeterministic = enabled;
+}
+
+bool World::isDeterministic() const
+{
+	return m_isDeterministic;
+}
+
+void World::setBroadPhaseOptimization(int32_t rotationBudget, float rebuildAreaRatio)
+{
+	m_contactManager.m_broadPhase.setTreeOptimization(rotationBudget, rebuildAreaRatio);
+}
+
+TreeQuality World::getBroadPhaseQuality() const
+{
+	return m_contactManager.m_broadPhase.getTreeQuality();
+}
+
+void World::rebuildBroadPhase()
+{
+	m_contactManager.m_broadPhase.rebuildTree();
+}
+
+void World::saveState(std::vector<uint8_t> &buffer)
+{
+	buffer.clear();
+
+	BroadPhase &broadPhase = m_contactManager.m_broadPhase;
+
+	WorldStateHeader header;
+	header.magic = STATE_MAGIC;
+	header.version = STATE_VERSION;
+	header.bodyCount = m_rigidbodyCount;
+	header.contactCount = m_contactManager.m_contactCount;
+	header.moveCount = broadPhase.getMoveCount();
+	header.accumulator = m_accumulator;
+	header.interpolationAlpha = m_interpolationAlpha;
+	writeState(buffer, &header, 1);
+
+	// body와 fixture proxy 상태
+	for (Rigidbody *body = m_rigidbodies; body; body = body->next)
+	{
+		BodyState state;
+		body->getState(state);
+		writeState(buffer, &state, 1);
+		writeState(buffer, body->getRegisteredForces().data(), state.forceCount);
+
+		Fixture *fixtures = body->getFixtures();
+		for (int32_t i = 0; i < body->getFixtureCount(); ++i)
+		{
+			int32_t touchNum = fixtures[i].getTouchNum();
+			writeState(buffer, &touchNum, 1);
+
+			const FixtureProxy *proxies = fixtures[i].getFixtureProxy();
+			for (int32_t j = 0; j < fixtures[i].getProxyCount(); ++j)
+			{
+				writeState(buffer, &proxies[j].aabb, 1);
+				writeState(buffer, &broadPhase.getFatAABB(proxies[j].proxyId), 1);
+			}
+		}
+	}
+
+	// 다음 step에 새 pair를 찾을 proxy 목록
+	writeState(buffer, broadPhase.getMoveBuffer(), header.moveCount);
+
+	// contact는 리스트 앞에 추가되므로 복원할 때 같은 순서가 되도록 리스트 끝부터 기록
+	Contact *tail = m_contactManager.m_contactList;
+	while (tail != nullptr && tail->getNext() != nullptr)
+	{
+		tail = tail->getNext();
+	}
+
+	for (Contact *contact = tail; contact; contact = contact->getPrev())
+	{
+		Manifold &manifold = contact->getManifold();
+
+		// bool 뒤의 패딩이 그대로 복사되지 않도록 0으로 채움
+		ContactState state;
+		std::memset(&state, 0, sizeof(ContactState));
+		state.proxyIdA = contact->getFixtureA()->getFixtureProxy()[contact->getChildIndexA()].proxyId;
+		state.proxyIdB = contact->getFixtureB()->getFixtureProxy()[contact->getChildIndexB()].proxyId;
+		state.flags = contact->getFlags();
+		state.pointsCount = manifold.pointsCount;
+		state.wasTouched = contact->wasTouched();
+		writeState(buffer, &state, 1);
+		writeState(buffer, manifold.points, manifold.pointsCount);
+	}
+}
+
+void World::restoreState(const uint8_t *data, size_t size)
+{
+	StateReader reader;
+	reader.data = data;
+	reader.dataSize = size;
+	reader.offset = 0;
+
+	WorldStateHeader header;
+	reader.read(&header, 1);
+	if (header.magic != STATE_MAGIC || header.version != STATE_VERSION || header.bodyCount != m_rigidbodyCount)
+	{
+		AL_CORE_ERROR("World state version: {0}, body count: {1}", header.version, header.bodyCount);
+		throw std::runtime_error("invalid world state");
+	}
+
+	BroadPhase &broadPhase = m_contactManager.m_broadPhase;
+
+	// contact는 저장된 순서대로 다시 만들기 위해 모두 제거
+	m_contactManager.clear();
+
+	for (Rigidbody *body = m_rigidbodies; body; body = body->next)
+	{
+		BodyState state;
+		reader.read(&state, 1);
+		if (state.bodyId != body->getBodyId())
+		{
+			AL_CORE_ERROR("World state body id: {0}, expected: {1}", state.bodyId, body->getBodyId());
+			throw std::runtime_error("invalid world state");
+		}
+
+		m_stateForces.resize(std::max(state.forceCount, 0));
+		reader.read(m_stateForces.data(), state.forceCount);
+		body->setState(state, m_stateForces.data());
+
+		Fixture *fixtures = body->getFixtures();
+		for (int32_t i = 0; i < body->getFixtureCount(); ++i)
+		{
+			int32_t touchNum;
+			reader.read(&touchNum, 1);
+			fixtures[i].setTouchNum(touchNum);
+
+			for (int32_t j = 0; j < fixtures[i].getProxyCount(); ++j)
+			{
+				AABB aabb;
+				AABB fatAABB;
+				reader.read(&aabb, 1);
+				reader.read(&fatAABB, 1);
+				fixtures[i].restoreProxy(&broadPhase, j, aabb, fatAABB);
+			}
+		}
+	}
+
+	broadPhase.clearMoveBuffer();
+	for (int32_t i = 0; i < header.moveCount; ++i)
+	{
+		int32_t proxyId;
+		reader.read(&proxyId, 1);
+		broadPhase.bufferMove(proxyId);
+	}
+
+	for (int32_t i = 0; i < header.contactCount; ++i)
+	{
+		ContactState state;
+		reader.read(&state, 1);
+		if (state.pointsCount < 0 || state.pointsCount > MAX_MANIFOLD_COUNT)
+		{
+			AL_CORE_ERROR("World state manifold points: {0}", state.pointsCount);
+			throw std::runtime_error("invalid world state");
+		}
+
+		FixtureProxy *proxyA = static_cast<FixtureProxy *>(broadPhase.getUserData(state.proxyIdA));
+		FixtureProxy *proxyB = static_cast<FixtureProxy *>(broadPhase.getUserData(state.proxyIdB));
+		Contact *contact =
+			m_contactManager.createContact(proxyA->fixture, proxyB->fixture, proxyA->childIndex, proxyB->childIndex);
+		contact->restoreState(state.flags, state.wasTouched);
+
+		Manifold &manifold = contact->getManifold();
+		manifold.pointsCount = state.pointsCount;
+		reader.read(manifold.points, state.pointsCount);
+	}
+
+	if (reader.offset != size)
+	{
+		AL_CORE_ERROR("World state size: {0}, read: {1}", size, reader.offset);
+		throw std::runtime_error("invalid world state");
+	}
+
+	m_accumulator = header.accumulator;
+	m_interpolationAlpha = header.interpolationAlpha;
+}
+
+void World::setFixedTimestepEnabled(bool enabled)
+{
+	m_isFixedTimestep = enabled;
+	m_accumulator = 0.0f;
+	m_interpolationAlpha = 1.0f;
+}
+
+bool World::isFixedTimestepEnabled() const
+{
+	return m_isFixedTimestep;
+}
+
+void World::setFixedTimestepHz(float hz)
+{
+	if (hz <= 0.0f)
+	{
+		AL_CORE_ERROR("Fixed timestep hz: {0}", hz);
+		throw std::runtime_error("invalid fixed timestep hz");
+	}
+	m_fixedTimestep = 1.0f / hz;
+}
+
+float World::getFixedTimestepHz() const
+{
+	return 1.0f / m_fixedTimestep;
+}
+
+void World::setMaxSubSteps(int32_t maxSubSteps)
+{
+	m_maxSubSteps = std::max(1, maxSubSteps);
+}
+
+int32_t World::getMaxSubSteps() const
+{
+	return m_maxSubSteps;
+}
+
+void World::setAABBSettings(float margin, float predictionFactor)
+{
+	m_aabbMargin = std::max(margin, 0.0f);
+	m_aabbPredictionFactor = std::max(predictionFactor, 0.0f);
+}
+
+float World::getAABBMargin() const
+{
+	return m_aabbMargin;
+}
+
+float World::getAABBPredictionFactor() const
+{
+	return m_aabbPredictionFactor;
+}
+
+float World::getInterpolationAlpha() const
+{
+	return m_interpolationAlpha;
+}
+
+Rigidbody *World::getBody(BodyHandle handle) const
+{
+	if (handle.index < 0 || handle.index >= static_cast<int32_t>(m_bodySlots.size()))
+	{
+		return nullptr;
+	}
+
+	const BodySlot &slot = m_bodySlots[handle.index];
+	if (slot.generation != handle.generation || slot.denseIndex == -1)
+	{
+		return nullptr;
+	}
+	return m_bodyArray[slot.denseIndex];
+}
+
+void World::registerBodyForce(BodyHandle handle, const alglm::vec3 &force)
+{
+	Rigidbody *body = getBody(handle);
+	if (body == nullptr)
+	{
+		return;
 	}
 	body->registerForce(force);
 }
 
+void World::registerBodyForces(const BodyHandle *handles, const alglm::vec3 *forces, int32_t count)
+{
+	for (int32_t i = 0; i < count; ++i)
+	{
+		registerBodyForce(handles[i], forces[i]);
+	}
+}
+
 } // namespace ale
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Renderer/Buffer.h"
+#include "Memory/MemoryTracker.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb/stb_image.h"
 
@@ -37,7 +38,7 @@ void Buffer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryP
 	allocInfo.memoryTypeIndex = VulkanUtil::findMemoryType(memRequirements.memoryTypeBits, properties);
 
 	// 버퍼 메모리 할당
-	if (vkAllocateMemory(m_device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS)
+	if (VulkanUtil::allocateMemory(m_device, allocInfo, bufferMemory) != VK_SUCCESS)
 	{
 		throw std::runtime_error("failed to allocate buffer memory!");
 	}
@@ -118,7 +119,7 @@ void VertexBuffer::cleanup()
 	}
 	if (m_bufferMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(m_device, m_bufferMemory, nullptr);
+		VulkanUtil::freeMemory(m_device, m_bufferMemory);
 		m_bufferMemory = VK_NULL_HANDLE;
 	}
 }
@@ -157,7 +158,7 @@ void VertexBuffer::initVertexBuffer(std::vector<Vertex> &vertices)
 	copyBuffer(stagingBuffer, m_buffer, bufferSize);
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 }
 
 std::unique_ptr<IndexBuffer> IndexBuffer::createIndexBuffer(std::vector<uint32_t> &indices)
@@ -176,7 +177,7 @@ void IndexBuffer::cleanup()
 	}
 	if (m_bufferMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(m_device, m_bufferMemory, nullptr);
+		VulkanUtil::freeMemory(m_device, m_bufferMemory);
 		m_bufferMemory = VK_NULL_HANDLE;
 	}
 }
@@ -213,7 +214,7 @@ void IndexBuffer::initIndexBuffer(std::vector<uint32_t> &indices)
 	copyBuffer(stagingBuffer, m_buffer, bufferSize);
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 }
 
 std::unique_ptr<ImageBuffer> ImageBuffer::createImageBuffer(std::string path, bool flipVertically)
@@ -252,7 +253,7 @@ void ImageBuffer::cleanup()
 	}
 	if (textureImageMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(m_device, textureImageMemory, nullptr);
+		VulkanUtil::freeMemory(m_device, textureImageMemory);
 		textureImageMemory = VK_NULL_HANDLE;
 	}
 }
@@ -272,6 +273,7 @@ bool ImageBuffer::initImageBuffer(std::string path, bool flipVertically)
 
 	if (!pixels)
 		return false;
+	MemoryTracker::recordAllocation(MemoryTag::Assets, static_cast<int64_t>(imageSize));
 
 	mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(texWidth, texHeight)))) + 1;
 
@@ -287,6 +289,7 @@ bool ImageBuffer::initImageBuffer(std::string path, bool flipVertically)
 	vkUnmapMemory(m_device, stagingBufferMemory);
 
 	stbi_image_free(pixels);
+	MemoryTracker::recordFree(MemoryTag::Assets, static_cast<int64_t>(imageSize));
 	VulkanUtil::createImage(
 		texWidth, texHeight, mipLevels, VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
 		VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
@@ -297,7 +300,7 @@ bool ImageBuffer::initImageBuffer(std::string path, bool flipVertically)
 	copyBufferToImage(stagingBuffer, textureImage, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 
 	generateMipmaps(textureImage, VK_FORMAT_R8G8B8A8_SRGB, texWidth, texHeight, mipLevels);
 	return true;
@@ -318,6 +321,7 @@ bool ImageBuffer::initMaterialImageBuffer(std::string path, bool flipVertically)
 
 	if (!pixels)
 		return false;
+	MemoryTracker::recordAllocation(MemoryTag::Assets, static_cast<int64_t>(imageSize));
 
 	mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(texWidth, texHeight)))) + 1;
 
@@ -333,6 +337,7 @@ bool ImageBuffer::initMaterialImageBuffer(std::string path, bool flipVertically)
 	vkUnmapMemory(m_device, stagingBufferMemory);
 
 	stbi_image_free(pixels);
+	MemoryTracker::recordFree(MemoryTag::Assets, static_cast<int64_t>(imageSize));
 
 	VulkanUtil::createImage(
 		texWidth, texHeight, mipLevels, VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL,
@@ -344,7 +349,7 @@ bool ImageBuffer::initMaterialImageBuffer(std::string path, bool flipVertically)
 	copyBufferToImage(stagingBuffer, textureImage, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 
 	generateMipmaps(textureImage, VK_FORMAT_R8G8B8A8_UNORM, texWidth, texHeight, mipLevels);
 	return true;
@@ -408,7 +413,7 @@ void ImageBuffer::initImageBufferFromMemory(const aiTexture *texture)
 	copyBufferToImage(stagingBuffer, textureImage, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 
 	generateMipmaps(textureImage, VK_FORMAT_R8G8B8A8_UNORM, texWidth, texHeight, mipLevels);
 }
@@ -460,7 +465,7 @@ void ImageBuffer::initDefaultImageBuffer(alglm::vec4 color)
 						  VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels);
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 }
 
 std::unique_ptr<ImageBuffer> ImageBuffer::createDefaultSingleChannelImageBuffer(float value)
@@ -509,7 +514,7 @@ void ImageBuffer::initDefaultSingleChannelImageBuffer(float value)
 						  VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels);
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 }
 
 // 이미지 레이아웃, 접근 권한을 변경할 수 있는 베리어를 커맨드 버퍼에 기록
@@ -708,7 +713,7 @@ void UniformBuffer::cleanup()
 	}
 	if (m_bufferMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(m_device, m_bufferMemory, nullptr);
+		VulkanUtil::freeMemory(m_device, m_bufferMemory);
 		m_bufferMemory = VK_NULL_HANDLE;
 	}
 }
@@ -752,6 +757,7 @@ bool ImageBuffer::initHDRImageBuffer(std::string path)
 	if (!pixels)
 		return false;
 	VkDeviceSize imageSize = texWidth * texHeight * 4 * sizeof(float);
+	MemoryTracker::recordAllocation(MemoryTag::Assets, static_cast<int64_t>(imageSize));
 
 	mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(texWidth, texHeight)))) + 1;
 
@@ -767,6 +773,7 @@ bool ImageBuffer::initHDRImageBuffer(std::string path)
 	vkUnmapMemory(m_device, stagingBufferMemory);
 
 	stbi_image_free(pixels);
+	MemoryTracker::recordFree(MemoryTag::Assets, static_cast<int64_t>(imageSize));
 	VulkanUtil::createImage(
 		texWidth, texHeight, mipLevels, VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_TILING_OPTIMAL,
 		VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
@@ -777,7 +784,7 @@ bool ImageBuffer::initHDRImageBuffer(std::string path)
 	copyBufferToImage(stagingBuffer, textureImage, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(m_device, stagingBuffer, nullptr);
-	vkFreeMemory(m_device, stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(m_device, stagingBufferMemory);
 
 	generateMipmaps(textureImage, VK_FORMAT_R32G32B32A32_SFLOAT, texWidth, texHeight, mipLevels);
 	return true;
@@ -804,7 +811,7 @@ void StorageBuffer::cleanup()
 	}
 	if (m_bufferMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(m_device, m_bufferMemory, nullptr);
+		VulkanUtil::freeMemory(m_device, m_bufferMemory);
 		m_bufferMemory = VK_NULL_HANDLE;
 	}
 	m_currentSize = 0;
@@ -1,4 +1,5 @@
 #include "Renderer/FrameBuffers.h"
+#include "Renderer/VulkanUtil.h"
 #include "ImGui/ImGuiVulkanRenderer.h"
 
 namespace ale
@@ -26,35 +27,35 @@ void FrameBuffers::cleanup()
 
 	vkDestroyImageView(device, depthImageView, nullptr);
 	vkDestroyImage(device, depthImage, nullptr);
-	vkFreeMemory(device, depthImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, depthImageMemory);
 
 	vkDestroyImageView(device, positionImageView, nullptr);
 	vkDestroyImage(device, positionImage, nullptr);
-	vkFreeMemory(device, positionImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, positionImageMemory);
 
 	vkDestroyImageView(device, normalImageView, nullptr);
 	vkDestroyImage(device, normalImage, nullptr);
-	vkFreeMemory(device, normalImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, normalImageMemory);
 
 	vkDestroyImageView(device, albedoImageView, nullptr);
 	vkDestroyImage(device, albedoImage, nullptr);
-	vkFreeMemory(device, albedoImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, albedoImageMemory);
 
 	vkDestroyImageView(device, pbrImageView, nullptr);
 	vkDestroyImage(device, pbrImage, nullptr);
-	vkFreeMemory(device, pbrImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, pbrImageMemory);
 
 	vkDestroyImageView(device, viewPortImageView, nullptr);
 	vkDestroyImage(device, viewPortImage, nullptr);
-	vkFreeMemory(device, viewPortImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, viewPortImageMemory);
 
 	vkDestroyImageView(device, sphericalMapImageView, nullptr);
 	vkDestroyImage(device, sphericalMapImage, nullptr);
-	vkFreeMemory(device, sphericalMapImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, sphericalMapImageMemory);
 
 	vkDestroyImageView(device, backgroundImageView, nullptr);
 	vkDestroyImage(device, backgroundImage, nullptr);
-	vkFreeMemory(device, backgroundImageMemory, nullptr);
+	VulkanUtil::freeMemory(device, backgroundImageMemory);
 
 	for (auto framebuffer : framebuffers)
 	{
@@ -1,5 +1,6 @@
 #include "Renderer/Model.h"
 #include "Core/App.h"
+#include "Memory/MemoryTracker.h"
 #include "Renderer/ShaderResourceManager.h"
 #include "Scene/CullTree.h"
 
@@ -301,6 +302,11 @@ void Model::loadGLTFModel(std::string path, std::shared_ptr<Material> &defaultMa
 		importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_JoinIdenticalVertices |
 									aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph);
 
+	// import한 aiScene은 importer가 소멸할 때 해제되므로 예외로 나가더라도 함수를 나갈 때 해제로 기록
+	aiMemoryInfo memoryInfo;
+	importer.GetMemoryRequirements(memoryInfo);
+	ScopedMemoryRecord sceneRecord(MemoryTag::Assets, memoryInfo.total);
+
 	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
 	{
 		std::cerr << "Failed to load GLTF model!" << std::endl;
@@ -1,6 +1,7 @@
 #include "Renderer/Renderer.h"
 #include "ALpch.h"
 #include "ImGui/ImGuiLayer.h"
+#include "Memory/FrameAllocator.h"
 #include "Renderer/CameraController.h"
 
 #include "Renderer/RenderingComponent.h"
@@ -1260,7 +1261,7 @@ void Renderer::recordShadowMapCommandBuffer(Scene *scene, VkCommandBuffer comman
 							&shadowMapDescriptorSetsSSBO[shadowMapIndex][currentFrame], 0, nullptr);
 
 	uint32_t modelIndex = 0;
-	for (auto &meshKeyValue : m_shadowMapMeshes[currentFrame])
+	for (auto &meshKeyValue : *m_shadowMapMeshes[currentFrame])
 	{
 		auto &mesh = m_meshMap[meshKeyValue.first];
 		mesh->drawShadowSSBO(commandBuffer, meshKeyValue.second.size(), modelIndex);
@@ -1352,7 +1353,7 @@ void Renderer::recordShadowCubeMapCommandBuffer(Scene *scene, VkCommandBuffer co
 		pushConstants.layerIndex = i;
 		vkCmdPushConstants(commandBuffer, shadowCubeMapPipelineLayoutSSBO, VK_SHADER_STAGE_VERTEX_BIT, 0,
 						   sizeof(pushConstants), &pushConstants);
-		for (auto &meshKeyValue : m_shadowMapMeshes[currentFrame])
+		for (auto &meshKeyValue : *m_shadowMapMeshes[currentFrame])
 		{
 			auto &mesh = m_meshMap[meshKeyValue.first];
 			mesh->drawShadowSSBO(commandBuffer, meshKeyValue.second.size(), modelIndex);
@@ -1648,7 +1649,10 @@ void Renderer::recordColliderCommandBuffer(Scene *scene, VkCommandBuffer command
 
 void Renderer::updateShadowMapSSBO(Scene *scene)
 {
-	m_shadowMapMeshes[currentFrame].clear();
+	// 프레임 임시 메모리에 새로 만들어 이번 프레임의 command buffer 기록까지 사용
+	FrameAllocator &frameAllocator = FrameAllocator::get();
+	m_shadowMapMeshes[currentFrame] = frameAllocator.create<ShadowMapMeshes>(frameAllocator.getResource());
+	ShadowMapMeshes &shadowMapMeshes = *m_shadowMapMeshes[currentFrame];
 
 	auto &view = scene->getAllEntitiesWith<TransformComponent, TagComponent, MeshRendererComponent>();
 
@@ -1672,13 +1676,19 @@ void Renderer::updateShadowMapSSBO(Scene *scene)
 		for (auto &mesh : meshes)
 		{
 			auto modelMatrix = model * mesh->getNodeTransform();
-			m_shadowMapMeshes[currentFrame][mesh->getId()].push_back(modelMatrix);
+			shadowMapMeshes[mesh->getId()].push_back(modelMatrix);
 		}
 	}
 
-	std::vector<ShadowMapSSBO> ssbo;
+	size_t modelCount = 0;
+	for (auto &meshKeyValue : shadowMapMeshes)
+	{
+		modelCount += meshKeyValue.second.size();
+	}
 
-	for (auto &meshKeyValue : m_shadowMapMeshes[currentFrame])
+	std::pmr::vector<ShadowMapSSBO> ssbo(frameAllocator.getResource());
+	ssbo.reserve(modelCount);
+	for (auto &meshKeyValue : shadowMapMeshes)
 	{
 		auto &modelMatrices = meshKeyValue.second;
 		for (auto &modelMatrix : modelMatrices)
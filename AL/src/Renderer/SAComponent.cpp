@@ -252,13 +252,15 @@ void SAComponent::blendUpdate(
 	animB.uploadData(getData(animBIndex), getAnimRepeat(&animB));
 
 	float blendFactor = std::min(m_StateManager->transitionTime / m_StateManager->transitionDuration, 1.0f);
-	Bones poseFrom, poseTo;
+	// 캡처된 포즈는 복사하지 않고, 실행 중인 포즈는 용량을 재사용하는 버퍼에 저장
+	const Bones *poseFrom = &m_CapturedPose;
 
 	if (animA.isRunning())
 	{
 		m_Animations->uploadData(&animA, m_FrameCounter);
 		m_Animations->update(timestep, m_Skeleton, currentFrame);
-		poseFrom = m_Skeleton.m_Bones;
+		m_BlendPose = m_Skeleton.m_Bones;
+		poseFrom = &m_BlendPose;
 		this->setData(m_FrameCounter, animA.getData(), animAIndex); // prevState 애니메이션이 기존 애니메이션이므로 기존 애니메이션의 키프레임 데이터를 유지
 	}
 	else
@@ -270,26 +272,24 @@ void SAComponent::blendUpdate(
 			m_CapturedPose = m_Skeleton.m_Bones;
 			this->setData(m_FrameCounter, animA.getData(), animAIndex); // prevState 애니메이션이 기존 애니메이션이므로 기존 애니메이션의 키프레임 데이터를 유지
 		}
-		poseFrom = m_CapturedPose;
 	}
 
 	m_Animations->uploadData(&animB, m_FrameCounter);
 	m_Animations->update(timestep, m_Skeleton, currentFrame);
-	poseTo = m_Skeleton.m_Bones;
 	this->setData(currentFrame, animB.getData(), animBIndex);
 
-	m_Skeleton.m_Bones = blendBones(poseTo, poseFrom, blendFactor);
+	blendBones(m_Skeleton.m_Bones, *poseFrom, blendFactor);
 	m_Skeleton.update();
 
 	m_CurrentPose = m_Skeleton.m_ShaderData.m_FinalBonesMatrices;
 	flush();
 }
 
-SAComponent::Bones SAComponent::blendBones(Bones &to, Bones &from, float blendFactor)
+void SAComponent::blendBones(Bones &to, const Bones &from, float blendFactor)
 {
 	if (to.size() != from.size())
 	{
-		return to;
+		return;
 	}
 
 	size_t numberOfBones = to.size();
@@ -303,8 +303,6 @@ SAComponent::Bones SAComponent::blendBones(Bones &to, Bones &from, float blendFa
 		to[boneIndex].m_DeformedNodeScale =
 			alglm::mix(from[boneIndex].m_DeformedNodeScale, to[boneIndex].m_DeformedNodeScale, blendFactor);
 	}
-
-	return to;
 }
 
 struct SAData SAComponent::getData(unsigned int index) const
@@ -1,7 +1,18 @@
 #include "Renderer/VulkanUtil.h"
+#include "Memory/MemoryTracker.h"
+
+#include <mutex>
+#include <unordered_map>
 
 namespace ale
 {
+namespace
+{
+// 해제할 때 MemoryTracker에 기록할 크기를 찾기 위한 디바이스 메모리별 할당 크기
+std::mutex s_deviceMemoryMutex;
+std::unordered_map<VkDeviceMemory, VkDeviceSize> s_deviceMemorySizes;
+} // namespace
+
 void VulkanUtil::createImage(uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples,
 							 VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
 							 VkMemoryPropertyFlags properties, VkImage &image, VkDeviceMemory &imageMemory)
@@ -46,7 +57,7 @@ void VulkanUtil::createImage(uint32_t width, uint32_t height, uint32_t mipLevels
 	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties); // 메모리 유형과 속성 설정
 
 	// 이미지를 위한 메모리 할당
-	if (vkAllocateMemory(device, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS)
+	if (allocateMemory(device, allocInfo, imageMemory) != VK_SUCCESS)
 	{
 		throw std::runtime_error("failed to allocate image memory!");
 	}
@@ -55,6 +66,33 @@ void VulkanUtil::createImage(uint32_t width, uint32_t height, uint32_t mipLevels
 	vkBindImageMemory(device, image, imageMemory, 0);
 }
 
+VkResult VulkanUtil::allocateMemory(VkDevice device, const VkMemoryAllocateInfo &allocInfo, VkDeviceMemory &memory)
+{
+	VkResult result = vkAllocateMemory(device, &allocInfo, nullptr, &memory);
+	if (result == VK_SUCCESS)
+	{
+		std::lock_guard<std::mutex> lock(s_deviceMemoryMutex);
+		s_deviceMemorySizes[memory] = allocInfo.allocationSize;
+		MemoryTracker::recordAllocation(MemoryTag::Renderer, static_cast<int64_t>(allocInfo.allocationSize));
+	}
+	return result;
+}
+
+void VulkanUtil::freeMemory(VkDevice device, VkDeviceMemory memory)
+{
+	if (memory != VK_NULL_HANDLE)
+	{
+		std::lock_guard<std::mutex> lock(s_deviceMemoryMutex);
+		auto it = s_deviceMemorySizes.find(memory);
+		if (it != s_deviceMemorySizes.end())
+		{
+			MemoryTracker::recordFree(MemoryTag::Renderer, static_cast<int64_t>(it->second));
+			s_deviceMemorySizes.erase(it);
+		}
+	}
+	vkFreeMemory(device, memory, nullptr);
+}
+
 /*
 	GPU와 buffer가 호환되는 메모리 유형중 properties에 해당하는 속성들을 갖는 메모리 유형 찾기
 */
@@ -431,7 +469,7 @@ void VulkanUtil::createCubeMapImage(uint32_t width, uint32_t height, uint32_t mi
 	allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties); // 메모리 유형 설정
 
 	// 이미지를 위한 메모리 할당
-	if (vkAllocateMemory(device, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS)
+	if (allocateMemory(device, allocInfo, imageMemory) != VK_SUCCESS)
 	{
 		throw std::runtime_error("failed to allocate cube image memory!");
 	}
@@ -182,6 +182,17 @@ void Scene::destroyEntity(Entity entity)
 		mesh.m_RenderingComponent->cleanup();
 	}
 
+	// 런타임 중이면 World에서 Rigidbody 제거
+	if (m_World && entity.hasComponent<RigidbodyComponent>())
+	{
+		auto &rb = entity.getComponent<RigidbodyComponent>();
+		if (rb.body)
+		{
+			m_World->destroyBody((Rigidbody *)rb.body);
+			rb.body = nullptr;
+		}
+	}
+
 	if (entity.hasComponent<BoxColliderComponent>())
 	{
 		auto &box = entity.getComponent<BoxColliderComponent>();
@@ -331,10 +342,10 @@ void Scene::onUpdateRuntime(Timestep ts)
 		}
 		// update Physics
 		{
-			m_World->startFrame();
-			// Run physics
-			m_World->runPhysics(ts);
-			// set transforms of entity by body
+			// Run physics (고정 timestep으로 필요한 만큼 step)
+			m_World->step(ts);
+			float alpha = m_World->getInterpolationAlpha();
+			// set transforms of entity by body (마지막 두 step 사이를 보간)
 			auto view = m_Registry.view<RigidbodyComponent>();
 			for (auto e : view)
 			{
@@ -345,8 +356,9 @@ void Scene::onUpdateRuntime(Timestep ts)
 
 				Rigidbody *body = (Rigidbody *)rb.body;
 
-				tf.m_Position = body->getTransform().position;
-				tf.m_Rotation = alglm::eulerAngles(body->getTransform().orientation);
+				Transform renderTransform = body->getInterpolatedTransform(alpha);
+				tf.m_Position = renderTransform.position;
+				tf.m_Rotation = alglm::eulerAngles(renderTransform.orientation);
 				tf.m_WorldTransform = tf.getTransform();
 
 				if (entity.hasComponent<BoxColliderComponent>())
@@ -527,6 +539,8 @@ void Scene::onPhysicsStart()
 		bdDef.m_angularDamping = rb.m_AngularDamping;
 		bdDef.m_gravityScale = 15.0f;
 		bdDef.m_useGravity = rb.m_UseGravity;
+		bdDef.m_isBullet = rb.m_IsBullet;
+		bdDef.m_userData = entity.getUUID();
 		bdDef.m_posFreeze = rb.m_FreezePos;
 		bdDef.m_rotFreeze = rb.m_FreezeRot;
 
@@ -561,6 +575,9 @@ void Scene::onPhysicsStart()
 			fDef.friction = bc.m_Friction;
 			fDef.restitution = bc.m_Restitution;
 			fDef.isSensor = bc.m_IsTrigger;
+			fDef.filter.categoryBits = bc.m_CategoryBits;
+			fDef.filter.maskBits = bc.m_MaskBits;
+			fDef.filter.groupIndex = bc.m_GroupIndex;
 			fDef.touchNum = 0;
 
 			// create fixture
@@ -589,6 +606,9 @@ void Scene::onPhysicsStart()
 			fDef.friction = sc.m_Friction;
 			fDef.restitution = sc.m_Restitution;
 			fDef.isSensor = sc.m_IsTrigger;
+			fDef.filter.categoryBits = sc.m_CategoryBits;
+			fDef.filter.maskBits = sc.m_MaskBits;
+			fDef.filter.groupIndex = sc.m_GroupIndex;
 			fDef.touchNum = 0;
 
 			// create fixture
@@ -630,6 +650,9 @@ void Scene::onPhysicsStart()
 			fDef.friction = cc.m_Friction;
 			fDef.restitution = cc.m_Restitution;
 			fDef.isSensor = cc.m_IsTrigger;
+			fDef.filter.categoryBits = cc.m_CategoryBits;
+			fDef.filter.maskBits = cc.m_MaskBits;
+			fDef.filter.groupIndex = cc.m_GroupIndex;
 			fDef.touchNum = 0;
 
 			// create fixture
@@ -661,17 +684,37 @@ void Scene::onPhysicsStart()
 			fDef.friction = cc.m_Friction;
 			fDef.restitution = cc.m_Restitution;
 			fDef.isSensor = cc.m_IsTrigger;
+			fDef.filter.categoryBits = cc.m_CategoryBits;
+			fDef.filter.maskBits = cc.m_MaskBits;
+			fDef.filter.groupIndex = cc.m_GroupIndex;
 			fDef.touchNum = 0;
 
 			// create fixture
 			body->createFixture(&fDef);
 		}
 	}
+
+	// 삽입 순서로 만들어진 트리를 SAH로 다시 만들고 이후에는 회전과 주기적 재구성으로 품질 유지
+	// 무작위 이동만으로는 표면적 비율이 재구성 직후의 약 1.3배에서 멈추므로(TreeOptimizationBenchmark) 재구성은
+	// 한꺼번에 생성하는 경우처럼 그보다 크게 나빠졌을 때만 실행
+	m_World->rebuildBroadPhase();
+	m_World->setBroadPhaseOptimization(16, 1.5f);
 }
 
 void Scene::onPhysicsStop()
 {
 	// delete world
+	auto view = m_Registry.view<RigidbodyComponent>();
+	for (auto e : view)
+	{
+		view.get<RigidbodyComponent>(e).body = nullptr;
+	}
+
+	delete m_World;
+	m_World = nullptr;
+
+	// 시뮬레이션 동안 늘어난 블록 청크 중 모두 반환된 청크 해제
+	PhysicsAllocator::m_blockAllocator.trim();
 }
 
 std::shared_ptr<Model> Scene::getDefaultModel(int32_t idx)
@@ -383,6 +383,7 @@ static void serializeEntity(YAML::Emitter &out, Entity entity, Scene *scene)
 		out << YAML::Key << "Drag" << YAML::Value << rb.m_Damping;
 		out << YAML::Key << "AngularDrag" << YAML::Value << rb.m_AngularDamping;
 		out << YAML::Key << "UseGravity" << YAML::Value << rb.m_UseGravity;
+		out << YAML::Key << "IsBullet" << YAML::Value << rb.m_IsBullet;
 		out << YAML::EndMap; // Rigidbody
 	}
 	// BoxColliderComponent
@@ -394,6 +395,9 @@ static void serializeEntity(YAML::Emitter &out, Entity entity, Scene *scene)
 		out << YAML::Key << "Center" << YAML::Value << bc.m_Center;
 		out << YAML::Key << "Size" << YAML::Value << bc.m_Size;
 		out << YAML::Key << "IsTrigger" << YAML::Value << bc.m_IsTrigger;
+		out << YAML::Key << "CategoryBits" << YAML::Value << bc.m_CategoryBits;
+		out << YAML::Key << "MaskBits" << YAML::Value << bc.m_MaskBits;
+		out << YAML::Key << "GroupIndex" << YAML::Value << bc.m_GroupIndex;
 		out << YAML::EndMap; // BoxCollider
 	}
 	// SphereColliderComponent
@@ -405,6 +409,9 @@ static void serializeEntity(YAML::Emitter &out, Entity entity, Scene *scene)
 		out << YAML::Key << "Center" << YAML::Value << sc.m_Center;
 		out << YAML::Key << "Radius" << YAML::Value << sc.m_Radius;
 		out << YAML::Key << "IsTrigger" << YAML::Value << sc.m_IsTrigger;
+		out << YAML::Key << "CategoryBits" << YAML::Value << sc.m_CategoryBits;
+		out << YAML::Key << "MaskBits" << YAML::Value << sc.m_MaskBits;
+		out << YAML::Key << "GroupIndex" << YAML::Value << sc.m_GroupIndex;
 		out << YAML::EndMap; // SphereCollider
 	}
 	// CapsuleColliderComponent
@@ -417,6 +424,9 @@ static void serializeEntity(YAML::Emitter &out, Entity entity, Scene *scene)
 		out << YAML::Key << "Radius" << YAML::Value << cc.m_Radius;
 		out << YAML::Key << "Height" << YAML::Value << cc.m_Height;
 		out << YAML::Key << "IsTrigger" << YAML::Value << cc.m_IsTrigger;
+		out << YAML::Key << "CategoryBits" << YAML::Value << cc.m_CategoryBits;
+		out << YAML::Key << "MaskBits" << YAML::Value << cc.m_MaskBits;
+		out << YAML::Key << "GroupIndex" << YAML::Value << cc.m_GroupIndex;
 		out << YAML::EndMap; // CapusuleCollider
 	}
 	// CylinderColliderComponent
@@ -429,6 +439,9 @@ static void serializeEntity(YAML::Emitter &out, Entity entity, Scene *scene)
 		out << YAML::Key << "Radius" << YAML::Value << cc.m_Radius;
 		out << YAML::Key << "Height" << YAML::Value << cc.m_Height;
 		out << YAML::Key << "IsTrigger" << YAML::Value << cc.m_IsTrigger;
+		out << YAML::Key << "CategoryBits" << YAML::Value << cc.m_CategoryBits;
+		out << YAML::Key << "MaskBits" << YAML::Value << cc.m_MaskBits;
+		out << YAML::Key << "GroupIndex" << YAML::Value << cc.m_GroupIndex;
 		out << YAML::EndMap; // CylinderCollider
 	}
 	// SKeletalAnimatorComponent / SAComponent animation
@@ -749,6 +762,8 @@ bool SceneSerializer::deserialize(const std::string &filepath)
 				rb.m_Damping = rbComponent["Drag"].as<float>();
 				rb.m_AngularDamping = rbComponent["AngularDrag"].as<float>();
 				rb.m_UseGravity = rbComponent["UseGravity"].as<bool>();
+				if (rbComponent["IsBullet"])
+					rb.m_IsBullet = rbComponent["IsBullet"].as<bool>();
 			}
 			// BoxColliderComponent
 			auto bcComponent = entity["BoxColliderComponent"];
@@ -758,6 +773,12 @@ bool SceneSerializer::deserialize(const std::string &filepath)
 				bc.m_Center = bcComponent["Center"].as<alglm::vec3>();
 				bc.m_Size = bcComponent["Size"].as<alglm::vec3>();
 				bc.m_IsTrigger = bcComponent["IsTrigger"].as<bool>();
+				if (bcComponent["CategoryBits"])
+					bc.m_CategoryBits = bcComponent["CategoryBits"].as<uint32_t>();
+				if (bcComponent["MaskBits"])
+					bc.m_MaskBits = bcComponent["MaskBits"].as<uint32_t>();
+				if (bcComponent["GroupIndex"])
+					bc.m_GroupIndex = bcComponent["GroupIndex"].as<int32_t>();
 			}
 			// SphereColliderComponent
 			auto scComponent = entity["SphereColliderComponent"];
@@ -767,6 +788,12 @@ bool SceneSerializer::deserialize(const std::string &filepath)
 				sc.m_Center = scComponent["Center"].as<alglm::vec3>();
 				sc.m_Radius = scComponent["Radius"].as<float>();
 				sc.m_IsTrigger = scComponent["IsTrigger"].as<bool>();
+				if (scComponent["CategoryBits"])
+					sc.m_CategoryBits = scComponent["CategoryBits"].as<uint32_t>();
+				if (scComponent["MaskBits"])
+					sc.m_MaskBits = scComponent["MaskBits"].as<uint32_t>();
+				if (scComponent["GroupIndex"])
+					sc.m_GroupIndex = scComponent["GroupIndex"].as<int32_t>();
 			}
 			// CapsuleColliderComponent
 			auto capcComponent = entity["CapsuleColliderComponent"];
@@ -777,6 +804,12 @@ bool SceneSerializer::deserialize(const std::string &filepath)
 				cc.m_Radius = capcComponent["Radius"].as<float>();
 				cc.m_Height = capcComponent["Height"].as<float>();
 				cc.m_IsTrigger = capcComponent["IsTrigger"].as<bool>();
+				if (capcComponent["CategoryBits"])
+					cc.m_CategoryBits = capcComponent["CategoryBits"].as<uint32_t>();
+				if (capcComponent["MaskBits"])
+					cc.m_MaskBits = capcComponent["MaskBits"].as<uint32_t>();
+				if (capcComponent["GroupIndex"])
+					cc.m_GroupIndex = capcComponent["GroupIndex"].as<int32_t>();
 			}
 			// CylinderColliderComponent
 			auto cycComponent = entity["CylinderColliderComponent"];
@@ -787,6 +820,12 @@ bool SceneSerializer::deserialize(const std::string &filepath)
 				cc.m_Radius = cycComponent["Radius"].as<float>();
 				cc.m_Height = cycComponent["Height"].as<float>();
 				cc.m_IsTrigger = cycComponent["IsTrigger"].as<bool>();
+				if (cycComponent["CategoryBits"])
+					cc.m_CategoryBits = cycComponent["CategoryBits"].as<uint32_t>();
+				if (cycComponent["MaskBits"])
+					cc.m_MaskBits = cycComponent["MaskBits"].as<uint32_t>();
+				if (cycComponent["GroupIndex"])
+					cc.m_GroupIndex = cycComponent["GroupIndex"].as<int32_t>();
 			}
 		}
 		// // 2차 pass: relationshipTempMap을 이용해 실제 엔티티 연결
@@ -19,6 +19,7 @@
 #include "mono/metadata/threads.h"
 
 #include "Physics/Rigidbody.h"
+#include "Physics/World.h"
 
 namespace ale
 {
@@ -288,7 +289,7 @@ static void RigidbodyComponent_addForce(UUID entityID, alglm::vec3 *force)
 	Entity entity = scene->getEntityByUUID(entityID);
 
 	Rigidbody *body = (Rigidbody *)entity.getComponent<RigidbodyComponent>().body;
-	body->registerForce(*force);
+	scene->getPhysicsWorld()->registerBodyForce(body->getHandle(), *force);
 }
 
 static void RigidbodyComponent_getPosition(UUID entityID, alglm::vec3 *outPosition)
@@ -307,6 +308,7 @@ static void RigidbodyComponent_setPosition(UUID entityID, alglm::vec3 *position)
 
 	auto* rb = (Rigidbody *)entity.getComponent<RigidbodyComponent>().body;
 	rb->setPositionNoFreeze(*position);
+	rb->setAwake();
 }
 
 static void RigidbodyComponent_getRotation(UUID entityID, alglm::quat *outRotation)
@@ -325,6 +327,7 @@ static void RigidbodyComponent_setRotation(UUID entityID, alglm::quat *rotation)
 
 	auto* rb = (Rigidbody *)entity.getComponent<RigidbodyComponent>().body;
 	rb->setOrientation(*rotation);
+	rb->setAwake();
 }
 
 static int RigidbodyComponent_getTouchedNum(UUID entityID)
@@ -336,6 +339,194 @@ static int RigidbodyComponent_getTouchedNum(UUID entityID)
 	return rb->getTouchNum();
 }
 
+// Scene query
+// C#의 ALEngine.RaycastHit와 같은 메모리 배치
+struct ScriptRayCastHit
+{
+	uint64_t entityID;
+	alglm::vec3 point;
+	alglm::vec3 normal;
+	float distance;
+};
+
+static void toScriptRayCastHit(const RayCastHit &hit, ScriptRayCastHit *outHit)
+{
+	if (hit.body == nullptr)
+	{
+		*outHit = {};
+		return;
+	}
+
+	outHit->entityID = hit.body->getUserData();
+	outHit->point = hit.point;
+	outHit->normal = hit.normal;
+	outHit->distance = hit.distance;
+}
+
+static bool Physics_rayCast(alglm::vec3 *origin, alglm::vec3 *direction, float maxDistance, ScriptRayCastHit *outHit)
+{
+	World *world = ScriptingEngine::getSceneContext()->getPhysicsWorld();
+	RayCastHit hit = {};
+	if (world != nullptr)
+	{
+		world->rayCast(*origin, *direction, maxDistance, hit);
+	}
+	toScriptRayCastHit(hit, outHit);
+	return hit.body != nullptr;
+}
+
+static bool Physics_sphereCast(alglm::vec3 *origin, float radius, alglm::vec3 *direction, float maxDistance,
+							   ScriptRayCastHit *outHit)
+{
+	World *world = ScriptingEngine::getSceneContext()->getPhysicsWorld();
+	RayCastHit hit = {};
+	if (world != nullptr)
+	{
+		world->sphereCast(*origin, radius, *direction, maxDistance, hit);
+	}
+	toScriptRayCastHit(hit, outHit);
+	return hit.body != nullptr;
+}
+
+static MonoArray *Physics_overlapAABB(alglm::vec3 *lower, alglm::vec3 *upper)
+{
+	World *world = ScriptingEngine::getSceneContext()->getPhysicsWorld();
+	std::vector<Rigidbody *> bodies;
+	if (world != nullptr)
+	{
+		AABB aabb;
+		aabb.lowerBound = *lower;
+		aabb.upperBound = *upper;
+		world->overlapAABB(aabb, bodies);
+	}
+
+	MonoDomain *domain = mono_domain_get();
+	MonoClass *ulongClass = mono_class_from_name(mono_get_corlib(), "System", "UInt64");
+	MonoArray *array = mono_array_new(domain, ulongClass, static_cast<int>(bodies.size()));
+	for (int i = 0; i < static_cast<int>(bodies.size()); ++i)
+	{
+		mono_array_set(array, uint64_t, i, bodies[i]->getUserData());
+	}
+	return array;
+}
+
+static int Physics_rayCastBatch(MonoArray *origins, MonoArray *directions, float maxDistance, MonoArray *outHits)
+{
+	World *world = ScriptingEngine::getSceneContext()->getPhysicsWorld();
+	int32_t count = static_cast<int32_t>(std::min({mono_array_length(origins), mono_array_length(directions),
+												   mono_array_length(outHits)}));
+	if (world == nullptr || count == 0)
+	{
+		return 0;
+	}
+
+	std::vector<Ray> rays(count);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		rays[i].origin = mono_array_get(origins, alglm::vec3, i);
+		rays[i].direction = mono_array_get(directions, alglm::vec3, i);
+		rays[i].maxDistance = maxDistance;
+	}
+
+	std::vector<RayCastHit> hits(count);
+	int32_t hitCount = world->rayCastBatch(rays.data(), count, hits.data());
+
+	ScriptRayCastHit *scriptHits = mono_array_addr(outHits, ScriptRayCastHit, 0);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		toScriptRayCastHit(hits[i], &scriptHits[i]);
+	}
+	return hitCount;
+}
+
+static void Physics_addForces(MonoArray *entityIDs, MonoArray *forces)
+{
+	Scene *scene = ScriptingEngine::getSceneContext();
+	World *world = scene->getPhysicsWorld();
+	int32_t count = static_cast<int32_t>(std::min(mono_array_length(entityIDs), mono_array_length(forces)));
+	if (world == nullptr || count == 0)
+	{
+		return;
+	}
+
+	// Entity 조회는 먼저 끝내고 외력은 핸들로 한 번에 등록
+	std::vector<BodyHandle> handles(count);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		Entity entity = scene->getEntityByUUID(mono_array_get(entityIDs, uint64_t, i));
+		Rigidbody *body = (Rigidbody *)entity.getComponent<RigidbodyComponent>().body;
+		handles[i] = body->getHandle();
+	}
+
+	const alglm::vec3 *forceData = mono_array_addr(forces, alglm::vec3, 0);
+	world->registerBodyForces(handles.data(), forceData, count);
+}
+
+// C#의 ALEngine.PhysicsStats와 같은 메모리 배치 (히스토그램은 별도 호출로 전달)
+struct ScriptPhysicsStats
+{
+	int32_t bodyCount;
+	int32_t awakeBodyCount;
+	int32_t pairCount;
+	int32_t reinsertCount;
+	int32_t newContactCount;
+	int32_t contactCount;
+	int32_t touchingContactCount;
+	int32_t gjkIterations;
+	int32_t epaFaces;
+	int32_t islandCount;
+	int32_t largestIslandSize;
+	float integrateTime;
+	float broadPhaseTime;
+	float narrowPhaseTime;
+	float islandTime;
+	float solveTime;
+	float toiTime;
+	float stepTime;
+};
+
+static void Physics_getStats(ScriptPhysicsStats *outStats)
+{
+	World *world = ScriptingEngine::getSceneContext()->getPhysicsWorld();
+	if (world == nullptr)
+	{
+		*outStats = {};
+		return;
+	}
+
+	const PhysicsStats &stats = world->getStats();
+	outStats->bodyCount = stats.bodyCount;
+	outStats->awakeBodyCount = stats.awakeBodyCount;
+	outStats->pairCount = stats.pairCount;
+	outStats->reinsertCount = stats.reinsertCount;
+	outStats->newContactCount = stats.newContactCount;
+	outStats->contactCount = stats.contactCount;
+	outStats->touchingContactCount = stats.touchingContactCount;
+	outStats->gjkIterations = stats.gjkIterations;
+	outStats->epaFaces = stats.epaFaces;
+	outStats->islandCount = stats.islandCount;
+	outStats->largestIslandSize = stats.largestIslandSize;
+	outStats->integrateTime = stats.integrateTime;
+	outStats->broadPhaseTime = stats.broadPhaseTime;
+	outStats->narrowPhaseTime = stats.narrowPhaseTime;
+	outStats->islandTime = stats.islandTime;
+	outStats->solveTime = stats.solveTime;
+	outStats->toiTime = stats.toiTime;
+	outStats->stepTime = stats.stepTime;
+}
+
+static int Physics_getIslandSizeHistogram(MonoArray *outHistogram)
+{
+	World *world = ScriptingEngine::getSceneContext()->getPhysicsWorld();
+	int32_t count = std::min(static_cast<int32_t>(mono_array_length(outHistogram)), ISLAND_HISTOGRAM_SIZE);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		int32_t value = world != nullptr ? world->getStats().islandSizeHistogram[i] : 0;
+		mono_array_set(outHistogram, int32_t, i, value);
+	}
+	return count;
+}
+
 // ScriptComponent
 static void ScriptComponent_getField(UUID entityID, MonoString* fieldName, bool* ret)
 {
@@ -456,6 +647,14 @@ void ScriptGlue::registerFunctions()
 	ADD_INTERNAL_CALL(RigidbodyComponent_addForce);
 	ADD_INTERNAL_CALL(RigidbodyComponent_getTouchedNum);
 
+	ADD_INTERNAL_CALL(Physics_rayCast);
+	ADD_INTERNAL_CALL(Physics_sphereCast);
+	ADD_INTERNAL_CALL(Physics_overlapAABB);
+	ADD_INTERNAL_CALL(Physics_rayCastBatch);
+	ADD_INTERNAL_CALL(Physics_addForces);
+	ADD_INTERNAL_CALL(Physics_getStats);
+	ADD_INTERNAL_CALL(Physics_getIslandSizeHistogram);
+
 	ADD_INTERNAL_CALL(Animator_getAnimations);
 	ADD_INTERNAL_CALL(Animator_runAnimation);
 	ADD_INTERNAL_CALL(Animator_setRepeat);
@@ -5,10 +5,12 @@
 #include "mono/metadata/assembly.h"
 #include "mono/metadata/attrdefs.h"
 #include "mono/metadata/mono-debug.h"
+#include "mono/metadata/mono-gc.h"
 #include "mono/metadata/object.h"
 #include "mono/metadata/threads.h"
 
 #include "Core/FileSystem.h"
+#include "Memory/MemoryTracker.h"
 
 #include "Project/Project.h"
 
@@ -189,6 +191,16 @@ void ScriptingEngine::shutDown()
 	delete s_Data;
 }
 
+void ScriptingEngine::sampleMemoryUsage()
+{
+	if (s_Data == nullptr || s_Data->rootDomain == nullptr)
+	{
+		return;
+	}
+
+	MemoryTracker::setExternalBytes(MemoryTag::Scripting, mono_gc_get_used_size());
+}
+
 void ScriptingEngine::initMono()
 {
 	mono_set_assemblies_path("Sandbox/mono/lib");
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "BenchmarkUtil.h"
+
+#include "Physics/Rigidbody.h"
+#include "Physics/Shape/BoxShape.h"
+#include "Physics/Shape/CapsuleShape.h"
+#include "Physics/Shape/CylinderShape.h"
+#include "Physics/Shape/SphereShape.h"
+#include "Physics/World.h"
+
+#include <random>
+
+namespace ale
+{
+
+/**
+ * @file
+ * @brief 벤치마크에서 Scene::onPhysicsStart와 같은 방식으로 Rigidbody를 만드는 함수.
+ * @details 질량은 1이고 관성 텐서는 Scene의 Collider 컴포넌트별 식과 같습니다.
+ */
+
+/**
+ * @brief Shape를 복제해 Rigidbody에 Fixture를 추가합니다.
+ * @param body Fixture를 추가할 Rigidbody.
+ * @param shape 복제할 Shape.
+ */
+inline void addBenchmarkFixture(Rigidbody *body, const Shape &shape)
+{
+	FixtureDef fDef;
+	fDef.shape = shape.clone();
+	fDef.friction = 0.5f;
+	fDef.restitution = 0.0f;
+	body->createFixture(&fDef);
+}
+
+/**
+ * @brief 기본 설정으로 Rigidbody를 생성합니다.
+ * @param world Rigidbody를 생성할 World.
+ * @param type Rigidbody 타입.
+ * @param position 위치.
+ * @param orientation 회전.
+ * @return 생성된 Rigidbody.
+ */
+inline Rigidbody *createBenchmarkBody(World &world, EBodyType type, const alglm::vec3 &position,
+									  const alglm::quat &orientation)
+{
+	BodyDef bdDef;
+	bdDef.m_type = type;
+	bdDef.m_position = position;
+	bdDef.m_orientation = orientation;
+	return world.createBody(bdDef);
+}
+
+/** @brief 구 Fixture 하나를 가진 Rigidbody를 생성합니다. */
+inline Rigidbody *createSphereBody(World &world, EBodyType type, const alglm::vec3 &position, float radius)
+{
+	Rigidbody *body = createBenchmarkBody(world, type, position, alglm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+	SphereShape spShape;
+	spShape.setShapeFeatures(alglm::vec3(0.0f), radius);
+
+	float val = (2.0f / 5.0f) * radius * radius;
+	body->setMassData(1.0f, alglm::mat3(alglm::vec3(val, 0.0f, 0.0f), alglm::vec3(0.0f, val, 0.0f),
+										alglm::vec3(0.0f, 0.0f, val)));
+	addBenchmarkFixture(body, spShape);
+	return body;
+}
+
+/** @brief 박스 Fixture 하나를 가진 Rigidbody를 생성합니다. size는 전체 크기입니다. */
+inline Rigidbody *createBoxBody(World &world, EBodyType type, const alglm::vec3 &position, const alglm::vec3 &size,
+								const alglm::quat &orientation = alglm::quat(1.0f, 0.0f, 0.0f, 0.0f))
+{
+	Rigidbody *body = createBenchmarkBody(world, type, position, orientation);
+
+	BoxShape boxShape;
+	boxShape.setVertices(alglm::vec3(0.0f), size);
+
+	float Ixx = (1.0f / 12.0f) * (size.y * size.y + size.z * size.z);
+	float Iyy = (1.0f / 12.0f) * (size.x * size.x + size.z * size.z);
+	float Izz = (1.0f / 12.0f) * (size.x * size.x + size.y * size.y);
+	body->setMassData(1.0f, alglm::mat3(alglm::vec3(Ixx, 0.0f, 0.0f), alglm::vec3(0.0f, Iyy, 0.0f),
+										alglm::vec3(0.0f, 0.0f, Izz)));
+	addBenchmarkFixture(body, boxShape);
+	return body;
+}
+
+/** @brief 캡슐 Fixture 하나를 가진 Rigidbody를 생성합니다. */
+inline Rigidbody *createCapsuleBody(World &world, EBodyType type, const alglm::vec3 &position, float radius,
+									float height, const alglm::quat &orientation = alglm::quat(1.0f, 0.0f, 0.0f, 0.0f))
+{
+	Rigidbody *body = createBenchmarkBody(world, type, position, orientation);
+
+	CapsuleShape csShape;
+	csShape.setShapeFeatures(alglm::vec3(0.0f), radius, height);
+
+	float mh = 0.25f;
+	float r = csShape.m_radius;
+	float h = csShape.m_height;
+	float d = (3.0f * r / 8.0f);
+	float val = (2.0f / 5.0f) * mh * r * r + (h / 2.0f * d * d);
+	alglm::mat3 ih(alglm::vec3(val, 0.0f, 0.0f), alglm::vec3(0.0f, val, 0.0f), alglm::vec3(0.0f, 0.0f, val));
+
+	float mc = 0.75f;
+	float Ixx = (1.0f / 12.0f) * (3.0f * r * r + h * h) * mc;
+	float Izz = (1.0f / 2.0f) * (r * r) * mc;
+	alglm::mat3 ic(alglm::vec3(Ixx, 0.0f, 0.0f), alglm::vec3(0.0f, Ixx, 0.0f), alglm::vec3(0.0f, 0.0f, Izz));
+
+	body->setMassData(mh * 2.0f + mc, ih * 2.0f + ic);
+	addBenchmarkFixture(body, csShape);
+	return body;
+}
+
+/** @brief 실린더 Fixture 하나를 가진 Rigidbody를 생성합니다. */
+inline Rigidbody *createCylinderBody(World &world, EBodyType type, const alglm::vec3 &position, float radius,
+									 float height, const alglm::quat &orientation = alglm::quat(1.0f, 0.0f, 0.0f, 0.0f))
+{
+	Rigidbody *body = createBenchmarkBody(world, type, position, orientation);
+
+	CylinderShape cyShape;
+	cyShape.setShapeFeatures(alglm::vec3(0.0f), radius, height);
+
+	float r = cyShape.m_radius;
+	float h = cyShape.m_height;
+	float Ixx = (1.0f / 12.0f) * (3.0f * r * r + h * h);
+	float Iyy = (1.0f / 2.0f) * (r * r);
+	body->setMassData(1.0f, alglm::mat3(alglm::vec3(Ixx, 0.0f, 0.0f), alglm::vec3(0.0f, Iyy, 0.0f),
+										alglm::vec3(0.0f, 0.0f, Ixx)));
+	addBenchmarkFixture(body, cyShape);
+	return body;
+}
+
+/**
+ * @brief 임의의 회전을 반환합니다.
+ * @param rng 난수 생성기.
+ * @return 정규화된 회전 쿼터니언.
+ */
+inline alglm::quat getRandomOrientation(std::mt19937 &rng)
+{
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	alglm::vec3 axis(unit(rng), unit(rng), unit(rng));
+	if (alglm::length2(axis) < 1e-6f)
+	{
+		axis = alglm::vec3(0.0f, 1.0f, 0.0f);
+	}
+	return alglm::angleAxis(unit(rng) * alglm::pi<float>(), alglm::normalize(axis));
+}
+
+} // namespace ale
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "alpch.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace ale
+{
+
+/**
+ * @file
+ * @brief 벤치마크 실행 파일이 함께 사용하는 시간 측정, 검사, 출력 함수.
+ */
+
+/**
+ * @class BenchmarkTimer
+ * @brief 생성하거나 reset한 시점부터 경과 시간을 측정하는 타이머.
+ */
+class BenchmarkTimer
+{
+  public:
+	BenchmarkTimer() : m_start(std::chrono::steady_clock::now())
+	{
+	}
+
+	/** @brief 측정 시작 시점을 현재로 되돌립니다. */
+	void reset()
+	{
+		m_start = std::chrono::steady_clock::now();
+	}
+
+	/** @brief 경과 시간을 밀리초 단위로 반환합니다. */
+	double getElapsedMs() const
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+	}
+
+  private:
+	std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @brief 명령행에 --quick이 있는지 확인합니다.
+ * @details ctest는 --quick으로 실행하여 반복 횟수를 줄이고 검사만 수행합니다.
+ * @return --quick이 있으면 true.
+ */
+inline bool isQuickRun(int argc, char **argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--quick") == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/** @brief 지금까지 실패한 검사 개수를 반환합니다. */
+inline int32_t &getBenchmarkFailureCount()
+{
+	static int32_t s_failureCount = 0;
+	return s_failureCount;
+}
+
+/**
+ * @brief 조건이 거짓이면 실패 메시지를 출력하고 실패 개수를 늘립니다.
+ * @param condition 검사할 조건.
+ * @param message 실패 메시지.
+ * @return condition.
+ */
+inline bool expect(bool condition, const char *message)
+{
+	if (!condition)
+	{
+		std::printf("FAILED: %s\n", message);
+		++getBenchmarkFailureCount();
+	}
+	return condition;
+}
+
+/**
+ * @brief 측정 결과 한 줄을 출력합니다.
+ * @param name 측정 항목 이름.
+ * @param ms 전체 시간 (밀리초 단위).
+ * @param operations 전체 시간 동안 수행한 연산 횟수.
+ */
+inline void printBenchmark(const char *name, double ms, int64_t operations)
+{
+	double nsPerOperation = operations > 0 ? ms * 1.0e6 / static_cast<double>(operations) : 0.0;
+	std::printf("%-48s %12.3f ms %12.2f ns/op\n", name, ms, nsPerOperation);
+}
+
+/**
+ * @brief 검사 결과를 출력하고 프로세스 종료 코드를 반환합니다.
+ * @return 실패한 검사가 없으면 EXIT_SUCCESS.
+ */
+inline int finishBenchmark()
+{
+	int32_t failureCount = getBenchmarkFailureCount();
+	if (failureCount > 0)
+	{
+		std::printf("%d check(s) failed\n", failureCount);
+		return EXIT_FAILURE;
+	}
+	std::printf("all checks passed\n");
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief 컴파일러가 측정 대상 연산을 제거하지 못하도록 값을 사용합니다.
+ * @param value 사용할 값.
+ */
+template <typename T> inline void consumeValue(const T &value)
+{
+	static volatile uint8_t s_sink;
+	s_sink = s_sink + *reinterpret_cast<const volatile uint8_t *>(&value);
+}
+
+} // namespace ale
@@ -0,0 +1,201 @@
+#include "BenchmarkUtil.h"
+
+#include "Memory/BlockAllocator.h"
+
+#include <thread>
+
+// 여러 스레드에서 동시에 작은 블록을 할당하고 해제하는 처리량을 BlockAllocator와 malloc / free로 비교
+// 1. 각 스레드가 자신이 할당한 블록을 해제하는 부하
+// 2. 각 스레드가 할당한 블록을 옆 스레드가 해제하는 부하 (스레드 캐시 사이로 블록이 옮겨 감)
+// 블록마다 할당한 스레드와 순번을 기록해 두고 해제할 때 확인하여 두 스레드가 같은 블록을 받지 않았는지 검사하고,
+// 스레드가 모두 끝난 뒤 사용 중인 바이트가 0으로 돌아오고 trim으로 모든 청크가 해제되는지 확인함
+
+namespace ale
+{
+namespace
+{
+const int32_t BATCH_SIZE = 256; /**< 한 번에 할당한 뒤 해제하는 블록 수 */
+
+// 16 ~ 256 바이트를 고르게 섞은 할당 크기
+int32_t getAllocationSize(int32_t index)
+{
+	return 16 + (index * 37) % 241;
+}
+
+struct MallocHeap
+{
+	void *allocate(int32_t size)
+	{
+		return std::malloc(size);
+	}
+
+	void free(void *pointer, int32_t)
+	{
+		std::free(pointer);
+	}
+};
+
+struct BlockHeap
+{
+	void *allocate(int32_t size)
+	{
+		return allocator->allocateBlock(size);
+	}
+
+	void free(void *pointer, int32_t size)
+	{
+		allocator->freeBlock(pointer, size);
+	}
+
+	BlockAllocator *allocator;
+};
+
+// 블록 앞부분에 할당한 스레드와 순번을 기록 (가장 작은 블록도 8바이트 이상)
+void stampBlock(void *pointer, int32_t thread, int32_t index)
+{
+	int32_t *stamp = static_cast<int32_t *>(pointer);
+	stamp[0] = thread;
+	stamp[1] = index;
+}
+
+bool isStamped(const void *pointer, int32_t thread, int32_t index)
+{
+	const int32_t *stamp = static_cast<const int32_t *>(pointer);
+	return stamp[0] == thread && stamp[1] == index;
+}
+
+// threadCount개의 스레드에서 work(thread)를 동시에 실행하고 모두 끝날 때까지 걸린 시간을 반환
+template <typename Work> double runThreads(int32_t threadCount, Work work)
+{
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount);
+
+	BenchmarkTimer timer;
+	for (int32_t thread = 0; thread < threadCount; ++thread)
+	{
+		threads.emplace_back(work, thread);
+	}
+	for (std::thread &thread : threads)
+	{
+		thread.join();
+	}
+	return timer.getElapsedMs();
+}
+
+// 각 스레드가 BATCH_SIZE개를 할당한 뒤 역순으로 해제하기를 반복
+template <typename Heap> bool benchmarkLocal(Heap heap, const char *name, int32_t threadCount, int32_t batchCount)
+{
+	std::atomic<bool> isValid(true);
+	double ms = runThreads(threadCount, [&](int32_t thread) {
+		void *pointers[BATCH_SIZE];
+		bool isThreadValid = true;
+		for (int32_t batch = 0; batch < batchCount; ++batch)
+		{
+			for (int32_t i = 0; i < BATCH_SIZE; ++i)
+			{
+				pointers[i] = heap.allocate(getAllocationSize(i));
+				stampBlock(pointers[i], thread, i);
+			}
+			for (int32_t i = BATCH_SIZE - 1; i >= 0; --i)
+			{
+				isThreadValid = isThreadValid && isStamped(pointers[i], thread, i);
+				heap.free(pointers[i], getAllocationSize(i));
+			}
+		}
+		if (isThreadValid == false)
+		{
+			isValid = false;
+		}
+	});
+
+	char label[64];
+	std::snprintf(label, sizeof(label), "%s alloc + free (same thread)", name);
+	printBenchmark(label, ms, static_cast<int64_t>(threadCount) * batchCount * BATCH_SIZE);
+	return isValid;
+}
+
+// 모든 스레드가 할당을 마친 뒤 스레드 thread가 (thread + 1) % threadCount의 블록을 해제
+template <typename Heap> bool benchmarkCrossThread(Heap heap, const char *name, int32_t threadCount, int32_t blockCount)
+{
+	std::vector<std::vector<void *>> pointers(threadCount, std::vector<void *>(blockCount));
+
+	double allocateMs = runThreads(threadCount, [&](int32_t thread) {
+		for (int32_t i = 0; i < blockCount; ++i)
+		{
+			pointers[thread][i] = heap.allocate(getAllocationSize(i));
+			stampBlock(pointers[thread][i], thread, i);
+		}
+	});
+
+	std::atomic<bool> isValid(true);
+	double freeMs = runThreads(threadCount, [&](int32_t thread) {
+		int32_t owner = (thread + 1) % threadCount;
+		bool isThreadValid = true;
+		for (int32_t i = 0; i < blockCount; ++i)
+		{
+			isThreadValid = isThreadValid && isStamped(pointers[owner][i], owner, i);
+			heap.free(pointers[owner][i], getAllocationSize(i));
+		}
+		if (isThreadValid == false)
+		{
+			isValid = false;
+		}
+	});
+
+	char label[64];
+	int64_t count = static_cast<int64_t>(threadCount) * blockCount;
+	std::snprintf(label, sizeof(label), "%s alloc", name);
+	printBenchmark(label, allocateMs, count);
+	std::snprintf(label, sizeof(label), "%s free (blocks of another thread)", name);
+	printBenchmark(label, freeMs, count);
+	return isValid;
+}
+
+void benchmarkThreads(int32_t threadCount, int32_t batchCount, int32_t crossBlockCount)
+{
+	std::printf("-- %d thread(s) --\n", threadCount);
+	BlockAllocator allocator(MemoryTag::Physics);
+	BlockHeap blockHeap = {&allocator};
+
+	bool isValid = benchmarkLocal(MallocHeap(), "malloc", threadCount, batchCount);
+	isValid = benchmarkLocal(blockHeap, "BlockAllocator", threadCount, batchCount) && isValid;
+	isValid = benchmarkCrossThread(MallocHeap(), "malloc", threadCount, crossBlockCount) && isValid;
+	isValid = benchmarkCrossThread(blockHeap, "BlockAllocator", threadCount, crossBlockCount) && isValid;
+	expect(isValid, "a block was handed to two owners at once");
+
+	// 작업 스레드가 모두 종료되어 캐시가 반환되었으므로 trim이 모든 블록을 모을 수 있음
+	BlockAllocatorStats stats = allocator.getStats();
+	int64_t reservedBytes = stats.reservedBytes;
+	int64_t releasedBytes = allocator.trim();
+	std::printf("reserved %lld KB, released by trim %lld KB\n", static_cast<long long>(reservedBytes / 1024),
+				static_cast<long long>(releasedBytes / 1024));
+	expect(stats.liveBytes == 0, "BlockAllocator still has live blocks after every thread freed its blocks");
+	expect(releasedBytes == reservedBytes, "trim did not release every chunk after the threads exited");
+	expect(allocator.getStats().reservedBytes == 0, "BlockAllocator kept chunks after trim");
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+	int32_t batchCount = quick ? 200 : 20000;
+	int32_t crossBlockCount = quick ? 10000 : 200000;
+
+	int32_t hardwareThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
+	std::printf("hardware threads %d\n", hardwareThreads);
+
+	std::vector<int32_t> threadCounts = {1, 2, 4};
+	if (hardwareThreads > threadCounts.back())
+	{
+		threadCounts.push_back(hardwareThreads);
+	}
+	for (int32_t threadCount : threadCounts)
+	{
+		// 스레드 수와 관계없이 전체 작업량이 같도록 나눔
+		ale::benchmarkThreads(threadCount, batchCount / threadCount, crossBlockCount / threadCount);
+	}
+
+	return ale::finishBenchmark();
+}
@@ -0,0 +1,187 @@
+#include "BenchmarkBodies.h"
+
+#include "Physics/Contact/Contact.h"
+
+// 해석적 충돌 계산(SphereToSphere, SphereToBox, SphereToCapsule)과 GJK/EPA를 같은 쌍에 실행해 법선과 깊이를 비교
+// 구 중심은 상대 Shape 밖에서 관통 깊이가 반지름보다 작은 위치만 뽑아 가장 가까운 점이 하나로 정해지게 함
+// 정확한 기하 계산과 해석적 결과, 해석적 결과와 GJK/EPA 결과를 각각 허용 오차와 비교함
+
+namespace ale
+{
+namespace
+{
+const float SPHERE_RADIUS = 0.5f;
+const float EXACT_NORMAL_TOLERANCE = 1e-3f; /**< 정확한 값과 해석적 결과의 법선 차이 (1 - cos) */
+const float EXACT_DEPTH_TOLERANCE = 1e-4f;	/**< 정확한 값과 해석적 결과의 깊이 차이 */
+// EPA는 support 점이 면에서 1e-2 안에 들어오면 멈추므로 깊이는 1e-2 정도, 법선은 그보다 크게 벗어남
+// 구 중심이 박스 모서리 가까이까지 깊게 들어간 경우 1 - cos가 9e-2 가까이 됨
+const float EPA_NORMAL_TOLERANCE = 1.2e-1f; /**< 해석적 결과와 GJK/EPA 결과의 법선 차이 (1 - cos) */
+const float EPA_DEPTH_TOLERANCE = 1.5e-2f;	/**< 해석적 결과와 GJK/EPA 결과의 깊이 차이 */
+// 구 대 구에서 support 점들이 원점을 지나는 직선 위에 놓이면 GJK 삼각형 단계가 반복 한도까지 순환하는 경우가 있음
+// 실제 step에서는 해석적 계산을 사용하므로 비율로만 제한함
+const float MAX_EPA_MISS_RATIO = 0.02f; /**< GJK/EPA가 관통한 쌍을 놓쳐도 되는 비율 */
+
+struct ValidationResult
+{
+	int32_t sampleCount;
+	int32_t analyticMissCount; /**< 해석적 계산이 충돌을 찾지 못한 횟수 */
+	int32_t epaMissCount;	   /**< GJK/EPA가 충돌을 찾지 못한 횟수 */
+	float maxExactNormalError;
+	float maxExactDepthError;
+	float maxEpaNormalError;
+	float maxEpaDepthError;
+};
+
+// 상대 Shape의 중심 부분(구는 중심점, 캡슐은 선분, 박스는 박스 자체)에서 p와 가장 가까운 점과 그 부분의 반지름
+alglm::vec3 getClosestCorePoint(EType type, const ConvexInfo &convex, const alglm::vec3 &p, float &coreRadius)
+{
+	alglm::vec3 d = p - convex.center;
+	if (type == EType::BOX)
+	{
+		coreRadius = 0.0f;
+		alglm::vec3 closest = convex.center;
+		for (int32_t i = 0; i < 3; ++i)
+		{
+			float t = std::max(-convex.halfSize[i], std::min(alglm::dot(d, convex.axes[i]), convex.halfSize[i]));
+			closest += convex.axes[i] * t;
+		}
+		return closest;
+	}
+
+	coreRadius = convex.radius;
+	if (type == EType::CAPSULE)
+	{
+		float halfHeight = convex.height * 0.5f;
+		float t = std::max(-halfHeight, std::min(alglm::dot(d, convex.axes[0]), halfHeight));
+		return convex.center + convex.axes[0] * t;
+	}
+	return convex.center;
+}
+
+// 해석적 계산을 켜고 끈 상태로 같은 Contact를 평가
+void evaluatePair(Contact *contact, const Transform &transformA, const Transform &transformB, int32_t typeMask,
+				  Manifold &analytic, Manifold &epa)
+{
+	PhysicsStats stats{};
+
+	analytic.pointsCount = 0;
+	contact->evaluate(analytic, transformA, transformB, false, stats);
+
+	Contact::setAnalyticEnabled(typeMask, false);
+	epa.pointsCount = 0;
+	contact->evaluate(epa, transformA, transformB, false, stats);
+	Contact::setAnalyticEnabled(typeMask, true);
+}
+
+ValidationResult validatePair(World &world, EType type, Rigidbody *other, int32_t sampleCount, std::mt19937 &rng)
+{
+	ValidationResult result{};
+
+	Rigidbody *sphere = createSphereBody(world, EBodyType::DYNAMIC_BODY, alglm::vec3(0.0f), SPHERE_RADIUS);
+	Fixture *sphereFixture = sphere->getFixtures();
+	Fixture *otherFixture = other->getFixtures();
+	int32_t typeMask = EType::SPHERE | type;
+
+	// Contact::create는 타입 순서로 Fixture를 정렬하므로 구가 항상 A
+	Contact *contact = Contact::create(sphereFixture, otherFixture, 0, 0);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> depthRange(0.02f, SPHERE_RADIUS - 0.05f);
+
+	while (result.sampleCount < sampleCount)
+	{
+		Transform transformB(alglm::vec3(0.0f), getRandomOrientation(rng));
+		const ConvexInfo &convexB = otherFixture->getConvexInfo(transformB);
+
+		// 상대 Shape 표면 근처의 점을 뽑고 표면 밖으로 원하는 관통 깊이만큼 떨어진 위치에 구 중심을 둠
+		alglm::vec3 direction(unit(rng), unit(rng), unit(rng));
+		if (alglm::length2(direction) < 1e-4f)
+		{
+			continue;
+		}
+		alglm::vec3 probe = convexB.center + direction * 2.0f;
+		float coreRadius;
+		alglm::vec3 core = getClosestCorePoint(type, convexB, probe, coreRadius);
+		if (alglm::length2(probe - core) < 1e-4f)
+		{
+			continue;
+		}
+		alglm::vec3 outward = alglm::normalize(probe - core);
+		float depth = depthRange(rng);
+		alglm::vec3 center = core + outward * (coreRadius + SPHERE_RADIUS - depth);
+
+		// 구 중심에서 다시 가장 가까운 점을 구해 바깥쪽 특징이 바뀌지 않았는지 확인
+		alglm::vec3 check = getClosestCorePoint(type, convexB, center, coreRadius);
+		if (alglm::length2(check - core) > 1e-6f)
+		{
+			continue;
+		}
+
+		Transform transformA(center, alglm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+		Manifold analytic;
+		Manifold epa;
+		evaluatePair(contact, transformA, transformB, typeMask, analytic, epa);
+		++result.sampleCount;
+
+		if (analytic.pointsCount == 0)
+		{
+			++result.analyticMissCount;
+			continue;
+		}
+
+		// 법선은 A(구)에서 B를 향함
+		const ManifoldPoint &a = analytic.points[0];
+		result.maxExactNormalError = std::max(result.maxExactNormalError, 1.0f - alglm::dot(a.normal, -outward));
+		result.maxExactDepthError = std::max(result.maxExactDepthError, std::abs(a.seperation - depth));
+
+		if (epa.pointsCount == 0)
+		{
+			++result.epaMissCount;
+			continue;
+		}
+
+		const ManifoldPoint &e = epa.points[0];
+		result.maxEpaNormalError = std::max(result.maxEpaNormalError, 1.0f - alglm::dot(a.normal, e.normal));
+		result.maxEpaDepthError = std::max(result.maxEpaDepthError, std::abs(a.seperation - e.seperation));
+	}
+
+	Contact::destroy(contact);
+	world.destroyBody(sphere);
+	return result;
+}
+
+void reportResult(const char *name, const ValidationResult &result)
+{
+	std::printf("%-16s samples %6d  miss %d/%d  exact: normal %.2e depth %.2e  gjk/epa: normal %.2e depth %.2e\n",
+				name, result.sampleCount, result.analyticMissCount, result.epaMissCount, result.maxExactNormalError,
+				result.maxExactDepthError, result.maxEpaNormalError, result.maxEpaDepthError);
+
+	float epaMissRatio = static_cast<float>(result.epaMissCount) / static_cast<float>(result.sampleCount);
+	expect(result.analyticMissCount == 0, "analytic contact missed a penetrating pair");
+	expect(epaMissRatio <= MAX_EPA_MISS_RATIO, "GJK/EPA missed too many penetrating pairs");
+	expect(result.maxExactNormalError < EXACT_NORMAL_TOLERANCE, "analytic normal differs from the exact normal");
+	expect(result.maxExactDepthError < EXACT_DEPTH_TOLERANCE, "analytic depth differs from the exact depth");
+	expect(result.maxEpaNormalError < EPA_NORMAL_TOLERANCE, "analytic normal differs from the GJK/EPA normal");
+	expect(result.maxEpaDepthError < EPA_DEPTH_TOLERANCE, "analytic depth differs from the GJK/EPA depth");
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	int32_t sampleCount = ale::isQuickRun(argc, argv) ? 500 : 20000;
+
+	ale::World world(1);
+	std::mt19937 rng(1234);
+
+	ale::Rigidbody *sphere = ale::createSphereBody(world, ale::EBodyType::STATIC_BODY, alglm::vec3(0.0f), 0.75f);
+	ale::Rigidbody *box =
+		ale::createBoxBody(world, ale::EBodyType::STATIC_BODY, alglm::vec3(0.0f), alglm::vec3(2.0f, 1.0f, 0.5f));
+	ale::Rigidbody *capsule = ale::createCapsuleBody(world, ale::EBodyType::STATIC_BODY, alglm::vec3(0.0f), 0.4f, 1.5f);
+
+	ale::reportResult("SphereToSphere", ale::validatePair(world, ale::EType::SPHERE, sphere, sampleCount, rng));
+	ale::reportResult("SphereToBox", ale::validatePair(world, ale::EType::BOX, box, sampleCount, rng));
+	ale::reportResult("SphereToCapsule", ale::validatePair(world, ale::EType::CAPSULE, capsule, sampleCount, rng));
+
+	return ale::finishBenchmark();
+}
@@ -0,0 +1,261 @@
+#include "BenchmarkUtil.h"
+
+#include "Physics/DynamicTree.h"
+
+#include <random>
+
+// 1k, 10k, 100k개의 Proxy로 DynamicTree의 생성, 이동, AABB 쿼리, ray cast 비용을 측정
+// 쿼리는 4갈래 트리 경로와 트리가 바뀐 뒤 updateWideTree 전까지 사용하는 이진 트리 경로를 나누어 측정함
+// 두 경로의 결과가 전수 검사와 같은지, 이진 트리 순회 스택이 힙으로 넘어간 뒤에도 순서를 지키는지도 확인함
+
+namespace ale
+{
+namespace
+{
+const float PROXY_SIZE = 1.0f;
+const float PROXY_MARGIN = 0.1f;
+const float QUERY_SIZE = 2.0f;
+const float RAY_LENGTH = 20.0f;
+const int32_t VERIFY_COUNT = 50; /**< 전수 검사와 비교할 쿼리 개수 */
+
+struct QueryCollector
+{
+	bool queryCallback(int32_t proxyId)
+	{
+		if (ids)
+		{
+			ids->push_back(proxyId);
+		}
+		++count;
+		return true;
+	}
+
+	float rayCastCallback(const RayCastInput &input, int32_t proxyId)
+	{
+		queryCallback(proxyId);
+		return input.maxFraction;
+	}
+
+	std::vector<int32_t> *ids = nullptr;
+	int64_t count = 0;
+};
+
+AABB makeAABB(const alglm::vec3 &center, float size)
+{
+	AABB aabb;
+	aabb.lowerBound = center - alglm::vec3(size * 0.5f);
+	aabb.upperBound = center + alglm::vec3(size * 0.5f);
+	return aabb;
+}
+
+// Proxy 밀도가 개수와 관계없이 같도록 공간 크기를 정함
+float getWorldSize(int32_t proxyCount)
+{
+	return 4.0f * std::cbrt(static_cast<float>(proxyCount));
+}
+
+std::vector<int32_t> collectBruteForce(const DynamicTree &tree, const std::vector<int32_t> &proxies, const AABB &aabb)
+{
+	std::vector<int32_t> ids;
+	for (int32_t proxyId : proxies)
+	{
+		if (testOverlap(tree.getFatAABB(proxyId), aabb))
+		{
+			ids.push_back(proxyId);
+		}
+	}
+	std::sort(ids.begin(), ids.end());
+	return ids;
+}
+
+std::vector<int32_t> collectQuery(const DynamicTree &tree, const AABB &aabb)
+{
+	std::vector<int32_t> ids;
+	QueryCollector collector;
+	collector.ids = &ids;
+	tree.query(&collector, aabb);
+	std::sort(ids.begin(), ids.end());
+	return ids;
+}
+
+std::vector<int32_t> collectRayCast(const DynamicTree &tree, const RayCastInput &input)
+{
+	std::vector<int32_t> ids;
+	QueryCollector collector;
+	collector.ids = &ids;
+	tree.rayCast(&collector, input);
+	std::sort(ids.begin(), ids.end());
+	return ids;
+}
+
+// 한 Proxy를 멀리 옮겼다 같은 Fat AABB로 되돌려 4갈래 트리를 다시 만들기 전 상태(이진 트리 경로)로 만듦
+void markWideTreeDirty(DynamicTree &tree, int32_t proxyId)
+{
+	AABB fatAABB = tree.getFatAABB(proxyId);
+	AABB moved = fatAABB;
+	moved.lowerBound += alglm::vec3(1.0e4f);
+	moved.upperBound += alglm::vec3(1.0e4f);
+	tree.setFatAABB(proxyId, moved);
+	tree.setFatAABB(proxyId, fatAABB);
+}
+
+// 객체 안의 배열 크기를 넘겨 힙으로 옮긴 뒤에도 넣은 역순으로 꺼내는지 확인
+void checkGrowableStack()
+{
+	const int32_t count = 1000;
+	GrowableStack<int32_t, 4> stack;
+	for (int32_t i = 0; i < count; ++i)
+	{
+		stack.push(i);
+	}
+
+	bool ordered = true;
+	for (int32_t i = count - 1; i >= 0; --i)
+	{
+		ordered = ordered && stack.empty() == false && stack.pop() == i;
+	}
+	expect(ordered && stack.empty(), "GrowableStack lost its order after growing");
+}
+
+void benchmarkTree(int32_t proxyCount, int32_t queryCount, bool quick)
+{
+	std::printf("-- %d proxies --\n", proxyCount);
+
+	std::mt19937 rng(proxyCount);
+	float worldSize = getWorldSize(proxyCount);
+	std::uniform_real_distribution<float> position(0.0f, worldSize);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	CollisionFilter filter;
+
+	DynamicTree tree;
+	std::vector<int32_t> proxies(proxyCount);
+	BenchmarkTimer timer;
+	for (int32_t i = 0; i < proxyCount; ++i)
+	{
+		alglm::vec3 center(position(rng), position(rng), position(rng));
+		proxies[i] = tree.createProxy(makeAABB(center, PROXY_SIZE), nullptr, filter, PROXY_MARGIN);
+	}
+	printBenchmark("createProxy", timer.getElapsedMs(), proxyCount);
+
+	timer.reset();
+	tree.rebuild();
+	printBenchmark("rebuild (SAH, per proxy)", timer.getElapsedMs(), proxyCount);
+
+	timer.reset();
+	tree.updateWideTree(proxyCount * 2);
+	printBenchmark("updateWideTree (per proxy)", timer.getElapsedMs(), proxyCount);
+
+	std::vector<AABB> queries(queryCount);
+	std::vector<RayCastInput> rays(queryCount);
+	for (int32_t i = 0; i < queryCount; ++i)
+	{
+		alglm::vec3 center(position(rng), position(rng), position(rng));
+		queries[i] = makeAABB(center, QUERY_SIZE);
+
+		alglm::vec3 direction(unit(rng), unit(rng), unit(rng));
+		if (alglm::length2(direction) < 1e-4f)
+		{
+			direction = alglm::vec3(1.0f, 0.0f, 0.0f);
+		}
+		rays[i].p1 = center;
+		rays[i].p2 = center + alglm::normalize(direction) * RAY_LENGTH;
+		rays[i].maxFraction = 1.0f;
+		rays[i].radius = 0.0f;
+	}
+
+	// 4갈래 트리 경로
+	std::vector<std::vector<int32_t>> wideQueryIds(VERIFY_COUNT);
+	std::vector<std::vector<int32_t>> wideRayIds(VERIFY_COUNT);
+	for (int32_t i = 0; i < VERIFY_COUNT; ++i)
+	{
+		wideQueryIds[i] = collectQuery(tree, queries[i]);
+		wideRayIds[i] = collectRayCast(tree, rays[i]);
+	}
+
+	QueryCollector collector;
+	timer.reset();
+	for (const AABB &aabb : queries)
+	{
+		tree.query(&collector, aabb);
+	}
+	printBenchmark("query (wide tree)", timer.getElapsedMs(), queryCount);
+
+	timer.reset();
+	for (const RayCastInput &input : rays)
+	{
+		tree.rayCast(&collector, input);
+	}
+	printBenchmark("rayCast (wide tree)", timer.getElapsedMs(), queryCount);
+
+	// 이진 트리 경로
+	markWideTreeDirty(tree, proxies[0]);
+	for (int32_t i = 0; i < VERIFY_COUNT; ++i)
+	{
+		std::vector<int32_t> expected = collectBruteForce(tree, proxies, queries[i]);
+		expect(collectQuery(tree, queries[i]) == expected, "binary tree query differs from brute force");
+		expect(wideQueryIds[i] == expected, "wide tree query differs from brute force");
+		expect(collectRayCast(tree, rays[i]) == wideRayIds[i], "binary and wide tree ray casts differ");
+	}
+
+	timer.reset();
+	for (const AABB &aabb : queries)
+	{
+		tree.query(&collector, aabb);
+	}
+	printBenchmark("query (binary tree)", timer.getElapsedMs(), queryCount);
+
+	timer.reset();
+	for (const RayCastInput &input : rays)
+	{
+		tree.rayCast(&collector, input);
+	}
+	printBenchmark("rayCast (binary tree)", timer.getElapsedMs(), queryCount);
+
+	// 한 step에 Proxy의 1%가 Fat AABB를 벗어나는 만큼 이동
+	int32_t moveCount = std::max(1, proxyCount / 100);
+	int32_t stepCount = quick ? 10 : 100;
+	std::uniform_int_distribution<int32_t> pick(0, proxyCount - 1);
+	timer.reset();
+	for (int32_t step = 0; step < stepCount; ++step)
+	{
+		for (int32_t i = 0; i < moveCount; ++i)
+		{
+			int32_t proxyId = proxies[pick(rng)];
+			AABB aabb = tree.getFatAABB(proxyId);
+			alglm::vec3 displacement(unit(rng), unit(rng), unit(rng));
+			alglm::vec3 center = (aabb.lowerBound + aabb.upperBound) * 0.5f + displacement;
+			tree.moveProxy(proxyId, makeAABB(center, PROXY_SIZE), displacement, PROXY_MARGIN, 0.0f);
+		}
+	}
+	printBenchmark("moveProxy (reinsert)", timer.getElapsedMs(), static_cast<int64_t>(stepCount) * moveCount);
+
+	TreeQuality quality = tree.computeQuality();
+	std::printf("height %d, area ratio %.1f, results %lld\n", quality.height, quality.areaRatio,
+				static_cast<long long>(collector.count));
+	expect(quality.proxyCount == proxyCount, "proxy count changed while moving proxies");
+
+	for (int32_t proxyId : proxies)
+	{
+		tree.destroyProxy(proxyId);
+	}
+	TreeQuality empty = tree.computeQuality();
+	expect(empty.proxyCount == 0 && empty.nodeCount == 0, "tree is not empty after destroying every proxy");
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+
+	ale::checkGrowableStack();
+	ale::benchmarkTree(1000, quick ? 1000 : 100000, quick);
+	ale::benchmarkTree(10000, quick ? 1000 : 100000, quick);
+	if (quick == false)
+	{
+		ale::benchmarkTree(100000, 100000, quick);
+	}
+
+	return ale::finishBenchmark();
+}
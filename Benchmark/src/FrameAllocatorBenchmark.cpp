@@ -0,0 +1,158 @@
+#include "BenchmarkUtil.h"
+
+#include "Memory/FrameAllocator.h"
+
+// 프레임마다 작은 임시 할당을 반복하는 부하를 힙(operator new / delete, std::vector)과 FrameAllocator로 비교
+// --quick으로 실행하면 프레임 수를 줄이고 정렬, 버퍼 확장, 힙 할당 횟수 검사만 확인함
+
+namespace ale
+{
+namespace
+{
+const int32_t ALLOCATIONS_PER_FRAME = 2000;
+const int32_t VECTOR_ELEMENTS_PER_FRAME = 1024;
+
+// 16 ~ 256 바이트를 고르게 섞은 할당 크기
+size_t getAllocationSize(int32_t index)
+{
+	return 16 + static_cast<size_t>((index * 37) % 241);
+}
+
+void benchmarkRawAllocations(int32_t frameCount)
+{
+	std::vector<void *> pointers(ALLOCATIONS_PER_FRAME);
+
+	BenchmarkTimer timer;
+	for (int32_t frame = 0; frame < frameCount; ++frame)
+	{
+		for (int32_t i = 0; i < ALLOCATIONS_PER_FRAME; ++i)
+		{
+			pointers[i] = ::operator new(getAllocationSize(i));
+			static_cast<char *>(pointers[i])[0] = static_cast<char>(i);
+		}
+		for (int32_t i = 0; i < ALLOCATIONS_PER_FRAME; ++i)
+		{
+			::operator delete(pointers[i]);
+		}
+	}
+	printBenchmark("operator new / delete", timer.getElapsedMs(),
+				   static_cast<int64_t>(frameCount) * ALLOCATIONS_PER_FRAME);
+
+	FrameAllocator allocator;
+	timer.reset();
+	for (int32_t frame = 0; frame < frameCount; ++frame)
+	{
+		allocator.beginFrame();
+		for (int32_t i = 0; i < ALLOCATIONS_PER_FRAME; ++i)
+		{
+			pointers[i] = allocator.allocate(getAllocationSize(i));
+			static_cast<char *>(pointers[i])[0] = static_cast<char>(i);
+		}
+	}
+	printBenchmark("FrameAllocator::allocate", timer.getElapsedMs(),
+				   static_cast<int64_t>(frameCount) * ALLOCATIONS_PER_FRAME);
+	consumeValue(pointers[0]);
+}
+
+void benchmarkVectors(int32_t frameCount)
+{
+	int32_t sum = 0;
+
+	BenchmarkTimer timer;
+	for (int32_t frame = 0; frame < frameCount; ++frame)
+	{
+		std::vector<int32_t> values;
+		for (int32_t i = 0; i < VECTOR_ELEMENTS_PER_FRAME; ++i)
+		{
+			values.push_back(i);
+		}
+		sum += values[frame % VECTOR_ELEMENTS_PER_FRAME];
+	}
+	printBenchmark("std::vector push_back", timer.getElapsedMs(),
+				   static_cast<int64_t>(frameCount) * VECTOR_ELEMENTS_PER_FRAME);
+
+	FrameAllocator allocator;
+	timer.reset();
+	for (int32_t frame = 0; frame < frameCount; ++frame)
+	{
+		allocator.beginFrame();
+		std::pmr::vector<int32_t> values(allocator.getResource());
+		for (int32_t i = 0; i < VECTOR_ELEMENTS_PER_FRAME; ++i)
+		{
+			values.push_back(i);
+		}
+		sum += values[frame % VECTOR_ELEMENTS_PER_FRAME];
+	}
+	printBenchmark("std::pmr::vector push_back (FrameAllocator)", timer.getElapsedMs(),
+				   static_cast<int64_t>(frameCount) * VECTOR_ELEMENTS_PER_FRAME);
+	consumeValue(sum);
+}
+
+void checkAlignment()
+{
+	FrameAllocator allocator;
+	allocator.beginFrame();
+	allocator.allocate(3);
+	void *p = allocator.allocate(24, 64);
+	expect(reinterpret_cast<uintptr_t>(p) % 64 == 0, "allocate(24, 64) is not 64-byte aligned");
+}
+
+void checkOverflowGrowth()
+{
+	const size_t capacity = 1024;
+	FrameAllocator allocator(capacity);
+
+	// 버퍼 크기의 4배를 매 프레임 할당하면 버퍼를 두 번 사용한 뒤부터는 힙에서 할당하지 않아야 함
+	for (int32_t frame = 0; frame < 3; ++frame)
+	{
+		allocator.beginFrame();
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			allocator.allocate(capacity);
+		}
+	}
+	allocator.beginFrame();
+
+	const FrameAllocatorStats &stats = allocator.getStats();
+	expect(stats.capacity >= 4 * capacity, "FrameAllocator did not grow after overflowing");
+	expect(stats.overflowCount == 0, "FrameAllocator still overflows after growing");
+	expect(stats.bytesUsed == 4 * capacity, "FrameAllocator bytesUsed does not match the allocations");
+}
+
+void checkHeapAllocations()
+{
+#ifdef AL_COUNT_HEAP_ALLOCATIONS
+	FrameAllocator allocator;
+	for (int32_t frame = 0; frame < 4; ++frame)
+	{
+		allocator.beginFrame();
+		std::pmr::vector<int32_t> values(allocator.getResource());
+		for (int32_t i = 0; i < VECTOR_ELEMENTS_PER_FRAME; ++i)
+		{
+			values.push_back(i);
+		}
+	}
+	allocator.beginFrame();
+	expect(allocator.getStats().heapAllocationCount == 0, "std::pmr::vector on FrameAllocator used the heap");
+#else
+	std::printf("heap allocation check skipped (AL_COUNT_HEAP_ALLOCATIONS is OFF)\n");
+#endif
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+	int32_t frameCount = quick ? 100 : 10000;
+
+	ale::checkAlignment();
+	ale::checkOverflowGrowth();
+	ale::checkHeapAllocations();
+
+	ale::benchmarkRawAllocations(frameCount);
+	ale::benchmarkVectors(frameCount);
+
+	return ale::finishBenchmark();
+}
@@ -0,0 +1,202 @@
+#include "BenchmarkBodies.h"
+
+#include <thread>
+
+// 같은 씬을 결정론적 모드(Island를 생성 순서대로 호출한 스레드에서 solve)와 워커 개수별 병렬 Island solve로
+// 실행하여 step 시간을 비교함. 결정론적 모드의 워커 1개 World를 기준으로 함
+// 1. 서로 떨어진 작은 더미 여러 개: Island가 많아 병렬로 나눌 수 있는 경우
+// 2. 큰 더미 하나: 대부분의 Rigidbody가 한 Island에 묶여 병렬로 나눌 작업이 적은 경우
+// 더미는 Rigidbody를 서로 맞닿게 격자로 쌓고, step마다 Island 개수와 가장 큰 Island 크기를 함께 출력함
+// Island는 서로 공유하는 동적 Rigidbody가 없으므로 solve 순서나 스레드와 관계없이 결과가 같아야 함
+// 모든 실행이 기준과 비트 단위로 같은 Transform에서 끝나는지 확인함
+
+namespace ale
+{
+namespace
+{
+const float TIMESTEP = 1.0f / 60.0f;
+const float BODY_SPACING = 0.8f; /**< 더미 안에서 Rigidbody 중심 사이 간격 (크기와 같아 서로 맞닿음) */
+const float PILE_GAP = 3.0f;	 /**< 더미 사이 빈 공간 (더미끼리 닿지 않음) */
+
+struct SceneDesc
+{
+	const char *name;
+	int32_t pileGrid;	/**< 한 변에 놓는 더미 수 */
+	int32_t pileWidth;	/**< 더미 하나의 가로, 세로 Rigidbody 수 */
+	int32_t pileHeight; /**< 더미 하나의 층 수 */
+};
+
+struct StepResult
+{
+	double stepMs;
+	double solveMs;					   /**< PhysicsStats의 islandTime + solveTime */
+	double islandCount;				   /**< step당 평균 Island 수 */
+	double largestIslandSize;		   /**< step당 평균 가장 큰 Island의 body 수 */
+	double awakeBodyCount;			   /**< step당 평균 깨어 있는 Rigidbody 수 */
+	std::vector<Transform> transforms; /**< 마지막 step 뒤 동적 Rigidbody의 Transform */
+};
+
+int32_t getBodyCount(const SceneDesc &desc)
+{
+	return desc.pileGrid * desc.pileGrid * desc.pileWidth * desc.pileWidth * desc.pileHeight;
+}
+
+Rigidbody *createPileBody(World &world, const alglm::vec3 &position, std::mt19937 &rng, int32_t index)
+{
+	alglm::quat orientation = getRandomOrientation(rng);
+	switch (index % 4)
+	{
+	case 0:
+		return createBoxBody(world, EBodyType::DYNAMIC_BODY, position, alglm::vec3(0.8f), orientation);
+	case 1:
+		return createSphereBody(world, EBodyType::DYNAMIC_BODY, position, 0.4f);
+	case 2:
+		return createCapsuleBody(world, EBodyType::DYNAMIC_BODY, position, 0.25f, 0.6f, orientation);
+	default:
+		return createCylinderBody(world, EBodyType::DYNAMIC_BODY, position, 0.35f, 0.7f, orientation);
+	}
+}
+
+// 같은 seed로 같은 순서로 생성하므로 모든 World의 Rigidbody 리스트 순서가 같음
+std::vector<Rigidbody *> createScene(World &world, const SceneDesc &desc)
+{
+	std::mt19937 rng(getBodyCount(desc));
+
+	float pileSize = BODY_SPACING * static_cast<float>(desc.pileWidth);
+	float pileStride = pileSize + PILE_GAP;
+	float groundSize = pileStride * static_cast<float>(desc.pileGrid) + PILE_GAP;
+	createBoxBody(world, EBodyType::STATIC_BODY, alglm::vec3(0.0f, -0.5f, 0.0f),
+				  alglm::vec3(groundSize, 1.0f, groundSize));
+
+	std::vector<Rigidbody *> bodies;
+	float origin = -0.5f * (pileStride * static_cast<float>(desc.pileGrid) - PILE_GAP - BODY_SPACING);
+	for (int32_t pileX = 0; pileX < desc.pileGrid; ++pileX)
+	{
+		for (int32_t pileZ = 0; pileZ < desc.pileGrid; ++pileZ)
+		{
+			alglm::vec3 corner(origin + pileStride * static_cast<float>(pileX), BODY_SPACING * 0.5f,
+							   origin + pileStride * static_cast<float>(pileZ));
+			for (int32_t y = 0; y < desc.pileHeight; ++y)
+			{
+				for (int32_t x = 0; x < desc.pileWidth; ++x)
+				{
+					for (int32_t z = 0; z < desc.pileWidth; ++z)
+					{
+						alglm::vec3 offset(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+						int32_t index = static_cast<int32_t>(bodies.size());
+						bodies.push_back(createPileBody(world, corner + offset * BODY_SPACING, rng, index));
+					}
+				}
+			}
+		}
+	}
+	return bodies;
+}
+
+StepResult runScene(const SceneDesc &desc, int32_t workerCount, bool isDeterministic, int32_t stepCount)
+{
+	World world(workerCount);
+	world.setDeterministic(isDeterministic);
+	std::vector<Rigidbody *> bodies = createScene(world, desc);
+
+	StepResult result = {};
+	BenchmarkTimer timer;
+	for (int32_t step = 0; step < stepCount; ++step)
+	{
+		timer.reset();
+		world.step(TIMESTEP);
+		result.stepMs += timer.getElapsedMs();
+
+		const PhysicsStats &stats = world.getStats();
+		result.solveMs += stats.islandTime + stats.solveTime;
+		result.islandCount += stats.islandCount;
+		result.largestIslandSize += stats.largestIslandSize;
+		result.awakeBodyCount += stats.awakeBodyCount;
+	}
+	result.islandCount /= stepCount;
+	result.largestIslandSize /= stepCount;
+	result.awakeBodyCount /= stepCount;
+
+	result.transforms.reserve(bodies.size());
+	for (Rigidbody *body : bodies)
+	{
+		result.transforms.push_back(body->getTransform());
+	}
+	return result;
+}
+
+bool isSameTransforms(const std::vector<Transform> &a, const std::vector<Transform> &b)
+{
+	if (a.size() != b.size())
+	{
+		return false;
+	}
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		const alglm::quat &p = a[i].orientation;
+		const alglm::quat &q = b[i].orientation;
+		if (a[i].position != b[i].position || p.x != q.x || p.y != q.y || p.z != q.z || p.w != q.w)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void printResult(const char *name, const StepResult &result, const StepResult &baseline, int32_t stepCount)
+{
+	printBenchmark(name, result.stepMs, stepCount);
+	std::printf("    island build + solve %.3f ms/step, x%.2f step time vs serial\n", result.solveMs / stepCount,
+				baseline.stepMs / result.stepMs);
+}
+
+void benchmarkScene(const SceneDesc &desc, const std::vector<int32_t> &workerCounts, int32_t stepCount)
+{
+	std::printf("-- %s: %d bodies, %d steps --\n", desc.name, getBodyCount(desc), stepCount);
+
+	StepResult serial = runScene(desc, 1, true, stepCount);
+	std::printf("per step: islands %.1f, largest island %.1f bodies, awake bodies %.1f\n", serial.islandCount,
+				serial.largestIslandSize, serial.awakeBodyCount);
+	printResult("serial (deterministic, 1 worker)", serial, serial, stepCount);
+	expect(serial.awakeBodyCount > 0.0, "every body fell asleep before the first step");
+
+	char name[64];
+	for (int32_t workerCount : workerCounts)
+	{
+		StepResult parallel = runScene(desc, workerCount, false, stepCount);
+		std::snprintf(name, sizeof(name), "parallel (%d worker(s))", workerCount);
+		printResult(name, parallel, serial, stepCount);
+		expect(isSameTransforms(parallel.transforms, serial.transforms),
+			   "parallel island solve ended in a different state from the serial solve");
+	}
+
+	// 결정론적 모드는 워커 개수와 관계없이 같은 결과를 내야 함
+	StepResult deterministic = runScene(desc, workerCounts.back(), true, stepCount);
+	expect(isSameTransforms(deterministic.transforms, serial.transforms),
+		   "deterministic mode depends on the worker count");
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+	int32_t stepCount = quick ? 60 : 300;
+
+	int32_t hardwareThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
+	std::printf("hardware threads %d\n", hardwareThreads);
+
+	std::vector<int32_t> workerCounts = {1, 2, 4};
+	if (hardwareThreads > workerCounts.back())
+	{
+		workerCounts.push_back(hardwareThreads);
+	}
+
+	ale::SceneDesc piles = {"many small piles", quick ? 4 : 12, 2, 3};
+	ale::SceneDesc heap = {"one large pile", 1, quick ? 4 : 12, quick ? 3 : 12};
+	ale::benchmarkScene(piles, workerCounts, stepCount);
+	ale::benchmarkScene(heap, workerCounts, stepCount);
+
+	return ale::finishBenchmark();
+}
@@ -0,0 +1,174 @@
+#include "BenchmarkBodies.h"
+
+#include <thread>
+
+// 정적 Rigidbody를 흩어 놓은 World에서 rayCast, sphereCast, overlapAABB 한 번씩 호출하는 비용과
+// rayCastBatch로 한 번에 처리하는 비용을 비교함
+// rayCastBatch는 워커 1개(호출한 스레드에서 순서대로 처리)와 하드웨어 스레드 개수로 각각 측정하고,
+// 두 결과가 rayCast를 하나씩 호출한 결과와 같은지 확인함
+
+namespace ale
+{
+namespace
+{
+const float BODY_SPACING = 4.0f; /**< Rigidbody 하나가 차지하는 공간의 한 변 길이 */
+const float SPHERE_CAST_RADIUS = 0.25f;
+const float OVERLAP_SIZE = 3.0f;
+
+float getWorldSize(int32_t bodyCount)
+{
+	return BODY_SPACING * std::cbrt(static_cast<float>(bodyCount));
+}
+
+// Box, Sphere, Capsule, Cylinder를 번갈아 임의의 위치와 회전으로 배치
+void createScene(World &world, int32_t bodyCount)
+{
+	std::mt19937 rng(bodyCount);
+	std::uniform_real_distribution<float> position(0.0f, getWorldSize(bodyCount));
+
+	for (int32_t i = 0; i < bodyCount; ++i)
+	{
+		alglm::vec3 center(position(rng), position(rng), position(rng));
+		alglm::quat orientation = getRandomOrientation(rng);
+		switch (i % 4)
+		{
+		case 0:
+			createBoxBody(world, EBodyType::STATIC_BODY, center, alglm::vec3(1.0f, 0.5f, 1.5f), orientation);
+			break;
+		case 1:
+			createSphereBody(world, EBodyType::STATIC_BODY, center, 0.5f);
+			break;
+		case 2:
+			createCapsuleBody(world, EBodyType::STATIC_BODY, center, 0.3f, 1.0f, orientation);
+			break;
+		default:
+			createCylinderBody(world, EBodyType::STATIC_BODY, center, 0.4f, 1.0f, orientation);
+			break;
+		}
+	}
+	world.rebuildBroadPhase();
+}
+
+std::vector<Ray> createRays(int32_t bodyCount, int32_t rayCount)
+{
+	std::mt19937 rng(rayCount);
+	float worldSize = getWorldSize(bodyCount);
+	std::uniform_real_distribution<float> position(0.0f, worldSize);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	std::vector<Ray> rays(rayCount);
+	for (Ray &ray : rays)
+	{
+		ray.origin = alglm::vec3(position(rng), position(rng), position(rng));
+		ray.direction = alglm::vec3(unit(rng), unit(rng), unit(rng));
+		if (alglm::length2(ray.direction) < 1e-4f)
+		{
+			ray.direction = alglm::vec3(1.0f, 0.0f, 0.0f);
+		}
+		ray.maxDistance = worldSize * 0.5f;
+	}
+	return rays;
+}
+
+// 같은 순서로 만든 다른 World의 결과와도 비교하므로 포인터 대신 충돌 거리와 지점으로 비교
+// (Body ID는 World 사이에서 이어지는 전역 번호라 World마다 다름)
+bool isSameHit(const RayCastHit &a, const RayCastHit &b)
+{
+	if (a.body == nullptr || b.body == nullptr)
+	{
+		return a.body == b.body;
+	}
+	return a.distance == b.distance && a.point == b.point;
+}
+
+void benchmarkSingleQueries(World &world, const std::vector<Ray> &rays, std::vector<RayCastHit> &hits)
+{
+	int32_t rayCount = static_cast<int32_t>(rays.size());
+	int32_t hitCount = 0;
+
+	BenchmarkTimer timer;
+	for (int32_t i = 0; i < rayCount; ++i)
+	{
+		hitCount += world.rayCast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hits[i]) ? 1 : 0;
+	}
+	printBenchmark("rayCast (one call per ray)", timer.getElapsedMs(), rayCount);
+
+	RayCastHit hit;
+	timer.reset();
+	for (const Ray &ray : rays)
+	{
+		hitCount += world.sphereCast(ray.origin, SPHERE_CAST_RADIUS, ray.direction, ray.maxDistance, hit) ? 1 : 0;
+	}
+	printBenchmark("sphereCast (one call per sphere)", timer.getElapsedMs(), rayCount);
+
+	std::vector<Rigidbody *> bodies;
+	int32_t overlapCount = 0;
+	timer.reset();
+	for (const Ray &ray : rays)
+	{
+		AABB aabb;
+		aabb.lowerBound = ray.origin - alglm::vec3(OVERLAP_SIZE * 0.5f);
+		aabb.upperBound = ray.origin + alglm::vec3(OVERLAP_SIZE * 0.5f);
+		overlapCount += world.overlapAABB(aabb, bodies);
+	}
+	printBenchmark("overlapAABB", timer.getElapsedMs(), rayCount);
+
+	std::printf("ray/sphere hits %d, overlapping bodies %d\n", hitCount, overlapCount);
+	expect(hitCount > 0, "no ray or sphere cast hit a body");
+}
+
+void benchmarkBatch(World &world, const std::vector<Ray> &rays, const std::vector<RayCastHit> &expected,
+					const char *name)
+{
+	int32_t rayCount = static_cast<int32_t>(rays.size());
+	std::vector<RayCastHit> hits(rayCount);
+
+	BenchmarkTimer timer;
+	int32_t hitCount = world.rayCastBatch(rays.data(), rayCount, hits.data());
+	printBenchmark(name, timer.getElapsedMs(), rayCount);
+
+	int32_t expectedCount = 0;
+	bool isSame = true;
+	for (int32_t i = 0; i < rayCount; ++i)
+	{
+		expectedCount += expected[i].body != nullptr ? 1 : 0;
+		isSame = isSame && isSameHit(hits[i], expected[i]);
+	}
+	expect(hitCount == expectedCount, "rayCastBatch hit count differs from single rayCast calls");
+	expect(isSame, "rayCastBatch result differs from single rayCast calls");
+}
+
+void benchmarkQueries(int32_t bodyCount, int32_t rayCount)
+{
+	std::printf("-- %d bodies, %d queries --\n", bodyCount, rayCount);
+	std::vector<Ray> rays = createRays(bodyCount, rayCount);
+	std::vector<RayCastHit> hits(rayCount);
+
+	World serialWorld(1);
+	createScene(serialWorld, bodyCount);
+	benchmarkSingleQueries(serialWorld, rays, hits);
+	benchmarkBatch(serialWorld, rays, hits, "rayCastBatch (1 worker)");
+
+	World parallelWorld;
+	createScene(parallelWorld, bodyCount);
+	char name[64];
+	std::snprintf(name, sizeof(name), "rayCastBatch (default World, %d worker(s))", parallelWorld.getWorkerCount());
+	benchmarkBatch(parallelWorld, rays, hits, name);
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+
+	std::printf("hardware threads %u\n", std::thread::hardware_concurrency());
+	ale::benchmarkQueries(1000, quick ? 2000 : 100000);
+	if (quick == false)
+	{
+		ale::benchmarkQueries(10000, 100000);
+	}
+
+	return ale::finishBenchmark();
+}
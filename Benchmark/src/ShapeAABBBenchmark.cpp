@@ -0,0 +1,171 @@
+#include "BenchmarkBodies.h"
+
+#include "Physics/PhysicsAllocator.h"
+
+// Box, Capsule, Cylinder의 닫힌 형태 computeAABB와 이전 구현(m_vertices를 변환해 AABB를 구함)의 비용을 비교
+// 임의의 Transform마다 닫힌 형태 AABB가
+//   1. getShapeInfo 점(GJK에서 사용하는 꼭짓점)의 AABB를 포함하고
+//   2. 이전 구현의 AABB보다 크지 않으며
+//   3. 박스는 꼭짓점이 실제 모서리이므로 이전 구현과 같은지 확인함
+
+namespace ale
+{
+namespace
+{
+const float AABB_TOLERANCE = 1e-4f;
+const alglm::vec3 LOCAL_CENTER(0.1f, -0.2f, 0.3f); /**< Shape 로컬 중심 오프셋도 검사하도록 0이 아닌 값 사용 */
+
+struct ShapeCheck
+{
+	bool isHullBounded = true;	  /**< 닫힌 형태가 getShapeInfo 점을 모두 포함 */
+	bool isNotLooser = true;	  /**< 닫힌 형태가 이전 구현보다 크지 않음 */
+	bool isSameAsVertices = true; /**< 닫힌 형태가 이전 구현과 같음 */
+};
+
+// 이전 computeAABB 구현: 꼭짓점 집합을 복사해 변환 행렬을 곱하고 최소, 최대를 구함
+AABB computeVertexAABB(const std::set<alglm::vec3, Vec3Comparator> &vertices, const Transform &xf)
+{
+	std::vector<alglm::vec3> vertexVector(vertices.begin(), vertices.end());
+	alglm::mat4 transformMatrix = xf.toMatrix();
+
+	alglm::vec3 upper(std::numeric_limits<float>::lowest());
+	alglm::vec3 lower(std::numeric_limits<float>::max());
+	for (alglm::vec3 &vertex : vertexVector)
+	{
+		alglm::vec4 v = transformMatrix * alglm::vec4(vertex, 1.0f);
+		vertex = alglm::vec3(v.x, v.y, v.z);
+
+		upper = alglm::max(upper, vertex);
+		lower = alglm::min(lower, vertex);
+	}
+
+	AABB aabb;
+	aabb.upperBound = upper;
+	aabb.lowerBound = lower;
+	return aabb;
+}
+
+AABB computeHullAABB(const Shape &shape, const Transform &xf)
+{
+	ConvexInfo convex = shape.getShapeInfo(xf);
+
+	AABB aabb;
+	aabb.upperBound = alglm::vec3(std::numeric_limits<float>::lowest());
+	aabb.lowerBound = alglm::vec3(std::numeric_limits<float>::max());
+	for (int32_t i = 0; i < convex.pointsCount; ++i)
+	{
+		aabb.upperBound = alglm::max(aabb.upperBound, convex.points[i]);
+		aabb.lowerBound = alglm::min(aabb.lowerBound, convex.points[i]);
+	}
+
+	PhysicsAllocator::m_blockAllocator.freeBlock(convex.points, sizeof(alglm::vec3) * convex.pointsCount);
+	PhysicsAllocator::m_blockAllocator.freeBlock(convex.axes, sizeof(alglm::vec3) * convex.axesCount);
+	return aabb;
+}
+
+// outer가 inner를 허용 오차 안에서 포함하면 true
+bool containsAABB(const AABB &outer, const AABB &inner)
+{
+	for (int32_t i = 0; i < 3; ++i)
+	{
+		if (inner.lowerBound[i] < outer.lowerBound[i] - AABB_TOLERANCE ||
+			inner.upperBound[i] > outer.upperBound[i] + AABB_TOLERANCE)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename T>
+void benchmarkShape(const char *name, const T &shape, const std::vector<Transform> &transforms, bool isExactVertices)
+{
+	int64_t count = static_cast<int64_t>(transforms.size());
+	char label[64];
+	alglm::vec3 sum(0.0f);
+
+	BenchmarkTimer timer;
+	for (const Transform &xf : transforms)
+	{
+		AABB aabb = computeVertexAABB(shape.m_vertices, xf);
+		sum += aabb.upperBound - aabb.lowerBound;
+	}
+	std::snprintf(label, sizeof(label), "%s (vertices, previous)", name);
+	printBenchmark(label, timer.getElapsedMs(), count);
+
+	timer.reset();
+	for (const Transform &xf : transforms)
+	{
+		AABB aabb;
+		shape.computeAABB(&aabb, xf);
+		sum += aabb.upperBound - aabb.lowerBound;
+	}
+	std::snprintf(label, sizeof(label), "%s::computeAABB (closed form)", name);
+	printBenchmark(label, timer.getElapsedMs(), count);
+	consumeValue(sum);
+
+	ShapeCheck check;
+	float volumeRatio = 0.0f;
+	for (const Transform &xf : transforms)
+	{
+		AABB closed;
+		shape.computeAABB(&closed, xf);
+		AABB vertices = computeVertexAABB(shape.m_vertices, xf);
+
+		check.isHullBounded = check.isHullBounded && containsAABB(closed, computeHullAABB(shape, xf));
+		check.isNotLooser = check.isNotLooser && containsAABB(vertices, closed);
+		check.isSameAsVertices = check.isSameAsVertices && containsAABB(closed, vertices);
+
+		alglm::vec3 closedSize = closed.upperBound - closed.lowerBound;
+		alglm::vec3 vertexSize = vertices.upperBound - vertices.lowerBound;
+		volumeRatio += (closedSize.x * closedSize.y * closedSize.z) / (vertexSize.x * vertexSize.y * vertexSize.z);
+	}
+	std::printf("%s AABB volume / previous AABB volume: %.3f\n", name, volumeRatio / static_cast<float>(count));
+
+	expect(check.isHullBounded, "closed form AABB does not bound the getShapeInfo points");
+	expect(check.isNotLooser, "closed form AABB is larger than the previous vertex AABB");
+	if (isExactVertices)
+	{
+		expect(check.isSameAsVertices, "closed form box AABB differs from the corner AABB");
+	}
+}
+
+std::vector<Transform> createTransforms(int32_t count)
+{
+	std::mt19937 rng(count);
+	std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+
+	std::vector<Transform> transforms;
+	transforms.reserve(count);
+	for (int32_t i = 0; i < count; ++i)
+	{
+		transforms.emplace_back(alglm::vec3(position(rng), position(rng), position(rng)), getRandomOrientation(rng));
+	}
+
+	// 축 정렬 자세에서 sqrt(1 - u_i^2)가 0이 되는 경우도 포함
+	transforms[0] = Transform(alglm::vec3(0.0f), alglm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+	transforms[1] = Transform(alglm::vec3(0.0f), alglm::angleAxis(alglm::pi<float>() * 0.5f, alglm::vec3(1, 0, 0)));
+	return transforms;
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	std::vector<ale::Transform> transforms = ale::createTransforms(ale::isQuickRun(argc, argv) ? 10000 : 1000000);
+
+	ale::BoxShape box;
+	box.setVertices(ale::LOCAL_CENTER, alglm::vec3(1.0f, 0.5f, 2.0f));
+	ale::benchmarkShape("BoxShape", box, transforms, true);
+
+	ale::CapsuleShape capsule;
+	capsule.setShapeFeatures(ale::LOCAL_CENTER, 0.4f, 1.5f);
+	ale::benchmarkShape("CapsuleShape", capsule, transforms, false);
+
+	ale::CylinderShape cylinder;
+	cylinder.setShapeFeatures(ale::LOCAL_CENTER, 0.5f, 1.2f);
+	ale::benchmarkShape("CylinderShape", cylinder, transforms, false);
+
+	return ale::finishBenchmark();
+}
@@ -0,0 +1,177 @@
+#include "BenchmarkBodies.h"
+
+#include "Physics/PhysicsAllocator.h"
+
+#include <deque>
+
+// 정적 바닥 위에 동적 Rigidbody를 계속 생성하고 일정 시간이 지나면 제거하는 부하를 반복함
+// 한 웨이브가 끝날 때마다 남은 Rigidbody를 모두 제거하고, BroadPhase 트리의 노드와 Proxy 개수, Contact 개수,
+// BlockAllocator 사용량이 처음 상태로 돌아오는지 확인함
+
+namespace ale
+{
+namespace
+{
+const float TIMESTEP = 1.0f / 60.0f;
+const int32_t FRAMES_PER_WAVE = 120;
+const int32_t BODY_LIFETIME = 60; /**< 생성 후 제거할 때까지의 프레임 수 */
+const float SPAWN_AREA = 12.0f;	  /**< 생성 위치의 x, z 범위 */
+
+struct WorldCounts
+{
+	int32_t bodyCount;
+	int32_t proxyCount;
+	int32_t nodeCount;
+	int32_t contactCount;
+	int64_t liveBytes; /**< PhysicsAllocator::m_blockAllocator의 사용 중인 바이트 수 */
+};
+
+WorldCounts getWorldCounts(World &world)
+{
+	TreeQuality quality = world.getBroadPhaseQuality();
+	const PhysicsStats &stats = world.getStats();
+
+	WorldCounts counts;
+	counts.bodyCount = stats.bodyCount;
+	counts.proxyCount = quality.proxyCount;
+	counts.nodeCount = quality.nodeCount;
+	counts.contactCount = stats.contactCount;
+	counts.liveBytes = PhysicsAllocator::m_blockAllocator.getStats().liveBytes;
+	return counts;
+}
+
+void printWorldCounts(const char *name, const WorldCounts &counts)
+{
+	std::printf("%-10s bodies %d, proxies %d, tree nodes %d, contacts %d, block allocator %lld bytes\n", name,
+				counts.bodyCount, counts.proxyCount, counts.nodeCount, counts.contactCount,
+				static_cast<long long>(counts.liveBytes));
+}
+
+Rigidbody *spawnBody(World &world, std::mt19937 &rng)
+{
+	std::uniform_real_distribution<float> area(-SPAWN_AREA * 0.5f, SPAWN_AREA * 0.5f);
+	std::uniform_real_distribution<float> height(1.0f, 6.0f);
+	std::uniform_int_distribution<int32_t> shape(0, 3);
+
+	alglm::vec3 position(area(rng), height(rng), area(rng));
+	alglm::quat orientation = getRandomOrientation(rng);
+	switch (shape(rng))
+	{
+	case 0:
+		return createBoxBody(world, EBodyType::DYNAMIC_BODY, position, alglm::vec3(0.8f), orientation);
+	case 1:
+		return createSphereBody(world, EBodyType::DYNAMIC_BODY, position, 0.4f);
+	case 2:
+		return createCapsuleBody(world, EBodyType::DYNAMIC_BODY, position, 0.25f, 0.6f, orientation);
+	default:
+		return createCylinderBody(world, EBodyType::DYNAMIC_BODY, position, 0.35f, 0.7f, orientation);
+	}
+}
+
+// 프레임마다 spawnPerFrame개를 생성하고 BODY_LIFETIME이 지난 Rigidbody를 제거한 뒤 step
+// 마지막에 남은 Rigidbody를 모두 제거하고 한 번 더 step 하여 Contact 통계를 갱신함
+int32_t runWave(World &world, int32_t spawnPerFrame, std::mt19937 &rng, double &spawnMs, double &stepMs)
+{
+	std::deque<std::pair<Rigidbody *, int32_t>> bodies;
+	int32_t peakContactCount = 0;
+	BenchmarkTimer timer;
+
+	for (int32_t frame = 0; frame < FRAMES_PER_WAVE; ++frame)
+	{
+		timer.reset();
+		for (int32_t i = 0; i < spawnPerFrame; ++i)
+		{
+			bodies.emplace_back(spawnBody(world, rng), frame);
+		}
+		while (bodies.empty() == false && frame - bodies.front().second >= BODY_LIFETIME)
+		{
+			world.destroyBody(bodies.front().first);
+			bodies.pop_front();
+		}
+		spawnMs += timer.getElapsedMs();
+
+		timer.reset();
+		world.step(TIMESTEP);
+		stepMs += timer.getElapsedMs();
+		peakContactCount = std::max(peakContactCount, world.getStats().contactCount);
+	}
+
+	timer.reset();
+	for (const std::pair<Rigidbody *, int32_t> &body : bodies)
+	{
+		world.destroyBody(body.first);
+	}
+	spawnMs += timer.getElapsedMs();
+	world.step(TIMESTEP);
+
+	return peakContactCount;
+}
+
+bool isSameCounts(const WorldCounts &a, const WorldCounts &b)
+{
+	return a.bodyCount == b.bodyCount && a.proxyCount == b.proxyCount && a.nodeCount == b.nodeCount &&
+		   a.contactCount == b.contactCount;
+}
+
+void runSoak(int32_t waveCount, int32_t spawnPerFrame)
+{
+	World world(1);
+	world.setBroadPhaseOptimization(16, 1.5f);
+	std::mt19937 rng(1234);
+
+	createBoxBody(world, EBodyType::STATIC_BODY, alglm::vec3(0.0f, -0.5f, 0.0f),
+				  alglm::vec3(SPAWN_AREA * 2.0f, 1.0f, SPAWN_AREA * 2.0f));
+	createBoxBody(world, EBodyType::STATIC_BODY, alglm::vec3(2.0f, 0.5f, -1.0f), alglm::vec3(2.0f, 1.0f, 4.0f));
+	createCylinderBody(world, EBodyType::STATIC_BODY, alglm::vec3(-3.0f, 1.0f, 2.0f), 1.0f, 2.0f);
+	world.step(TIMESTEP);
+
+	WorldCounts baseline = getWorldCounts(world);
+	printWorldCounts("baseline", baseline);
+
+	// 정적 Fixture의 ConvexInfo 캐시처럼 처음 충돌할 때 한 번 할당하는 메모리가 있으므로
+	// BlockAllocator 사용량은 첫 웨이브 뒤의 값을 기준으로 비교함
+	int64_t baselineLiveBytes = 0;
+	int32_t peakContactCount = 0;
+	double spawnMs = 0.0;
+	double stepMs = 0.0;
+	bool isCountsRestored = true;
+	bool isMemoryRestored = true;
+	for (int32_t wave = 0; wave < waveCount; ++wave)
+	{
+		peakContactCount = std::max(peakContactCount, runWave(world, spawnPerFrame, rng, spawnMs, stepMs));
+
+		WorldCounts counts = getWorldCounts(world);
+		isCountsRestored = isCountsRestored && isSameCounts(counts, baseline);
+		if (wave == 0)
+		{
+			baselineLiveBytes = counts.liveBytes;
+		}
+		isMemoryRestored = isMemoryRestored && counts.liveBytes == baselineLiveBytes;
+		if (wave == 0 || wave == waveCount - 1)
+		{
+			printWorldCounts(wave == 0 ? "wave 0" : "last wave", counts);
+		}
+	}
+
+	int64_t bodyCount = static_cast<int64_t>(waveCount) * FRAMES_PER_WAVE * spawnPerFrame;
+	printBenchmark("createBody + destroyBody", spawnMs, bodyCount);
+	printBenchmark("step", stepMs, static_cast<int64_t>(waveCount) * FRAMES_PER_WAVE);
+	std::printf("peak contacts %d\n", peakContactCount);
+
+	expect(peakContactCount > baseline.contactCount, "spawned bodies never touched anything");
+	expect(isCountsRestored, "body, proxy, tree node or contact count did not return to the baseline");
+	expect(isMemoryRestored, "block allocator usage kept growing across waves");
+	expect(baseline.nodeCount == 2 * baseline.proxyCount - 1, "tree node count does not match the proxy count");
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+
+	ale::runSoak(quick ? 3 : 20, quick ? 2 : 8);
+
+	return ale::finishBenchmark();
+}
@@ -0,0 +1,207 @@
+#include "BenchmarkUtil.h"
+
+#include "Physics/BroadPhase.h"
+
+#include <random>
+
+// BroadPhase에 Proxy를 만들고 1M번 임의로 이동시킨 뒤 트리 품질과 AABB 쿼리, ray cast 비용을 측정
+// setTreeOptimization의 회전 예산과 재구성 표면적 배율 조합별로 같은 이동을 반복하여 비교함
+// 이동마다 찾은 Pair 개수는 트리 모양과 관계없으므로 모든 조합에서 같은지 확인함
+
+namespace ale
+{
+namespace
+{
+const float PROXY_SIZE = 1.0f;
+const float PROXY_MARGIN = 0.1f;
+const float MAX_STEP_DISPLACEMENT = 2.0f; /**< 한 번 이동할 때 축별 최대 이동 거리 */
+const float QUERY_SIZE = 2.0f;
+const float RAY_LENGTH = 20.0f;
+const int32_t MOVE_RATIO = 20; /**< step마다 Proxy의 1 / MOVE_RATIO를 이동 */
+
+struct TreeOptimization
+{
+	int32_t rotationBudget;
+	float rebuildAreaRatio;
+};
+
+struct PairCounter
+{
+	void addPair(void *, void *)
+	{
+		++count;
+	}
+
+	int64_t count = 0;
+};
+
+struct QueryCounter
+{
+	bool queryCallback(int32_t)
+	{
+		++count;
+		return true;
+	}
+
+	float rayCastCallback(const RayCastInput &input, int32_t)
+	{
+		++count;
+		return input.maxFraction;
+	}
+
+	int64_t count = 0;
+};
+
+AABB makeAABB(const alglm::vec3 &center, float size)
+{
+	AABB aabb;
+	aabb.lowerBound = center - alglm::vec3(size * 0.5f);
+	aabb.upperBound = center + alglm::vec3(size * 0.5f);
+	return aabb;
+}
+
+float getWorldSize(int32_t proxyCount)
+{
+	return 4.0f * std::cbrt(static_cast<float>(proxyCount));
+}
+
+void measureQueries(const BroadPhase &broadPhase, const std::vector<AABB> &queries,
+					const std::vector<RayCastInput> &rays, const char *queryName, const char *rayName)
+{
+	QueryCounter counter;
+	BenchmarkTimer timer;
+	for (const AABB &aabb : queries)
+	{
+		broadPhase.query(&counter, aabb);
+	}
+	printBenchmark(queryName, timer.getElapsedMs(), static_cast<int64_t>(queries.size()));
+
+	timer.reset();
+	for (const RayCastInput &input : rays)
+	{
+		broadPhase.rayCast(&counter, input);
+	}
+	printBenchmark(rayName, timer.getElapsedMs(), static_cast<int64_t>(rays.size()));
+	consumeValue(counter.count);
+}
+
+// 같은 seed로 같은 생성과 이동을 재현하므로 모든 조합이 같은 Proxy 배치에서 끝남
+int64_t runOptimization(const TreeOptimization &optimization, int32_t proxyCount, int64_t moveCount)
+{
+	std::printf("-- rotation budget %d, rebuild area ratio x%.2f --\n", optimization.rotationBudget,
+				optimization.rebuildAreaRatio);
+
+	std::mt19937 rng(proxyCount);
+	float worldSize = getWorldSize(proxyCount);
+	std::uniform_real_distribution<float> position(0.0f, worldSize);
+	std::uniform_real_distribution<float> displacement(-MAX_STEP_DISPLACEMENT, MAX_STEP_DISPLACEMENT);
+	std::uniform_int_distribution<int32_t> pick(0, proxyCount - 1);
+
+	BroadPhase broadPhase;
+	broadPhase.setTreeOptimization(optimization.rotationBudget, optimization.rebuildAreaRatio);
+	CollisionFilter filter;
+	std::vector<int32_t> proxies(proxyCount);
+	std::vector<alglm::vec3> centers(proxyCount);
+	for (int32_t i = 0; i < proxyCount; ++i)
+	{
+		centers[i] = alglm::vec3(position(rng), position(rng), position(rng));
+		proxies[i] = broadPhase.createProxy(makeAABB(centers[i], PROXY_SIZE), nullptr, filter, PROXY_MARGIN);
+	}
+	broadPhase.rebuildTree();
+
+	PairCounter pairs;
+	broadPhase.updatePairs(&pairs);
+
+	// step마다 Proxy 일부를 이동하고 World처럼 updatePairs에서 트리를 정리함
+	int32_t movesPerStep = std::max(1, proxyCount / MOVE_RATIO);
+	int64_t stepCount = moveCount / movesPerStep;
+	double moveMs = 0.0;
+	double updateMs = 0.0;
+	BenchmarkTimer timer;
+	for (int64_t step = 0; step < stepCount; ++step)
+	{
+		timer.reset();
+		for (int32_t i = 0; i < movesPerStep; ++i)
+		{
+			int32_t index = pick(rng);
+			alglm::vec3 delta(displacement(rng), displacement(rng), displacement(rng));
+			alglm::vec3 center = centers[index] + delta;
+			for (int32_t axis = 0; axis < 3; ++axis)
+			{
+				center[axis] = std::max(0.0f, std::min(center[axis], worldSize));
+			}
+			delta = center - centers[index];
+			centers[index] = center;
+			broadPhase.moveProxy(proxies[index], makeAABB(center, PROXY_SIZE), delta, PROXY_MARGIN, 0.0f);
+		}
+		moveMs += timer.getElapsedMs();
+
+		timer.reset();
+		broadPhase.updatePairs(&pairs);
+		updateMs += timer.getElapsedMs();
+	}
+	printBenchmark("moveProxy", moveMs, stepCount * movesPerStep);
+	printBenchmark("updatePairs (optimize, rebuild, pair query)", updateMs, stepCount);
+
+	TreeQuality quality = broadPhase.getTreeQuality();
+	std::printf("after %lld moves: area ratio %.1f, height %d\n", static_cast<long long>(stepCount * movesPerStep),
+				quality.areaRatio, quality.height);
+
+	int32_t queryCount = std::min(proxyCount * 10, 100000);
+	std::vector<AABB> queries(queryCount);
+	std::vector<RayCastInput> rays(queryCount);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	for (int32_t i = 0; i < queryCount; ++i)
+	{
+		alglm::vec3 center(position(rng), position(rng), position(rng));
+		queries[i] = makeAABB(center, QUERY_SIZE);
+
+		alglm::vec3 direction(unit(rng), unit(rng), unit(rng));
+		if (alglm::length2(direction) < 1e-4f)
+		{
+			direction = alglm::vec3(1.0f, 0.0f, 0.0f);
+		}
+		rays[i].p1 = center;
+		rays[i].p2 = center + alglm::normalize(direction) * RAY_LENGTH;
+		rays[i].maxFraction = 1.0f;
+		rays[i].radius = 0.0f;
+	}
+	// 마지막 updatePairs는 이동한 Proxy 수만큼만 쿼리를 예상하므로 4갈래 트리를 다시 접어 두 측정 모두 같은 경로 사용
+	broadPhase.updateQueryTree(proxyCount * 2);
+	measureQueries(broadPhase, queries, rays, "query", "rayCast");
+
+	// 같은 배치를 SAH로 새로 만든 트리가 도달할 수 있는 기준
+	broadPhase.rebuildTree();
+	broadPhase.updateQueryTree(proxyCount * 2);
+	std::printf("after rebuild: area ratio %.1f\n", broadPhase.getTreeQuality().areaRatio);
+	measureQueries(broadPhase, queries, rays, "query (after rebuild)", "rayCast (after rebuild)");
+
+	return pairs.count;
+}
+} // namespace
+} // namespace ale
+
+int main(int argc, char **argv)
+{
+	ale::Log::init();
+	bool quick = ale::isQuickRun(argc, argv);
+	int32_t proxyCount = quick ? 2000 : 10000;
+	int64_t moveCount = quick ? 20000 : 1000000;
+
+	// 재구성 비율은 마지막 SAH 재구성 직후 표면적 비율에 대한 배율
+	const ale::TreeOptimization optimizations[] = {{0, 0.0f},	{16, 0.0f},	 {64, 0.0f},  {0, 1.25f},
+												   {16, 1.1f}, {16, 1.25f}, {16, 1.5f}, {16, 2.0f}};
+
+	int64_t expectedPairCount = -1;
+	for (const ale::TreeOptimization &optimization : optimizations)
+	{
+		int64_t pairCount = ale::runOptimization(optimization, proxyCount, moveCount);
+		if (expectedPairCount < 0)
+		{
+			expectedPairCount = pairCount;
+		}
+		ale::expect(pairCount == expectedPairCount, "pair count depends on the tree optimization settings");
+	}
+
+	return ale::finishBenchmark();
+}
@@ -1,4 +1,8 @@
 #include "EditorLayer.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/MemoryTracker.h"
+#include "Physics/PhysicsAllocator.h"
+#include "Physics/World.h"
 #include "Renderer/RenderingComponent.h"
 #include "Scene/SceneSerializer.h"
 #include "Scripting/ScriptingEngine.h"
@@ -106,6 +110,8 @@ void EditorLayer::onImGuiRender()
 	m_ContentBrowserPanel->onImGuiRender();
 
 	// Stats - hovered entity, rendered entities
+	uiPhysicsStats();
+	uiMemoryStats();
 
 	// viewport - texture descriptor set을 가져올 수 있는 방법 있으면 좋을듯
 
@@ -272,10 +278,159 @@ void EditorLayer::setMenuBar()
 			ImGui::EndMenu();
 		}
 
+		if (ImGui::BeginMenu("View"))
+		{
+			ImGui::MenuItem("Memory Stats", nullptr, &m_ShowMemoryStats);
+
+			ImGui::EndMenu();
+		}
+
 		ImGui::EndMenuBar();
 	}
 }
 
+void EditorLayer::uiPhysicsStats()
+{
+	ImGui::Begin("Physics Stats");
+
+	World *world = m_ActiveScene ? m_ActiveScene->getPhysicsWorld() : nullptr;
+	if (world == nullptr)
+	{
+		ImGui::Text("Physics world is not running");
+		ImGui::End();
+		return;
+	}
+
+	const PhysicsStats &stats = world->getStats();
+
+	ImGui::Text("Bodies: %d (awake %d)", stats.bodyCount, stats.awakeBodyCount);
+	ImGui::Text("Pairs: %d", stats.pairCount);
+	ImGui::Text("Proxy Reinserts: %d", stats.reinsertCount);
+	ImGui::Text("Contacts: %d (touching %d, new %d)", stats.contactCount, stats.touchingContactCount,
+				stats.newContactCount);
+	ImGui::Text("GJK iterations: %d", stats.gjkIterations);
+	ImGui::Text("EPA faces: %d", stats.epaFaces);
+	ImGui::Text("Islands: %d (largest %d)", stats.islandCount, stats.largestIslandSize);
+
+	if (ImGui::TreeNode("Island Size Histogram"))
+	{
+		for (int32_t i = 0; i < ISLAND_HISTOGRAM_SIZE; ++i)
+		{
+			if (i == ISLAND_HISTOGRAM_SIZE - 1)
+				ImGui::Text("%d+ : %d", 1 << i, stats.islandSizeHistogram[i]);
+			else
+				ImGui::Text("%d-%d : %d", 1 << i, (1 << (i + 1)) - 1, stats.islandSizeHistogram[i]);
+		}
+		ImGui::TreePop();
+	}
+
+	ImGui::Separator();
+	ImGui::Text("Integrate: %.3f ms", stats.integrateTime);
+	ImGui::Text("BroadPhase: %.3f ms", stats.broadPhaseTime);
+	ImGui::Text("NarrowPhase: %.3f ms", stats.narrowPhaseTime);
+	ImGui::Text("Island: %.3f ms", stats.islandTime);
+	ImGui::Text("Solve: %.3f ms", stats.solveTime);
+	ImGui::Text("TOI: %.3f ms", stats.toiTime);
+	ImGui::Text("Step: %.3f ms", stats.stepTime);
+
+	StackAllocatorStats stackStats = world->getStackAllocatorStats();
+	ImGui::Separator();
+	ImGui::Text("Stack capacity: %.1f KB", stackStats.capacity / 1024.0f);
+	ImGui::Text("Stack high water: %.1f KB", stackStats.highWater / 1024.0f);
+	ImGui::Text("Stack overflows: %d", stackStats.overflowCount);
+
+	if (ImGui::TreeNode("Block Allocator"))
+	{
+		BlockAllocator &allocator = PhysicsAllocator::m_blockAllocator;
+		BlockAllocatorStats blockStats = allocator.getStats();
+		ImGui::Text("Reserved: %.1f KB, live: %.1f KB", blockStats.reservedBytes / 1024.0f,
+					blockStats.liveBytes / 1024.0f);
+		for (int32_t i = 0; i < BLOCK_SIZE_COUNT; ++i)
+		{
+			if (blockStats.chunkCounts[i] == 0)
+				continue;
+			ImGui::Text("%4d B : %d chunks, %d live, %d free", BlockAllocator::getBlockSize(i),
+						blockStats.chunkCounts[i], blockStats.liveBlocks[i], blockStats.freeBlocks[i]);
+		}
+
+		if (ImGui::Button("Trim"))
+			allocator.trim();
+		ImGui::SameLine();
+		if (ImGui::Button("Log"))
+			allocator.logStats();
+		ImGui::TreePop();
+	}
+
+	ImGui::End();
+}
+
+void EditorLayer::uiMemoryStats()
+{
+	if (!m_ShowMemoryStats)
+		return;
+
+	ImGui::Begin("Memory Stats", &m_ShowMemoryStats);
+
+	const FrameAllocatorStats &frameStats = FrameAllocator::get().getStats();
+#ifdef AL_COUNT_HEAP_ALLOCATIONS
+	ImGui::Text("Heap allocations per frame: %llu", static_cast<unsigned long long>(frameStats.heapAllocationCount));
+#else
+	ImGui::Text("Heap allocations per frame: off (build with AL_COUNT_HEAP_ALLOCATIONS)");
+#endif
+	ImGui::Separator();
+	ImGui::Text("Frame arena: %.1f / %.1f KB (high water %.1f KB)", frameStats.bytesUsed / 1024.0f,
+				frameStats.capacity / 1024.0f, frameStats.highWater / 1024.0f);
+	ImGui::Text("Frame arena allocations: %d (overflow %d)", frameStats.allocationCount, frameStats.overflowCount);
+	ImGui::Separator();
+
+	// 태그별 사용량과 예산 (예산은 MB 단위, 0이면 제한 없음)
+	ImGui::Columns(5);
+	ImGui::Text("Tag");
+	ImGui::NextColumn();
+	ImGui::Text("Current (KB)");
+	ImGui::NextColumn();
+	ImGui::Text("Peak (KB)");
+	ImGui::NextColumn();
+	ImGui::Text("Allocs/frame");
+	ImGui::NextColumn();
+	ImGui::Text("Budget (MB)");
+	ImGui::NextColumn();
+	for (int32_t index = 0; index < MEMORY_TAG_COUNT; ++index)
+	{
+		MemoryTag tag = static_cast<MemoryTag>(index);
+		MemoryTagStats stats = MemoryTracker::getStats(tag);
+		bool isOverBudget = stats.budgetBytes > 0 && stats.currentBytes > stats.budgetBytes;
+
+		ImGui::Text("%s", MemoryTracker::getTagName(tag));
+		ImGui::NextColumn();
+		if (isOverBudget)
+			ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%.1f", stats.currentBytes / 1024.0f);
+		else
+			ImGui::Text("%.1f", stats.currentBytes / 1024.0f);
+		ImGui::NextColumn();
+		ImGui::Text("%.1f", stats.peakBytes / 1024.0f);
+		ImGui::NextColumn();
+		ImGui::Text("%d", stats.frameAllocations);
+		ImGui::NextColumn();
+
+		int budget = static_cast<int>(stats.budgetBytes / (1024 * 1024));
+		ImGui::PushID(index);
+		if (ImGui::InputInt("##budget", &budget))
+			MemoryTracker::setBudget(tag, static_cast<int64_t>(std::max(budget, 0)) * 1024 * 1024);
+		ImGui::PopID();
+		ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+
+	if (ImGui::Button("Reset Peaks"))
+		MemoryTracker::resetPeaks();
+	ImGui::SameLine();
+	if (ImGui::Button("Log"))
+		MemoryTracker::logStats();
+
+	ImGui::End();
+}
+
 void EditorLayer::uiToolBar()
 {
 	// ImGui::Begin("##toolbar", nullptr);
@@ -74,6 +74,8 @@ class EditorLayer : public Layer
 	void setDockingSpace();
 	void setMenuBar();
 	void uiToolBar();
+	void uiPhysicsStats();
+	void uiMemoryStats();
 
 	// PROJECT
 	void newProject();
@@ -122,6 +124,8 @@ class EditorLayer : public Layer
 
 	alglm::vec2 m_ViewportSize = {0.0f, 0.0f};
 
+	bool m_ShowMemoryStats = true;
+
 	enum class ESceneState
 	{
 		EDIT = 0,
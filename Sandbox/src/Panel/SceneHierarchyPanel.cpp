@@ -582,6 +582,16 @@ static void drawCheckBox(const std::string &label, bool &values)
 	ImGui::Checkbox(label.c_str(), &values);
 }
 
+template <typename T> static void drawCollisionFilterControl(T &component)
+{
+	// 레이어 비트는 16진수로 편집
+	ImGui::InputScalar("CategoryBits", ImGuiDataType_U32, &component.m_CategoryBits, nullptr, nullptr, "%08X",
+					   ImGuiInputTextFlags_CharsHexadecimal);
+	ImGui::InputScalar("MaskBits", ImGuiDataType_U32, &component.m_MaskBits, nullptr, nullptr, "%08X",
+					   ImGuiInputTextFlags_CharsHexadecimal);
+	ImGui::InputInt("GroupIndex", &component.m_GroupIndex);
+}
+
 template <typename T, typename UIFunction>
 static void drawComponent(const std::string &name, Entity entity, UIFunction uiFunction)
 {
@@ -1544,6 +1554,7 @@ void SceneHierarchyPanel::drawComponents(Entity entity)
 		drawFloatControl("Drag", component.m_Damping);
 		drawFloatControl("Angular Drag", component.m_AngularDamping);
 		drawCheckBox("Gravity", component.m_UseGravity);
+		drawCheckBox("Bullet", component.m_IsBullet);
 
 		// collision num
 		ImGui::InputInt("Touched Num", &component.m_TouchNum, 0, 0, ImGuiInputTextFlags_ReadOnly);
@@ -1638,6 +1649,7 @@ void SceneHierarchyPanel::drawComponents(Entity entity)
 			bdDef.m_linearDamping = component.m_Damping;
 			bdDef.m_angularDamping = component.m_AngularDamping;
 			bdDef.m_useGravity = component.m_UseGravity;
+			bdDef.m_isBullet = component.m_IsBullet;
 
 			Rigidbody *body = (Rigidbody *)component.body;
 			body->setRBComponentValue(bdDef);
@@ -1653,6 +1665,7 @@ void SceneHierarchyPanel::drawComponents(Entity entity)
 		drawCheckBox("IsActive", component.m_IsActive);
 		drawFloatControl("Friction", component.m_Friction);
 		drawFloatControl("Restitution", component.m_Restitution);
+		drawCollisionFilterControl(component);
 		// Runtime 중 수정 기능
 	});
 	drawComponent<SphereColliderComponent>("SphereCollider", entity, [](auto &component) {
@@ -1662,6 +1675,7 @@ void SceneHierarchyPanel::drawComponents(Entity entity)
 		drawCheckBox("IsActive", component.m_IsActive);
 		drawFloatControl("Friction", component.m_Friction);
 		drawFloatControl("Restitution", component.m_Restitution);
+		drawCollisionFilterControl(component);
 		// Runtime 중 수정 기능
 	});
 	drawComponent<CapsuleColliderComponent>("CapsuleCollider", entity, [](auto &component) {
@@ -1672,6 +1686,7 @@ void SceneHierarchyPanel::drawComponents(Entity entity)
 		drawCheckBox("IsActive", component.m_IsActive);
 		drawFloatControl("Friction", component.m_Friction);
 		drawFloatControl("Restitution", component.m_Restitution);
+		drawCollisionFilterControl(component);
 		// Runtime 중 수정 기능
 	});
 	drawComponent<CylinderColliderComponent>("CylinderCollider", entity, [](auto &component) {
@@ -1682,6 +1697,7 @@ void SceneHierarchyPanel::drawComponents(Entity entity)
 		drawCheckBox("IsActive", component.m_IsActive);
 		drawFloatControl("Friction", component.m_Friction);
 		drawFloatControl("Restitution", component.m_Restitution);
+		drawCollisionFilterControl(component);
 		// Runtime 중 수정 기능
 	});
 }